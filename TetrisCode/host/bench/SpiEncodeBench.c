@@ -0,0 +1,89 @@
+/**
+ * @file SpiEncodeBench.c
+ * @brief Encode-Durchsatz des SPI-Bitstroms auf dem Host: Bit-Schleife ↔ Tabelle
+ *
+ * Gegenstück zu led_strip_spi_encode_bench() (LedStripBench.c, auf dem Gerät
+ * mit CONFIG_TETRIS_LED_ENCODER_BENCH) für dieselben Größen
+ * LED_SPI_BENCH_SMALL/LARGE. Gemessen wird reine CPU-Zeit mit clock_gettime,
+ * jeweils das Minimum über mehrere Runden (robust gegen Störungen durch das OS).
+ *
+ * Vorher wird geprüft, dass beide Varianten für jeden Bytewert denselben
+ * Bitstrom liefern; nur das entscheidet über den Exit-Code (ctest). Die
+ * Zeiten sind Host-Zahlen und nur im Verhältnis aussagekräftig.
+ */
+
+#include "Ws2812Spi.h"
+#include "Globals.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCH_ROUNDS   50
+#define BENCH_REPEAT   20      // Encodes pro Runde (Auflösung der Uhr)
+
+typedef void (*spi_encode_fn)(const uint8_t *, size_t, uint8_t *);
+
+static int64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+/**
+ * @brief ns pro Encode von n Farbbytes (Minimum über BENCH_ROUNDS)
+ */
+static double bench_ns(spi_encode_fn encode, const uint8_t *in, size_t n, uint8_t *out) {
+    int64_t best = INT64_MAX;
+    for (int r = 0; r < BENCH_ROUNDS; r++) {
+        int64_t start = now_ns();
+        for (int k = 0; k < BENCH_REPEAT; k++) {
+            encode(in, n, out);
+            __asm__ volatile("" : : "r"(out) : "memory");  // Ergebnis gilt als benutzt
+        }
+        int64_t t = now_ns() - start;
+        if (t < best) best = t;
+    }
+    return (double)best / BENCH_REPEAT;
+}
+
+static int check_equivalence(void) {
+    uint8_t values[256];
+    uint8_t lut[256 * WS2812_SPI_BYTES_PER_COLOR];
+    uint8_t bits[256 * WS2812_SPI_BYTES_PER_COLOR];
+    for (int i = 0; i < 256; i++) values[i] = (uint8_t)i;
+
+    ws2812_spi_encode(values, 256, lut);
+    ws2812_spi_encode_bits(values, 256, bits);
+    for (int i = 0; i < 256; i++) {
+        if (memcmp(&lut[i * 3], &bits[i * 3], 3) != 0 || memcmp(ws2812_spi_lut((uint8_t)i), &bits[i * 3], 3) != 0) {
+            printf("FAIL byte 0x%02x: LUT %02x%02x%02x, bits %02x%02x%02x\n", i,
+                   lut[i * 3], lut[i * 3 + 1], lut[i * 3 + 2], bits[i * 3], bits[i * 3 + 1], bits[i * 3 + 2]);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int main(void) {
+    if (check_equivalence() != 0) return 1;
+
+    const uint32_t sizes[] = { LED_SPI_BENCH_SMALL, LED_SPI_BENCH_LARGE };
+    size_t max_bytes = LED_SPI_BENCH_LARGE * 3;
+    uint8_t *in = malloc(max_bytes);
+    uint8_t *out = malloc(max_bytes * WS2812_SPI_BYTES_PER_COLOR);
+    if (in == NULL || out == NULL) return 1;
+    for (size_t i = 0; i < max_bytes; i++) in[i] = (uint8_t)(i * 37);  // Wie auf dem Gerät
+
+    for (int s = 0; s < 2; s++) {
+        size_t n = sizes[s] * 3;
+        double bits = bench_ns(ws2812_spi_encode_bits, in, n, out);
+        double lut = bench_ns(ws2812_spi_encode, in, n, out);
+        printf("[SpiBench] %4lu LEDs: bits %8.1f us, LUT %8.1f us (%6.1f MB/s in), x%.1f\n",
+               (unsigned long)sizes[s], bits / 1000.0, lut / 1000.0, n * 1000.0 / lut, bits / lut);
+    }
+
+    free(in);
+    free(out);
+    return 0;
+}
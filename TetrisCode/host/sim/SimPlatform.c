@@ -0,0 +1,114 @@
+/**
+ * @file SimPlatform.c
+ * @brief Host-Ersatz für main.c, DisplayInit.c und ThemeSong.c
+ *
+ * Setzt dieselben Module in derselben Reihenfolge auf wie app_main(), nur
+ * ohne LED-Treiber, OLED, Buzzer und Tasks. Display- und Musik-Aufrufe des
+ * GameLoops landen hier und werden für die Statistik mitgezählt.
+ */
+
+#include "SimPlatform.h"
+#include "Globals.h"
+#include "LedMatrixInit.h"
+#include "Compositor.h"
+#include "Controls.h"
+#include "DisplayInit.h"
+#include "ThemeSong.h"
+#include "Grid.h"
+#include "Score.h"
+#include "Splash.h"
+#include "freertos/semphr.h"
+#include "freertos/event_groups.h"
+
+// ============================================================================
+// GLOBALE HANDLES (auf dem Gerät in main.c)
+// ============================================================================
+
+MATRIX ledMatrix;
+led_strip_handle_t led_strip = NULL;
+
+SemaphoreHandle_t led_strip_semaphore = NULL;
+SemaphoreHandle_t score_semaphore = NULL;
+SemaphoreHandle_t speed_semaphore = NULL;
+EventGroupHandle_t theme_event_group = NULL;
+
+static sim_platform_stats_t s_stats;
+
+// ============================================================================
+// DISPLAY (kein OLED angeschlossen)
+// ============================================================================
+
+lv_disp_t *g_disp = NULL;
+
+void display_init(void) {}
+
+bool display_available(void) {
+    return false;
+}
+
+void display_update_score(uint32_t current_score, uint32_t highscore) {
+    s_stats.hud_updates++;
+}
+
+void display_show_game_over(uint32_t final_score, uint32_t highscore) {
+    s_stats.games_over++;
+    s_stats.sum_score += final_score;
+    if (final_score > s_stats.best_score) s_stats.best_score = final_score;
+}
+
+void display_reset_and_show_hud(uint32_t highscore) {}
+
+// ============================================================================
+// MUSIK (stumm, nur der Song-Index wird geführt)
+// ============================================================================
+
+static int s_song = THEME_TETRIS;
+
+void StartTheme(void) {}
+void theme_pause(void) {}
+void theme_resume(void) {}
+
+void theme_next_song(void) {
+    s_song = (s_song + 1) % THEME_COUNT;
+}
+
+int theme_get_current_song(void) {
+    return s_song;
+}
+
+void theme_set_song(int song_index) {
+    if (song_index >= 0 && song_index < THEME_COUNT) s_song = song_index;
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+/**
+ * @brief Module wie app_main() aufsetzen (ohne Splash-Wartezeit und Tasks)
+ *
+ * Frame-Senken registriert der Aufrufer vorher; compositor_init() löscht sie.
+ */
+void sim_platform_init(void) {
+    LedMatrixInit(LED_HEIGHT, LED_WIDTH, ledMatrix.LED_Number);
+    compositor_init();
+
+    led_strip_semaphore = xSemaphoreCreateBinary();
+    xSemaphoreGive(led_strip_semaphore);
+    score_semaphore = xSemaphoreCreateBinary();
+    xSemaphoreGive(score_semaphore);
+    speed_semaphore = xSemaphoreCreateBinary();
+    xSemaphoreGive(speed_semaphore);
+    theme_event_group = xEventGroupCreate();
+    xEventGroupSetBits(theme_event_group, THEME_RUN_BIT);
+
+    splash_init();
+    grid_init();
+    score_init();
+    score_load_highscore();
+    init_controls();
+}
+
+const sim_platform_stats_t *sim_platform_stats(void) {
+    return &s_stats;
+}
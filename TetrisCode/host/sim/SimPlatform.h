@@ -0,0 +1,22 @@
+#ifndef SIM_PLATFORM_H
+#define SIM_PLATFORM_H
+
+#include <stdint.h>
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// SIM PLATFORM - Was app_main() auf dem Gerät aufsetzt, ohne Hardware (Host-Simulation)
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// Globale Handles aus main.c, LED-Matrix, Compositor, Grid/Score, Controls. Das OLED fehlt
+// (display_available() == false, Ergebnisse laufen über die Matrix), Musik ist stumm.
+
+typedef struct {
+    uint32_t games_over;        // display_show_game_over() Aufrufe
+    uint32_t best_score;        // Höchster Endstand
+    uint32_t sum_score;         // Summe der Endstände
+    uint32_t hud_updates;       // display_update_score() Aufrufe
+} sim_platform_stats_t;
+
+void sim_platform_init(void);
+const sim_platform_stats_t *sim_platform_stats(void);
+
+#endif // SIM_PLATFORM_H
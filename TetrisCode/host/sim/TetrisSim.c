@@ -0,0 +1,204 @@
+/**
+ * @file TetrisSim.c
+ * @brief Headless Simulation: GameLoop auf der virtuellen Uhr mit Bot-Eingaben
+ *
+ * Läuft ohne Hardware und ohne Tasks: game_loop_step() direkt aufgerufen,
+ * die Zeit springt über scheduler_wait() von Deadline zu Deadline (Clock.h,
+ * VIRTUAL). Ein Bot drückt Buttons über controls_inject(), der Button-Abtaster
+ * läuft über host_timer_service() mit der virtuellen Zeit.
+ *
+ * Gleicher Seed + gleicher Bot-Seed → identischer Spielverlauf. Als Prüfsumme
+ * dient ein FNV-1a Hash über jeden präsentierten Frame (eigene Frame-Senke);
+ * der letzte Frame wird zusätzlich über die Shared-Senke gelesen.
+ *
+ * Aufruf: tetris_sim [--seed N] [--bot N] [--seconds S] [--ppm PFAD]
+ */
+
+#include "GameLoop.h"
+#include "Globals.h"
+#include "Clock.h"
+#include "Controls.h"
+#include "Score.h"
+#include "Scheduler.h"
+#include "FrameSink.h"
+#include "HostStubs.h"
+#include "SimPlatform.h"
+#include "esp_check.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define FNV_OFFSET 0x811C9DC5u
+#define FNV_PRIME  0x01000193u
+
+// ============================================================================
+// HASH-SENKE (jeder präsentierte Frame fließt in die Prüfsumme)
+// ============================================================================
+
+typedef struct {
+    frame_sink_t base;
+    uint32_t hash;
+} sink_hash_t;
+
+static uint32_t fnv1a(uint32_t hash, const void *data, size_t len) {
+    const uint8_t *p = data;
+    for (size_t i = 0; i < len; i++) {
+        hash = (hash ^ p[i]) * FNV_PRIME;
+    }
+    return hash;
+}
+
+static esp_err_t hash_sink_present(frame_sink_t *base, const pixel_rgb_t *frame, const uint32_t *changed) {
+    sink_hash_t *sink = __containerof(base, sink_hash_t, base);
+    sink->hash = fnv1a(sink->hash, frame, sizeof(pixel_rgb_t) * COMPOSITOR_PIXELS);
+    return ESP_OK;
+}
+
+static void hash_sink_del(frame_sink_t *base) {}
+
+static sink_hash_t s_hash_sink = {
+    .base = { .name = "hash", .present = hash_sink_present, .del = hash_sink_del },
+    .hash = FNV_OFFSET,
+};
+
+// ============================================================================
+// BOT (eigener PRNG, unabhängig vom Block-Zufall)
+// ============================================================================
+
+typedef struct {
+    uint32_t state;
+    int held;                   // Gedrückter Button oder -1
+    int64_t next_us;            // Nächster Druck bzw. Loslassen
+    uint32_t presses;
+} bot_t;
+
+static uint32_t bot_random(bot_t *bot) {
+    uint32_t x = bot->state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    bot->state = x;
+    return x;
+}
+
+static int64_t bot_ms(bot_t *bot, uint32_t min_ms, uint32_t max_ms) {
+    return (int64_t)(min_ms + bot_random(bot) % (max_ms - min_ms + 1)) * 1000;
+}
+
+/**
+ * @brief Ein Button zur Zeit (keine Tastenkombinationen): meist schieben/drehen, selten Soft Drop
+ */
+static void bot_service(bot_t *bot, int64_t now) {
+    if (now < bot->next_us) return;
+
+    if (bot->held >= 0) {
+        controls_inject((button_id_t)bot->held, INPUT_EDGE_RELEASE);
+        bot->held = -1;
+        bot->next_us = now + bot_ms(bot, 40, 250);
+        return;
+    }
+
+    uint32_t r = bot_random(bot) % 10;
+    bot->held = (r < 3) ? BUTTON_LEFT : (r < 6) ? BUTTON_RIGHT : (r < 9) ? BUTTON_ROTATE : BUTTON_FASTER;
+    controls_inject((button_id_t)bot->held, INPUT_EDGE_PRESS);
+    bot->presses++;
+    bot->next_us = now + (bot->held == BUTTON_FASTER ? bot_ms(bot, 200, 600) : bot_ms(bot, 20, 120));
+}
+
+// ============================================================================
+// MAIN
+// ============================================================================
+
+static int64_t cpu_time_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static void usage(const char *prog) {
+    fprintf(stderr, "usage: %s [--seed N] [--bot N] [--seconds S] [--ppm PATH]\n", prog);
+}
+
+int main(int argc, char **argv) {
+    uint32_t seed = 1;
+    uint32_t bot_seed = 0;          // 0 → seed
+    uint32_t seconds = 600;
+    const char *ppm_path = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (i + 1 < argc && strcmp(argv[i], "--seed") == 0) {
+            seed = (uint32_t)strtoul(argv[++i], NULL, 0);
+        } else if (i + 1 < argc && strcmp(argv[i], "--bot") == 0) {
+            bot_seed = (uint32_t)strtoul(argv[++i], NULL, 0);
+        } else if (i + 1 < argc && strcmp(argv[i], "--seconds") == 0) {
+            seconds = (uint32_t)strtoul(argv[++i], NULL, 0);
+        } else if (i + 1 < argc && strcmp(argv[i], "--ppm") == 0) {
+            ppm_path = argv[++i];
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+
+    clock_use_virtual(0);
+    clock_seed_random(seed);
+
+    // Senken wie setup_frame_sinks(): Prüfsumme, Shared Memory, optional PPM
+    static frame_shared_t s_shared;
+    frame_sink_t *sink = NULL;
+    frame_sink_register(&s_hash_sink.base, true);
+    ESP_ERROR_CHECK(frame_sink_new_shared(&s_shared, &sink));
+    frame_sink_register(sink, true);
+    if (ppm_path != NULL) {
+        if (frame_sink_new_ppm(ppm_path, 8, &sink) != ESP_OK) return 1;
+        frame_sink_register(sink, true);
+    }
+
+    sim_platform_init();
+    game_loop_init();
+
+    if (bot_seed == 0) bot_seed = seed;
+    bot_t bot = { .state = bot_seed, .held = -1, .next_us = 0 };
+    const int64_t end_us = clock_now_us() + (int64_t)seconds * 1000000;
+    uint32_t steps = 0;
+    int64_t cpu_start = cpu_time_us();
+
+    while (clock_now_us() < end_us) {
+        int64_t now = clock_now_us();
+        bot_service(&bot, now);
+        host_timer_service(now);  // Button-Abtaster: injizierte Flanken in den Ring
+        game_loop_step();
+        steps++;
+
+        // Nichts geplant (scheduler_wait kehrt sofort zurück): wie der Abtaster weiterticken
+        if (clock_now_us() == now) {
+            clock_advance_us(BUTTON_SAMPLE_PERIOD_US);
+        }
+    }
+
+    int64_t cpu_us = cpu_time_us() - cpu_start;
+    const sim_platform_stats_t *stats = sim_platform_stats();
+
+    pixel_rgb_t last[COMPOSITOR_PIXELS];
+    uint32_t last_seq = frame_shared_read(&s_shared, last);
+
+    printf("\n[Sim] seed=%lu bot=%lu simulated=%lus steps=%lu presses=%lu\n",
+           (unsigned long)seed, (unsigned long)bot_seed,
+           (unsigned long)seconds, (unsigned long)steps, (unsigned long)bot.presses);
+    printf("[Sim] cpu=%lld us (%.1f us per simulated s, %.3f%% of real time on this host)\n",
+           (long long)cpu_us, (double)cpu_us / seconds, (double)cpu_us / ((double)seconds * 1e6) * 100.0);
+    printf("[Sim] games=%lu best=%lu total=%lu current=%d lines=%lu highscore=%lu\n",
+           (unsigned long)stats->games_over, (unsigned long)stats->best_score,
+           (unsigned long)stats->sum_score, score_get(),
+           (unsigned long)score_get_total_lines_cleared(), (unsigned long)score_get_highscore());
+    printf("[Sim] result frames=%lu hash=%08lx last_seq=%lu last_hash=%08lx\n",
+           (unsigned long)s_hash_sink.base.frames, (unsigned long)s_hash_sink.hash,
+           (unsigned long)last_seq, (unsigned long)fnv1a(FNV_OFFSET, last, sizeof(last)));
+
+    for (int i = frame_sink_count() - 1; i >= 0; i--) {
+        frame_sink_t *s = frame_sink_get(i);
+        if (s != &s_hash_sink.base) s->del(s);
+    }
+    return 0;
+}
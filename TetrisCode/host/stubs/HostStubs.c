@@ -0,0 +1,265 @@
+/**
+ * @file HostStubs.c
+ * @brief ESP-IDF/FreeRTOS Ersatz für den Host-Build (Simulation und Tests)
+ *
+ * Ein Thread, keine Tasks: alles, was auf dem Gerät blockieren würde, kehrt
+ * sofort zurück. esp_timer Callbacks laufen nur, wenn der Aufrufer
+ * host_timer_service() mit seiner Zeit aufruft, damit ein Lauf auf der
+ * virtuellen Uhr deterministisch bleibt. Semantik siehe HostStubs.h.
+ */
+
+#include "HostStubs.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "freertos/queue.h"
+#include "freertos/event_groups.h"
+#include "esp_timer.h"
+#include "esp_random.h"
+#include "esp_cpu.h"
+#include "esp_heap_caps.h"
+#include "esp_rom_sys.h"
+#include "driver/gpio.h"
+#include "nvs.h"
+#include "nvs_flash.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define HOST_TIMER_MAX 16
+
+static int64_t host_monotonic_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+// ============================================================================
+// ESP SYSTEM
+// ============================================================================
+
+const char *esp_err_to_name(esp_err_t code) {
+    switch (code) {
+        case ESP_OK:                return "ESP_OK";
+        case ESP_FAIL:              return "ESP_FAIL";
+        case ESP_ERR_NO_MEM:        return "ESP_ERR_NO_MEM";
+        case ESP_ERR_INVALID_ARG:   return "ESP_ERR_INVALID_ARG";
+        case ESP_ERR_INVALID_STATE: return "ESP_ERR_INVALID_STATE";
+        case ESP_ERR_NOT_FOUND:     return "ESP_ERR_NOT_FOUND";
+        case ESP_ERR_NOT_SUPPORTED: return "ESP_ERR_NOT_SUPPORTED";
+        default:                    return "ESP_ERR_UNKNOWN";
+    }
+}
+
+uint32_t esp_random(void) {
+    return (uint32_t)rand() ^ ((uint32_t)rand() << 16);
+}
+
+esp_cpu_cycle_count_t esp_cpu_get_cycle_count(void) {
+    return (esp_cpu_cycle_count_t)(host_monotonic_us() * CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ);
+}
+
+void esp_rom_delay_us(uint32_t us) {}
+
+size_t heap_caps_get_free_size(uint32_t caps) { return 256 * 1024; }
+size_t heap_caps_get_minimum_free_size(uint32_t caps) { return 256 * 1024; }
+size_t heap_caps_get_largest_free_block(uint32_t caps) { return 128 * 1024; }
+void *heap_caps_malloc(size_t size, uint32_t caps) { return malloc(size); }
+void *heap_caps_calloc(size_t n, size_t size, uint32_t caps) { return calloc(n, size); }
+void heap_caps_free(void *ptr) { free(ptr); }
+
+// ============================================================================
+// ESP_TIMER (nur über host_timer_service)
+// ============================================================================
+
+struct esp_timer {
+    esp_timer_cb_t callback;
+    void *arg;
+    bool active;
+    bool periodic;
+    uint64_t period_us;
+    int64_t due_us;
+    bool start_pending;         // Startzeit wird beim nächsten Service gesetzt
+};
+
+static struct esp_timer s_timers[HOST_TIMER_MAX];
+static int s_timer_count = 0;
+
+int64_t esp_timer_get_time(void) {
+    return host_monotonic_us();
+}
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t *args, esp_timer_handle_t *out) {
+    if (s_timer_count >= HOST_TIMER_MAX) return ESP_ERR_NO_MEM;
+    struct esp_timer *t = &s_timers[s_timer_count++];
+    t->callback = args->callback;
+    t->arg = args->arg;
+    *out = t;
+    return ESP_OK;
+}
+
+static esp_err_t host_timer_start(esp_timer_handle_t t, uint64_t us, bool periodic) {
+    t->active = true;
+    t->periodic = periodic;
+    t->period_us = us;
+    t->start_pending = true;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_start_once(esp_timer_handle_t t, uint64_t us) {
+    return host_timer_start(t, us, false);
+}
+
+esp_err_t esp_timer_start_periodic(esp_timer_handle_t t, uint64_t us) {
+    return host_timer_start(t, us, true);
+}
+
+esp_err_t esp_timer_restart(esp_timer_handle_t t, uint64_t us) {
+    return host_timer_start(t, us, t->periodic);
+}
+
+esp_err_t esp_timer_stop(esp_timer_handle_t t) {
+    if (!t->active) return ESP_ERR_INVALID_STATE;
+    t->active = false;
+    return ESP_OK;
+}
+
+bool esp_timer_is_active(esp_timer_handle_t t) {
+    return t->active;
+}
+
+void host_timer_service(int64_t now_us) {
+    for (int i = 0; i < s_timer_count; i++) {
+        struct esp_timer *t = &s_timers[i];
+        if (!t->active) continue;
+        if (t->start_pending) {
+            // Periodische Timer (Abtaster) laufen ab dem ersten Service, One-Shots nach Ablauf
+            t->due_us = t->periodic ? now_us : now_us + (int64_t)t->period_us;
+            t->start_pending = false;
+        }
+        if (now_us < t->due_us) continue;
+
+        if (t->periodic) {
+            t->due_us = now_us + (int64_t)t->period_us;
+        } else {
+            t->active = false;
+        }
+        t->callback(t->arg);
+    }
+}
+
+// ============================================================================
+// FREERTOS (ein Thread: nichts blockiert)
+// ============================================================================
+
+static uint32_t s_notify_bits = 0;
+static int s_task_handle;          // Einziger "Task": der Aufrufer
+
+TickType_t xTaskGetTickCount(void) {
+    return (TickType_t)(host_monotonic_us() / (portTICK_PERIOD_MS * 1000));
+}
+
+void vTaskDelay(TickType_t ticks) {}
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t stack, void *arg,
+                       UBaseType_t prio, TaskHandle_t *out) {
+    if (out) *out = NULL;
+    return pdPASS;  // Tasks laufen auf dem Host nicht
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stack, void *arg,
+                                   UBaseType_t prio, TaskHandle_t *out, BaseType_t core) {
+    return xTaskCreate(fn, name, stack, arg, prio, out);
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void) {
+    return &s_task_handle;
+}
+
+BaseType_t xPortGetCoreID(void) {
+    return 0;
+}
+
+BaseType_t xTaskNotifyWait(uint32_t clear_on_entry, uint32_t clear_on_exit, uint32_t *value, TickType_t timeout) {
+    s_notify_bits &= ~clear_on_entry;
+    uint32_t bits = s_notify_bits;
+    if (value) *value = bits;
+    s_notify_bits &= ~clear_on_exit;
+    return bits ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xTaskNotify(TaskHandle_t task, uint32_t value, eNotifyAction action) {
+    if (action == eSetBits) s_notify_bits |= value;
+    else if (action == eIncrement) s_notify_bits++;
+    return pdPASS;
+}
+
+BaseType_t xTaskNotifyFromISR(TaskHandle_t task, uint32_t value, eNotifyAction action, BaseType_t *woken) {
+    if (woken) *woken = pdFALSE;
+    return xTaskNotify(task, value, action);
+}
+
+// Semaphoren/Mutexe: ohne Nebenläufigkeit immer verfügbar
+SemaphoreHandle_t xSemaphoreCreateBinary(void) { return calloc(1, 1); }
+SemaphoreHandle_t xSemaphoreCreateMutex(void) { return calloc(1, 1); }
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t timeout) { return pdTRUE; }
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem) { return pdTRUE; }
+
+EventGroupHandle_t xEventGroupCreate(void) {
+    return calloc(1, sizeof(EventBits_t));
+}
+
+EventBits_t xEventGroupSetBits(EventGroupHandle_t group, EventBits_t bits) {
+    return *(EventBits_t *)group |= bits;
+}
+
+EventBits_t xEventGroupClearBits(EventGroupHandle_t group, EventBits_t bits) {
+    EventBits_t old = *(EventBits_t *)group;
+    *(EventBits_t *)group &= ~bits;
+    return old;
+}
+
+EventBits_t xEventGroupGetBits(EventGroupHandle_t group) {
+    return *(EventBits_t *)group;
+}
+
+EventBits_t xEventGroupWaitBits(EventGroupHandle_t group, EventBits_t bits, BaseType_t clear,
+                                BaseType_t all, TickType_t timeout) {
+    return *(EventBits_t *)group;
+}
+
+// ============================================================================
+// GPIO (Pegel vom Test/Simulator gesetzt, Standard 1 = Button losgelassen)
+// ============================================================================
+
+static int8_t s_gpio_level[GPIO_NUM_MAX];
+static bool s_gpio_level_init = false;
+
+void host_gpio_set_level(int gpio, int level) {
+    if (!s_gpio_level_init) {
+        for (int i = 0; i < GPIO_NUM_MAX; i++) s_gpio_level[i] = 1;
+        s_gpio_level_init = true;
+    }
+    if (gpio >= 0 && gpio < GPIO_NUM_MAX) s_gpio_level[gpio] = (int8_t)(level != 0);
+}
+
+esp_err_t gpio_config(const gpio_config_t *cfg) {
+    return ESP_OK;
+}
+
+int gpio_get_level(gpio_num_t gpio) {
+    if (!s_gpio_level_init || gpio < 0 || gpio >= GPIO_NUM_MAX) return 1;
+    return s_gpio_level[gpio];
+}
+
+// ============================================================================
+// NVS (leer, nichts wird gespeichert)
+// ============================================================================
+
+esp_err_t nvs_flash_init(void) { return ESP_OK; }
+esp_err_t nvs_flash_erase(void) { return ESP_OK; }
+esp_err_t nvs_open(const char *ns, int mode, nvs_handle_t *out) { *out = 1; return ESP_OK; }
+esp_err_t nvs_get_u32(nvs_handle_t h, const char *key, uint32_t *out) { return ESP_ERR_NVS_NOT_FOUND; }
+esp_err_t nvs_set_u32(nvs_handle_t h, const char *key, uint32_t value) { return ESP_OK; }
+esp_err_t nvs_commit(nvs_handle_t h) { return ESP_OK; }
+void nvs_close(nvs_handle_t h) {}
@@ -0,0 +1,23 @@
+#ifndef HOST_STUBS_H
+#define HOST_STUBS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// HOST STUBS - ESP-IDF/FreeRTOS Ersatz für den Host-Build (ein Thread, keine echten Tasks)
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// - Tasks werden nicht gestartet, Semaphoren/Mutexe gelingen immer
+// - Task-Notifications sammeln Bits, xTaskNotifyWait() liefert sie sofort (schläft nie)
+// - esp_timer Callbacks laufen nur über host_timer_service(), mit der Zeit des Aufrufers
+//   (Simulation: virtuelle Uhr) → deterministisch
+// - GPIO-Pegel sind 1 (Buttons losgelassen) bis host_gpio_set_level()
+// - NVS ist leer (ESP_ERR_NVS_NOT_FOUND)
+
+// Fällige esp_timer Callbacks ausführen (jeder Timer höchstens einmal pro Aufruf)
+void host_timer_service(int64_t now_us);
+
+// Pegel eines GPIO setzen (gpio_get_level() liefert ihn ab sofort)
+void host_gpio_set_level(int gpio, int level);
+
+#endif // HOST_STUBS_H
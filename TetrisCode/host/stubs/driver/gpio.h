@@ -0,0 +1,12 @@
+#pragma once
+#include <stdint.h>
+#include "esp_err.h"
+typedef enum { GPIO_NUM_1=1, GPIO_NUM_4=4, GPIO_NUM_5=5, GPIO_NUM_6=6, GPIO_NUM_7=7, GPIO_NUM_14=14, GPIO_NUM_20=20, GPIO_NUM_21=21, GPIO_NUM_2=2, GPIO_NUM_3=3, GPIO_NUM_8=8, GPIO_NUM_9=9, GPIO_NUM_10=10, GPIO_NUM_11=11, GPIO_NUM_12=12, GPIO_NUM_13=13, GPIO_NUM_15=15, GPIO_NUM_16=16, GPIO_NUM_MAX=49, GPIO_NUM_NC=-1 } gpio_num_t;
+typedef enum { GPIO_MODE_INPUT } gpio_mode_t;
+typedef enum { GPIO_PULLUP_ENABLE=1 } gpio_pullup_t; typedef enum { GPIO_PULLDOWN_DISABLE=0 } gpio_pulldown_t;
+typedef enum { GPIO_INTR_DISABLE, GPIO_INTR_NEGEDGE, GPIO_INTR_ANYEDGE } gpio_int_type_t;
+typedef struct { uint64_t pin_bit_mask; gpio_mode_t mode; gpio_pullup_t pull_up_en; gpio_pulldown_t pull_down_en; gpio_int_type_t intr_type; } gpio_config_t;
+esp_err_t gpio_config(const gpio_config_t*); int gpio_get_level(gpio_num_t);
+typedef void (*gpio_isr_t)(void*);
+esp_err_t gpio_install_isr_service(int); esp_err_t gpio_isr_handler_add(gpio_num_t, gpio_isr_t, void*); esp_err_t gpio_isr_handler_remove(gpio_num_t);
+esp_err_t gpio_intr_enable(gpio_num_t); esp_err_t gpio_intr_disable(gpio_num_t);
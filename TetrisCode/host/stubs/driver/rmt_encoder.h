@@ -0,0 +1,13 @@
+#pragma once
+#include "driver/rmt_types.h"
+#define RMT_ENCODER_FUNC_ATTR
+typedef struct { struct { uint32_t msb_first:1; } flags; rmt_symbol_word_t bit0; rmt_symbol_word_t bit1; } rmt_bytes_encoder_config_t;
+typedef struct { int dummy; } rmt_copy_encoder_config_t;
+esp_err_t rmt_new_copy_encoder(const rmt_copy_encoder_config_t*, rmt_encoder_handle_t*);
+esp_err_t rmt_new_bytes_encoder(const rmt_bytes_encoder_config_t*, rmt_encoder_handle_t*);
+esp_err_t rmt_del_encoder(rmt_encoder_handle_t); esp_err_t rmt_encoder_reset(rmt_encoder_handle_t);
+void *rmt_alloc_encoder_mem(size_t);
+#include <stdlib.h>
+typedef size_t (*rmt_encode_simple_cb_t)(const void *data, size_t data_size, size_t symbols_written, size_t symbols_free, rmt_symbol_word_t *symbols, bool *done, void *arg);
+typedef struct { rmt_encode_simple_cb_t callback; void *arg; size_t min_chunk_size; } rmt_simple_encoder_config_t;
+esp_err_t rmt_new_simple_encoder(const rmt_simple_encoder_config_t*, rmt_encoder_handle_t*);
@@ -0,0 +1,16 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "esp_err.h"
+typedef struct rmt_channel_t *rmt_channel_handle_t;
+typedef struct rmt_encoder_t rmt_encoder_t; typedef rmt_encoder_t *rmt_encoder_handle_t;
+typedef enum { RMT_ENCODING_RESET = 0, RMT_ENCODING_COMPLETE = 1, RMT_ENCODING_MEM_FULL = 2 } rmt_encode_state_t;
+typedef union { struct { uint16_t duration0 : 15; uint16_t level0 : 1; uint16_t duration1 : 15; uint16_t level1 : 1; }; uint32_t val; } rmt_symbol_word_t;
+struct rmt_encoder_t { size_t (*encode)(rmt_encoder_t*, rmt_channel_handle_t, const void*, size_t, rmt_encode_state_t*); esp_err_t (*reset)(rmt_encoder_t*); esp_err_t (*del)(rmt_encoder_t*); };
+typedef int rmt_clock_source_t;
+#define RMT_CLK_SRC_DEFAULT 1
+typedef struct { void *user_ctx; } rmt_tx_done_event_data_t_dummy;
+typedef struct { size_t num_symbols; } rmt_tx_done_event_data_t;
+typedef bool (*rmt_tx_done_callback_t)(rmt_channel_handle_t, const rmt_tx_done_event_data_t*, void*);
+typedef struct { rmt_tx_done_callback_t on_trans_done; } rmt_tx_event_callbacks_t;
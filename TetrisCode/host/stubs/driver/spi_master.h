@@ -0,0 +1,18 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+typedef enum { SPI1_HOST=0, SPI2_HOST=1, SPI3_HOST=2 } spi_host_device_t;
+typedef int spi_clock_source_t;
+#define SPI_CLK_SRC_DEFAULT 0
+typedef enum { SPI_DMA_DISABLED=0, SPI_DMA_CH_AUTO=3 } spi_dma_chan_t;
+typedef struct spi_device_t *spi_device_handle_t;
+typedef struct { int mosi_io_num, miso_io_num, sclk_io_num, quadwp_io_num, quadhd_io_num; int max_transfer_sz; } spi_bus_config_t;
+typedef struct { spi_clock_source_t clock_source; uint8_t command_bits, address_bits, dummy_bits, mode; int clock_speed_hz; int spics_io_num; int queue_size; } spi_device_interface_config_t;
+typedef struct { size_t length; const void *tx_buffer; void *rx_buffer; } spi_transaction_t;
+esp_err_t spi_bus_initialize(spi_host_device_t, const spi_bus_config_t*, spi_dma_chan_t);
+esp_err_t spi_bus_free(spi_host_device_t);
+esp_err_t spi_bus_add_device(spi_host_device_t, const spi_device_interface_config_t*, spi_device_handle_t*);
+esp_err_t spi_bus_remove_device(spi_device_handle_t);
+esp_err_t spi_device_transmit(spi_device_handle_t, spi_transaction_t*);
+esp_err_t spi_device_get_actual_freq(spi_device_handle_t, int*);
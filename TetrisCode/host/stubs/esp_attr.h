@@ -0,0 +1,3 @@
+#pragma once
+#define DRAM_ATTR
+#define IRAM_ATTR
@@ -0,0 +1,14 @@
+#pragma once
+#include <stddef.h>
+#include "esp_err.h"
+typedef int (*esp_console_cmd_func_t)(int argc, char **argv);
+typedef struct { const char *command; const char *help; const char *hint; esp_console_cmd_func_t func; void *argtable; } esp_console_cmd_t;
+typedef struct esp_console_repl_s esp_console_repl_t;
+typedef struct { size_t max_history_len; const char *history_save_path; unsigned task_stack_size; unsigned task_priority; const char *prompt; size_t max_cmdline_length; int task_core_id; } esp_console_repl_config_t;
+#define ESP_CONSOLE_REPL_CONFIG_DEFAULT() { 32, NULL, 4096, 2, NULL, 0 }
+typedef struct { int channel; int baud_rate; int tx_gpio_num; int rx_gpio_num; } esp_console_dev_uart_config_t;
+#define ESP_CONSOLE_DEV_UART_CONFIG_DEFAULT() { 0, 115200, -1, -1 }
+esp_err_t esp_console_cmd_register(const esp_console_cmd_t *cmd);
+esp_err_t esp_console_register_help_command(void);
+esp_err_t esp_console_new_repl_uart(const esp_console_dev_uart_config_t *, const esp_console_repl_config_t *, esp_console_repl_t **);
+esp_err_t esp_console_start_repl(esp_console_repl_t *);
@@ -0,0 +1,6 @@
+#pragma once
+#include <stdio.h>
+#define ESP_LOGI(tag, fmt, ...) printf(fmt, ##__VA_ARGS__)
+#define ESP_LOGW(tag, fmt, ...) printf(fmt, ##__VA_ARGS__)
+#define ESP_LOGE(tag, fmt, ...) printf(fmt, ##__VA_ARGS__)
+#define ESP_LOGD(tag, fmt, ...) printf(fmt, ##__VA_ARGS__)
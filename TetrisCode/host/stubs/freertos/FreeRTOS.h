@@ -0,0 +1,30 @@
+#pragma once
+// Host-Stub: Typen und Makros von FreeRTOS (Semantik siehe HostStubs.c)
+#include "sdkconfig.h"
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+typedef uint32_t TickType_t; typedef int BaseType_t; typedef unsigned UBaseType_t;
+typedef void *TaskHandle_t; typedef void *QueueHandle_t; typedef void *SemaphoreHandle_t; typedef void *EventGroupHandle_t; typedef uint32_t EventBits_t;
+typedef void (*TaskFunction_t)(void*);
+typedef int portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED 0
+#define portENTER_CRITICAL(m) (void)(m)
+#define portEXIT_CRITICAL(m) (void)(m)
+#define portENTER_CRITICAL_ISR(m) (void)(m)
+#define portEXIT_CRITICAL_ISR(m) (void)(m)
+#define pdMS_TO_TICKS(x) ((TickType_t)(((uint64_t)(x) * configTICK_RATE_HZ) / 1000))
+#define portTICK_PERIOD_MS (1000 / configTICK_RATE_HZ)
+#define portMAX_DELAY 0xffffffffu
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS 1
+#define configTICK_RATE_HZ CONFIG_FREERTOS_HZ
+#define portNUM_PROCESSORS 2
+#define configMAX_PRIORITIES 25
+#define tskNO_AFFINITY 0x7fffffff
+#define IRAM_ATTR
+#define portYIELD_FROM_ISR(...) 
+#define configSTACK_DEPTH_TYPE uint32_t
+#define configRUN_TIME_COUNTER_TYPE uint32_t
+#define configMAX_TASK_NAME_LEN 16
@@ -0,0 +1,20 @@
+#pragma once
+#include "FreeRTOS.h"
+TickType_t xTaskGetTickCount(void); void vTaskDelay(TickType_t);
+BaseType_t xTaskCreate(TaskFunction_t, const char*, uint32_t, void*, UBaseType_t, TaskHandle_t*);
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t, const char*, uint32_t, void*, UBaseType_t, TaskHandle_t*, BaseType_t);
+TaskHandle_t xTaskGetCurrentTaskHandle(void);
+BaseType_t xTaskNotifyWait(uint32_t, uint32_t, uint32_t*, TickType_t);
+typedef enum { eNoAction, eSetBits, eIncrement } eNotifyAction;
+BaseType_t xTaskNotify(TaskHandle_t, uint32_t, eNotifyAction);
+BaseType_t xTaskNotifyFromISR(TaskHandle_t, uint32_t, eNotifyAction, BaseType_t*);
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t);
+typedef enum { eRunning, eReady, eBlocked, eSuspended, eDeleted } eTaskState;
+typedef struct { TaskHandle_t xHandle; const char *pcTaskName; UBaseType_t xTaskNumber; eTaskState eCurrentState; UBaseType_t uxCurrentPriority; UBaseType_t uxBasePriority; uint32_t ulRunTimeCounter; void *pxStackBase; configSTACK_DEPTH_TYPE usStackHighWaterMark; BaseType_t xCoreID; } TaskStatus_t;
+UBaseType_t uxTaskGetNumberOfTasks(void);
+UBaseType_t uxTaskGetSystemState(TaskStatus_t*, UBaseType_t, configRUN_TIME_COUNTER_TYPE*);
+BaseType_t xPortGetCoreID(void);
+void vTaskDelete(TaskHandle_t);
+const char *pcTaskGetName(TaskHandle_t);
+void vTaskSuspendAll(void); BaseType_t xTaskResumeAll(void);
+UBaseType_t uxTaskPriorityGet(TaskHandle_t);
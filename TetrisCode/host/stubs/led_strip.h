@@ -0,0 +1,14 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+typedef struct led_strip_t *led_strip_handle_t;
+typedef struct { int strip_gpio_num; uint32_t max_leds; int led_model; struct { uint32_t invert_out:1; } flags; } led_strip_config_t;
+typedef struct { int clk_src; uint32_t resolution_hz; size_t mem_block_symbols; struct { uint32_t with_dma:1; } flags; } led_strip_rmt_config_t;
+esp_err_t led_strip_new_rmt_device(const led_strip_config_t*, const led_strip_rmt_config_t*, led_strip_handle_t*);
+esp_err_t led_strip_set_pixel(led_strip_handle_t, uint32_t, uint32_t, uint32_t, uint32_t);
+esp_err_t led_strip_refresh(led_strip_handle_t); esp_err_t led_strip_clear(led_strip_handle_t);
+esp_err_t led_strip_del(led_strip_handle_t);
+#include "driver/spi_master.h"
+typedef struct { spi_clock_source_t clk_src; spi_host_device_t spi_bus; struct { uint32_t with_dma:1; } flags; } led_strip_spi_config_t;
+esp_err_t led_strip_new_spi_device(const led_strip_config_t*, const led_strip_spi_config_t*, led_strip_handle_t*);
@@ -0,0 +1,10 @@
+#pragma once
+#include "led_strip.h"
+typedef struct led_strip_t led_strip_t;
+struct led_strip_t {
+    esp_err_t (*set_pixel)(led_strip_t *strip, uint32_t index, uint32_t red, uint32_t green, uint32_t blue);
+    esp_err_t (*set_pixel_rgbw)(led_strip_t *strip, uint32_t index, uint32_t red, uint32_t green, uint32_t blue, uint32_t white);
+    esp_err_t (*refresh)(led_strip_t *strip);
+    esp_err_t (*clear)(led_strip_t *strip);
+    esp_err_t (*del)(led_strip_t *strip);
+};
@@ -0,0 +1,3 @@
+#pragma once
+// Host-Stub: nur der Typ für DisplayInit.h (Display selbst ist sim/SimPlatform.c)
+typedef struct _lv_disp_t lv_disp_t;
@@ -0,0 +1,13 @@
+#pragma once
+// Host-Build (CMakeLists.txt in host/): feste Auswahl statt menuconfig
+#define CONFIG_IDF_TARGET_LINUX 1
+#define CONFIG_FREERTOS_HZ 100
+#define CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ 160
+#define CONFIG_TETRIS_TOPOLOGY_SPLIT 1
+#define CONFIG_TETRIS_LED_DRIVER_LUT 1
+#define CONFIG_TETRIS_POSTPROCESS 1
+#define CONFIG_TETRIS_CURRENT_LIMIT 1
+#define CONFIG_TETRIS_SINK_SHARED 1
+#define CONFIG_TETRIS_CLOCK_VIRTUAL 1
+#define CONFIG_TETRIS_CLOCK_VIRTUAL_SEED 1
+#define CONFIG_TETRIS_PROFILER 1
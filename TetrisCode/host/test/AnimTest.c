@@ -0,0 +1,329 @@
+/**
+ * @file AnimTest.c
+ * @brief Sprite-Dekodierung, Überblendung und Zeitplan der Animationen (Anim.c, AnimClips.c)
+ *
+ * Gezeichnet wird in LAYER_OVERLAY über eine Referenzfarbe in LAYER_LOCKED,
+ * damit transparente und freigegebene Pixel von schwarzen unterscheidbar
+ * sind. Gelesen wird der präsentierte Frame (Capture-Senke, Helligkeit 255,
+ * ohne Dithering). Die Clips laufen auf der virtuellen Uhr in 1 ms Schritten:
+ * neu gezeichnet werden darf nur ab anim_next_us(), und dort muss sich auch
+ * etwas ändern.
+ */
+
+#include "HostTest.h"
+#include "CaptureSink.h"
+#include "Anim.h"
+#include "AnimClips.h"
+#include "Clock.h"
+#include "Compositor.h"
+#include "PostProcess.h"
+#include "Globals.h"
+#include <string.h>
+
+static const pixel_rgb_t s_under = { 0, 0, 40 };    // LAYER_LOCKED unter allem, dunkel genug fürs Stromlimit
+
+static uint8_t expected_channel(uint8_t design) {
+    return (uint8_t)((post_lut()[design] + 0x80) >> 8);  // Wie post_process_frame ohne Dithering
+}
+
+static bool pixel_is(int y, int x, pixel_rgb_t design) {
+    const pixel_rgb_t *c = captured(y, x);
+    return c->r == expected_channel(design.r) && c->g == expected_channel(design.g) &&
+           c->b == expected_channel(design.b);
+}
+
+static void check_pixel(int line, int y, int x, pixel_rgb_t design) {
+    if (!pixel_is(y, x, design)) {
+        const pixel_rgb_t *c = captured(y, x);
+        printf("FAIL line %d: pixel (%d,%d) is %02x%02x%02x, expected design %02x%02x%02x\n",
+               line, y, x, c->r, c->g, c->b, design.r, design.g, design.b);
+        host_test_failures++;
+    }
+}
+
+#define CHECK_PIXEL(y, x, c) check_pixel(__LINE__, y, x, c)
+
+static void reset_scene(void) {
+    compositor_reset();
+    for (int y = 0; y < LED_HEIGHT; y++) {
+        for (int x = 0; x < LED_WIDTH; x++) {
+            compositor_set(LAYER_LOCKED, y, x, s_under.r, s_under.g, s_under.b);
+        }
+    }
+    compositor_commit();
+    compositor_present();
+}
+
+static bool advance_and_present(anim_player_t *p, int64_t now_us) {
+    bool changed = anim_advance(p, now_us);
+    if (changed) {
+        compositor_commit();
+        compositor_present();
+    }
+    return changed;
+}
+
+// ============================================================================
+// DEKODIERUNG
+// ============================================================================
+
+// 3x3 Sprite, transparente und deckende Läufe über Zeilengrenzen:
+//   1 . .
+//   . . 2
+//   2 . 3
+static const pixel_rgb_t s_decode_palette[] = { { 200, 0, 0 }, { 0, 200, 0 }, { 200, 200, 0 } };
+static const uint8_t s_decode_rle[] = {
+    ANIM_RUN(1, 1), ANIM_RUN(4, 0), ANIM_RUN(2, 2), ANIM_RUN(1, 0), ANIM_RUN(1, 3),
+};
+static const anim_sprite_t s_decode_sprite = { 3, 3, s_decode_rle, sizeof(s_decode_rle), s_decode_palette };
+static const anim_key_t s_decode_keys[] = { { .sprite = &s_decode_sprite, .hold_ms = 10 } };
+static const anim_clip_t s_decode_clip = { s_decode_keys, 1, 1, true };
+
+static void draw_sprite_at(anim_player_t *p, int y, int x) {
+    reset_scene();
+    anim_start(p, &s_decode_clip, LAYER_OVERLAY, y, x, clock_now_us());
+    CHECK(advance_and_present(p, clock_now_us()));
+}
+
+static void test_decode(void) {
+    anim_player_t p;
+    memset(&p, 0, sizeof(p));
+    const pixel_rgb_t *pal = s_decode_palette;
+
+    draw_sprite_at(&p, 4, 5);
+    CHECK_PIXEL(4, 5, pal[0]);
+    CHECK_PIXEL(4, 6, s_under);         // Transparent: darunterliegende Ebene
+    CHECK_PIXEL(4, 7, s_under);
+    CHECK_PIXEL(5, 5, s_under);         // Lauf über die Zeilengrenze
+    CHECK_PIXEL(5, 6, s_under);
+    CHECK_PIXEL(5, 7, pal[1]);
+    CHECK_PIXEL(6, 5, pal[1]);
+    CHECK_PIXEL(6, 6, s_under);
+    CHECK_PIXEL(6, 7, pal[2]);
+    CHECK_EQ(captured_changed_count(), 4);  // Nur die deckenden Pixel
+
+    // Negativer Versatz: nur die rechte Spalte ab Zeile 1 ist im Feld, die linke Spalte
+    // (Zeile 2 bei x = -2) landet nicht am Ende der Zeile davor
+    draw_sprite_at(&p, -1, -2);
+    CHECK_PIXEL(0, 0, pal[1]);
+    CHECK_PIXEL(1, 0, pal[2]);
+    CHECK_PIXEL(0, LED_WIDTH - 1, s_under);
+    CHECK_PIXEL(0, LED_WIDTH - 2, s_under);
+    CHECK_PIXEL(LED_HEIGHT - 1, LED_WIDTH - 1, s_under);
+    CHECK_EQ(captured_changed_count(), 2);
+
+    // Rechts/unten abgeschnitten: nur die linke obere Zelle im Feld
+    draw_sprite_at(&p, LED_HEIGHT - 1, LED_WIDTH - 1);
+    CHECK_PIXEL(LED_HEIGHT - 1, LED_WIDTH - 1, pal[0]);
+    CHECK_PIXEL(0, 0, s_under);
+    CHECK_PIXEL(0, 1, s_under);
+    CHECK_EQ(captured_changed_count(), 1);
+
+    // Ganz außerhalb: nichts gezeichnet
+    reset_scene();
+    anim_start(&p, &s_decode_clip, LAYER_OVERLAY, -3, 4, clock_now_us());
+    advance_and_present(&p, clock_now_us());
+    CHECK_EQ(captured_changed_count(), 0);
+    anim_stop(&p);
+}
+
+// ============================================================================
+// ÜBERBLENDUNG UND BEWEGUNG
+// ============================================================================
+
+static const pixel_rgb_t s_red[] = { { 240, 0, 0 } };
+static const pixel_rgb_t s_green[] = { { 0, 160, 40 } };
+static const uint8_t s_dot_rle[] = { ANIM_RUN(1, 1) };
+static const anim_sprite_t s_red_dot = { 1, 1, s_dot_rle, sizeof(s_dot_rle), s_red };
+static const anim_sprite_t s_green_dot = { 1, 1, s_dot_rle, sizeof(s_dot_rle), s_green };
+
+#define BLEND_MS 80
+static const anim_key_t s_blend_keys[] = {
+    { .sprite = &s_red_dot,   .hold_ms = 100, .blend_ms = BLEND_MS },  // Erster Durchlauf: von schwarz
+    { .sprite = &s_green_dot, .hold_ms = 100, .blend_ms = BLEND_MS },
+};
+static const anim_clip_t s_blend_clip = { s_blend_keys, 2, 1, true };
+
+// Gewicht springt nur im Render-Takt ab Keyframe-Start
+static pixel_rgb_t blended(pixel_rgb_t a, pixel_rgb_t b, int64_t e_us) {
+    int64_t step_us = RENDER_INTERVAL_MS * 1000;
+    uint16_t w = (uint16_t)((e_us - e_us % step_us) * 256 / (BLEND_MS * 1000));
+    return (pixel_rgb_t){ (uint8_t)((a.r * (256 - w) + b.r * w) >> 8),
+                          (uint8_t)((a.g * (256 - w) + b.g * w) >> 8),
+                          (uint8_t)((a.b * (256 - w) + b.b * w) >> 8) };
+}
+
+static void test_blend(void) {
+    const pixel_rgb_t black = { 0, 0, 0 };
+    anim_player_t p;
+    memset(&p, 0, sizeof(p));
+    reset_scene();
+
+    int64_t t0 = clock_now_us();
+    anim_start(&p, &s_blend_clip, LAYER_OVERLAY, 3, 3, t0);
+
+    CHECK(advance_and_present(&p, t0));
+    CHECK_PIXEL(3, 3, black);                               // Gewicht 0: noch schwarz, nicht transparent
+    CHECK_EQ(anim_next_us(&p), t0 + RENDER_INTERVAL_MS * 1000);  // Überblenden im Render-Takt
+
+    CHECK(advance_and_present(&p, t0 + 16000));
+    CHECK_PIXEL(3, 3, blended(black, s_red[0], 16000));
+    CHECK(!advance_and_present(&p, t0 + 20000));             // Zwischen zwei Schritten: kein Neuzeichnen
+    CHECK_EQ(anim_next_us(&p), t0 + 32000);
+    CHECK(advance_and_present(&p, t0 + 40000));
+    CHECK_PIXEL(3, 3, blended(black, s_red[0], 40000));
+    CHECK_EQ(anim_next_us(&p), t0 + 48000);
+    CHECK(advance_and_present(&p, t0 + BLEND_MS * 1000));
+    CHECK_PIXEL(3, 3, s_red[0]);
+    CHECK_EQ(anim_next_us(&p), t0 + 100000);                // Danach erst am Keyframe-Ende
+    CHECK(!advance_and_present(&p, t0 + 99999));
+
+    // Zweiter Keyframe blendet vom ersten
+    int64_t t1 = t0 + 100000;
+    CHECK(advance_and_present(&p, t1));
+    CHECK_PIXEL(3, 3, s_red[0]);
+    CHECK(advance_and_present(&p, t1 + 20000));
+    CHECK_PIXEL(3, 3, blended(s_red[0], s_green[0], 20000));
+    CHECK(advance_and_present(&p, t1 + 60000));
+    CHECK_PIXEL(3, 3, blended(s_red[0], s_green[0], 60000));
+
+    // Ende mit hold_last: letzter Keyframe bleibt stehen
+    CHECK(advance_and_present(&p, t1 + 100000));
+    CHECK(!anim_running(&p));
+    CHECK_EQ(anim_next_us(&p), INT64_MAX);
+    CHECK_PIXEL(3, 3, s_green[0]);
+    anim_stop(&p);
+}
+
+// Punkt läuft in 100 ms fünf Zellen nach rechts und drei nach oben
+static const anim_key_t s_move_keys[] = {
+    { .sprite = &s_red_dot, .hold_ms = 100, .y0 = 0, .x0 = 0, .y1 = -3, .x1 = 5 },
+};
+static const anim_clip_t s_move_clip = { s_move_keys, 1, 1, false };
+
+static void test_move_timing(void) {
+    anim_player_t p;
+    memset(&p, 0, sizeof(p));
+    reset_scene();
+
+    int64_t t0 = clock_now_us();
+    anim_start(&p, &s_move_clip, LAYER_OVERLAY, 10, 2, t0);
+    CHECK(advance_and_present(&p, t0));
+    CHECK_PIXEL(10, 2, s_red[0]);
+
+    // Zellgrenzen: x alle 20 ms, y alle 33.3 ms (aufgerundet auf ganze µs)
+    static const int64_t expected_us[] = { 20000, 33334, 40000, 60000, 66667, 80000, 100000 };
+    for (size_t k = 0; k < sizeof(expected_us) / sizeof(expected_us[0]); k++) {
+        int64_t next = anim_next_us(&p);
+        CHECK_EQ(next - t0, expected_us[k]);
+        CHECK(!advance_and_present(&p, next - 1));
+        CHECK(advance_and_present(&p, next));
+
+        int64_t e = next - t0;
+        if (anim_running(&p)) CHECK_PIXEL(10 - (int)(3 * e / 100000), 2 + (int)(5 * e / 100000), s_red[0]);
+    }
+
+    // Ohne hold_last wird die Fläche freigegeben
+    CHECK(!anim_running(&p));
+    CHECK_PIXEL(7, 7, s_under);
+    CHECK_PIXEL(10, 2, s_under);
+}
+
+// ============================================================================
+// CLIPS AUF DER VIRTUELLEN UHR
+// ============================================================================
+
+/**
+ * @brief Clip in 1 ms Schritten abspielen, Zeichnen nur zu anim_next_us()
+ * @return Laufzeit bis zum Ende (µs)
+ */
+static int64_t play_clip(anim_player_t *p, const anim_clip_t *clip, int y, int x, int *redraws) {
+    int64_t t0 = clock_now_us();
+    anim_start(p, clip, LAYER_OVERLAY, y, x, t0);
+    CHECK(advance_and_present(p, t0));
+    *redraws = 1;
+
+    int64_t next = anim_next_us(p);
+    while (anim_running(p) && clock_now_us() - t0 < 60 * 1000000LL) {
+        clock_advance_us(1000);
+        int64_t now = clock_now_us();
+        bool changed = advance_and_present(p, now);
+        if (changed) (*redraws)++;
+
+        if (now < next && changed) {
+            printf("FAIL redraw at +%lld us before anim_next_us +%lld us\n",
+                   (long long)(now - t0), (long long)(next - t0));
+            host_test_failures++;
+        }
+        if (now == next && !changed && anim_running(p)) {     // Ende mit hold_last: evtl. nichts neu
+            printf("FAIL no redraw at anim_next_us +%lld us\n", (long long)(now - t0));
+            host_test_failures++;
+        }
+        if (now >= next) next = anim_next_us(p);
+    }
+    return clock_now_us() - t0;
+}
+
+static void test_line_clear(void) {
+    const pixel_rgb_t blink = { LINE_CLEAR_BLINK_R, LINE_CLEAR_BLINK_G, LINE_CLEAR_BLINK_B };
+    anim_player_t p;
+    memset(&p, 0, sizeof(p));
+    reset_scene();
+
+    int row = LED_HEIGHT - 2;
+    int64_t t0 = clock_now_us();
+    anim_start(&p, &anim_clip_line_clear, LAYER_OVERLAY, row, 0, t0);
+    CHECK(advance_and_present(&p, t0));
+    for (int x = 0; x < LED_WIDTH; x++) CHECK_PIXEL(row, x, blink);
+    CHECK_PIXEL(row - 1, 0, s_under);
+    CHECK(advance_and_present(&p, t0 + LINE_CLEAR_BLINK_ON_MS * 1000));
+    CHECK_PIXEL(row, 0, s_under);       // Aus: fixierte Blöcke scheinen durch
+    anim_stop(&p);
+
+    reset_scene();
+    int redraws = 0;
+    int64_t duration = play_clip(&p, &anim_clip_line_clear, row, 0, &redraws);
+    CHECK_EQ(duration, (int64_t)LINE_CLEAR_BLINK_TIMES * (LINE_CLEAR_BLINK_ON_MS + LINE_CLEAR_BLINK_OFF_MS) * 1000);
+    CHECK_EQ(redraws, 2 * LINE_CLEAR_BLINK_TIMES + 1);  // Ein/Aus pro Durchlauf, dann die Freigabe
+
+    // hold_last=false: Reihe wieder frei
+    for (int x = 0; x < LED_WIDTH; x++) CHECK_PIXEL(row, x, s_under);
+}
+
+static void test_game_over(void) {
+    const pixel_rgb_t black = { 0, 0, 0 };
+    anim_player_t p;
+    memset(&p, 0, sizeof(p));
+    reset_scene();
+
+    int redraws = 0;
+    int64_t duration = play_clip(&p, &anim_clip_game_over, 0, 0, &redraws);
+    CHECK_EQ(duration, (int64_t)GAME_OVER_BLINK_COUNT * (GAME_OVER_BLINK_ON_MS + GAME_OVER_BLINK_OFF_MS) * 1000);
+
+    // Pro Keyframe: Überblend-Schritte im Render-Takt plus das Keyframe-Ende
+    int fade_steps = (GAME_OVER_BLINK_FADE_MS + RENDER_INTERVAL_MS - 1) / RENDER_INTERVAL_MS;
+    CHECK(redraws <= 2 * GAME_OVER_BLINK_COUNT * (fade_steps + 1) + 1);
+
+    // hold_last=true: schwarz deckt das Spielfeld bis zum Splash
+    CHECK_PIXEL(0, 0, black);
+    CHECK_PIXEL(LED_HEIGHT - 1, LED_WIDTH - 1, black);
+    anim_stop(&p);
+    compositor_commit();
+    compositor_present();
+    CHECK_PIXEL(0, 0, s_under);
+}
+
+int main(void) {
+    clock_use_virtual(0);
+    compositor_init();
+    post_set_brightness(255);
+    post_set_dither(false);
+    capture_sink_register();
+
+    test_decode();
+    test_blend();
+    test_move_timing();
+    test_line_clear();
+    test_game_over();
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,55 @@
+#ifndef CAPTURE_SINK_H
+#define CAPTURE_SINK_H
+
+#include <string.h>
+#include "FrameSink.h"
+#include "esp_check.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// CAPTURE SINK - Frame-Senke für Host-Tests: letzter präsentierter Frame und seine Änderungsmaske
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// capture_sink_register() einmal nach compositor_init(); die erste Übergabe kommt mit voller
+// Maske (frisch registrierte Senke). Danach enthält s_capture nach jedem compositor_present()
+// den Frame, die übergebenen Änderungs-Bits und die Anzahl der Übergaben.
+
+typedef struct {
+    frame_sink_t base;
+    pixel_rgb_t frame[COMPOSITOR_PIXELS];
+    uint32_t changed[COMPOSITOR_MASK_WORDS];
+    uint32_t presents;
+} sink_capture_t;
+
+static esp_err_t capture_present(frame_sink_t *base, const pixel_rgb_t *frame, const uint32_t *changed) {
+    sink_capture_t *sink = __containerof(base, sink_capture_t, base);
+    memcpy(sink->frame, frame, sizeof(sink->frame));
+    memcpy(sink->changed, changed, sizeof(sink->changed));
+    sink->presents++;
+    return ESP_OK;
+}
+
+static void capture_del(frame_sink_t *base) {}
+
+static sink_capture_t s_capture = {
+    .base = { .name = "capture", .present = capture_present, .del = capture_del },
+};
+
+static inline void capture_sink_register(void) {
+    frame_sink_register(&s_capture.base, true);
+}
+
+static inline const pixel_rgb_t *captured(int y, int x) {
+    return &s_capture.frame[y * LED_WIDTH + x];
+}
+
+static inline bool captured_changed(int i) {
+    return (s_capture.changed[i >> 5] >> (i & 31)) & 1;
+}
+
+// Anzahl der Pixel mit Änderungs-Bit in der letzten Übergabe
+static inline int captured_changed_count(void) {
+    int n = 0;
+    for (int w = 0; w < COMPOSITOR_MASK_WORDS; w++) n += __builtin_popcount(s_capture.changed[w]);
+    return n;
+}
+
+#endif // CAPTURE_SINK_H
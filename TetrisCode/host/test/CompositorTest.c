@@ -0,0 +1,160 @@
+/**
+ * @file CompositorTest.c
+ * @brief Ebenen, Dirty-Masken und Änderungsmaske des Compositors über die Capture-Senke
+ *
+ * Die Nachbearbeitung läuft mit Helligkeit 255 ohne Dithering; erwartete
+ * Werte werden mit post_lut() aus den Design-Farben berechnet. Es sind nur
+ * wenige Pixel an, das Stromlimit greift also nie.
+ */
+
+#include "HostTest.h"
+#include "CaptureSink.h"
+#include "Compositor.h"
+#include "PostProcess.h"
+#include "Globals.h"
+#include <string.h>
+
+static uint8_t expected_channel(uint8_t design) {
+    return (uint8_t)((post_lut()[design] + 0x80) >> 8);  // Wie post_process_frame ohne Dithering
+}
+
+static void check_pixel(int line, int y, int x, uint8_t r, uint8_t g, uint8_t b) {
+    const pixel_rgb_t *c = captured(y, x);
+    if (c->r != expected_channel(r) || c->g != expected_channel(g) || c->b != expected_channel(b)) {
+        printf("FAIL line %d: pixel (%d,%d) is %02x%02x%02x, expected design %02x%02x%02x\n",
+               line, y, x, c->r, c->g, c->b, r, g, b);
+        host_test_failures++;
+    }
+}
+
+#define CHECK_PIXEL(y, x, r, g, b) check_pixel(__LINE__, y, x, r, g, b)
+
+static int commit_present(void) {
+    int written = compositor_commit();
+    compositor_present();
+    return written;
+}
+
+static void test_layer_priority(void) {
+    compositor_reset();
+    commit_present();
+
+    compositor_set(LAYER_BACKGROUND, 3, 4, 10, 20, 30);
+    compositor_set(LAYER_LOCKED, 3, 4, 40, 50, 60);
+    compositor_set(LAYER_ACTIVE, 3, 4, 70, 80, 90);
+    compositor_set(LAYER_OVERLAY, 3, 4, 100, 110, 120);
+    CHECK_EQ(commit_present(), 1);
+    CHECK_PIXEL(3, 4, 100, 110, 120);       // Oberste deckende Ebene gewinnt
+
+    // Reihenfolge der Aufrufe spielt keine Rolle: unter der obersten bleibt sie verdeckt
+    compositor_set(LAYER_BACKGROUND, 3, 4, 11, 21, 31);
+    CHECK_EQ(commit_present(), 0);
+    CHECK_PIXEL(3, 4, 100, 110, 120);
+
+    compositor_clear(LAYER_OVERLAY, 3, 4);
+    CHECK_EQ(commit_present(), 1);
+    CHECK_PIXEL(3, 4, 70, 80, 90);
+
+    compositor_clear_layer(LAYER_ACTIVE);   // Ganze Ebene weg → darunterliegende sichtbar
+    CHECK_EQ(commit_present(), 1);
+    CHECK_PIXEL(3, 4, 40, 50, 60);
+
+    compositor_clear_layer(LAYER_LOCKED);
+    CHECK_EQ(commit_present(), 1);
+    CHECK_PIXEL(3, 4, 11, 21, 31);
+
+    compositor_clear_layer(LAYER_BACKGROUND);
+    CHECK_EQ(commit_present(), 1);
+    CHECK_PIXEL(3, 4, 0, 0, 0);              // Keine deckende Ebene → schwarz
+}
+
+static void test_noop_commit(void) {
+    compositor_reset();
+    compositor_set(LAYER_LOCKED, 5, 5, 200, 100, 50);
+    compositor_set(LAYER_LOCKED, 6, 5, 50, 100, 200);
+    commit_present();
+
+    CHECK_EQ(commit_present(), 0);
+    CHECK_EQ(captured_changed_count(), 0);
+
+    // Gleiche Farbe erneut, oder geändert und im selben Frame zurück: nichts geschrieben
+    compositor_set(LAYER_LOCKED, 5, 5, 200, 100, 50);
+    compositor_set(LAYER_LOCKED, 6, 5, 1, 2, 3);
+    compositor_set(LAYER_LOCKED, 6, 5, 50, 100, 200);
+    CHECK_EQ(commit_present(), 0);
+    CHECK_EQ(captured_changed_count(), 0);
+
+    // Verdeckte Änderung unter einer deckenden Ebene
+    compositor_set(LAYER_OVERLAY, 5, 5, 9, 9, 9);
+    CHECK_EQ(commit_present(), 1);
+    compositor_set(LAYER_LOCKED, 5, 5, 1, 1, 1);
+    CHECK_EQ(commit_present(), 0);
+    CHECK_EQ(captured_changed_count(), 0);
+    CHECK_PIXEL(5, 5, 9, 9, 9);
+}
+
+static void test_clipping(void) {
+    compositor_reset();
+    commit_present();
+
+    compositor_set(LAYER_OVERLAY, -1, 0, 255, 255, 255);
+    compositor_set(LAYER_OVERLAY, 0, -1, 255, 255, 255);
+    compositor_set(LAYER_OVERLAY, LED_HEIGHT, 0, 255, 255, 255);
+    compositor_set(LAYER_OVERLAY, 0, LED_WIDTH, 255, 255, 255);     // Ohne Clipping: (1, 0)
+    compositor_set(LAYER_OVERLAY, LED_HEIGHT - 1, LED_WIDTH, 255, 255, 255);
+    compositor_clear(LAYER_OVERLAY, LED_HEIGHT, LED_WIDTH);
+    CHECK_EQ(commit_present(), 0);
+    CHECK_EQ(captured_changed_count(), 0);
+    CHECK_PIXEL(1, 0, 0, 0, 0);
+    CHECK_PIXEL(0, 0, 0, 0, 0);
+    CHECK_PIXEL(LED_HEIGHT - 1, LED_WIDTH - 1, 0, 0, 0);
+
+    // Ecken selbst liegen im Feld
+    compositor_set(LAYER_OVERLAY, 0, 0, 30, 30, 30);
+    compositor_set(LAYER_OVERLAY, LED_HEIGHT - 1, LED_WIDTH - 1, 60, 60, 60);
+    CHECK_EQ(commit_present(), 2);
+    CHECK_PIXEL(0, 0, 30, 30, 30);
+    CHECK_PIXEL(LED_HEIGHT - 1, LED_WIDTH - 1, 60, 60, 60);
+}
+
+static void test_skipped_present(void) {
+    compositor_reset();
+    commit_present();
+
+    // Frame 1: committet, aber nicht präsentiert (z.B. Strip noch beschäftigt)
+    compositor_set(LAYER_LOCKED, 2, 2, 120, 0, 0);
+    compositor_set(LAYER_LOCKED, 8, 9, 0, 120, 0);
+    CHECK_EQ(compositor_commit(), 2);
+    uint32_t presents = s_capture.presents;
+
+    // Frame 2: weitere Änderung, dann present
+    compositor_set(LAYER_LOCKED, 20, 15, 0, 0, 120);
+    compositor_set(LAYER_LOCKED, 8, 9, 0, 60, 0);   // Im ausgelassenen Frame schon geändert
+    CHECK_EQ(commit_present(), 2);
+    CHECK_EQ(s_capture.presents, presents + 1);
+
+    CHECK_EQ(captured_changed_count(), 3);
+    CHECK(captured_changed(2 * LED_WIDTH + 2));
+    CHECK(captured_changed(8 * LED_WIDTH + 9));
+    CHECK(captured_changed(20 * LED_WIDTH + 15));
+    CHECK_PIXEL(2, 2, 120, 0, 0);
+    CHECK_PIXEL(8, 9, 0, 60, 0);
+    CHECK_PIXEL(20, 15, 0, 0, 120);
+
+    CHECK_EQ(commit_present(), 0);                  // Danach ist die Maske wieder leer
+    CHECK_EQ(captured_changed_count(), 0);
+}
+
+int main(void) {
+    compositor_init();
+    post_set_brightness(255);
+    post_set_dither(false);
+    capture_sink_register();
+    commit_present();                               // Erste Übergabe mit voller Maske
+
+    test_layer_priority();
+    test_noop_commit();
+    test_clipping();
+    test_skipped_present();
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,120 @@
+/**
+ * @file DebounceTest.c
+ * @brief Prell-Wellenformen gegen den Integrator (Debounce.c) und den Abtaster (Controls.c)
+ *
+ * Jede Wellenform ist eine Folge von Roh-Abtastungen ('1' = gedrückt), darunter
+ * die erwarteten Flanken an derselben Stelle ('P' = Press, 'R' = Release).
+ * Die Erwartungen sind von Hand aus der Integrator-Regel abgeleitet: +1 pro
+ * gedrückter, -1 pro losgelassener Abtastung, Wechsel an den Grenzen 0/threshold.
+ *
+ * Zweiter Teil: dieselbe Wellenform über GPIO-Pegel (aktiv-LOW) durch den
+ * Button-Abtaster bis in den Event-Ring, inklusive Zeitstempel.
+ */
+
+#include "HostTest.h"
+#include "HostStubs.h"
+#include "Debounce.h"
+#include "Controls.h"
+#include "Clock.h"
+#include "Globals.h"
+#include <string.h>
+
+typedef struct {
+    const char *name;
+    uint8_t threshold;
+    bool start_pressed;
+    const char *raw;
+    const char *edges;
+} waveform_t;
+
+static const waveform_t s_waveforms[] = {
+    { "clean press/release", 4, false,
+      "000011111111000000000",
+      ".......P.......R....." },
+    { "bounce on press", 4, false,
+      "0010110111111000000",
+      ".........P......R.." },
+    { "bounce on release", 4, true,
+      "1111010010100000000",
+      ".............R....." },
+    { "glitches shorter than threshold", 4, false,
+      "0001100000110000",
+      "................" },
+    { "dropouts while held", 4, false,
+      "0111111101111111011111110000",
+      "....P......................R" },
+    { "threshold 1 follows every change", 1, false,
+      "0101",
+      ".PRP" },
+    { "threshold 0 is treated as 1", 0, false,
+      "0110",
+      ".P.R" },
+};
+
+static void test_waveform(const waveform_t *w) {
+    size_t n = strlen(w->raw);
+    CHECK_EQ(strlen(w->edges), n);
+
+    debounce_t d;
+    debounce_init(&d, w->threshold, w->start_pressed);
+
+    char got[64] = {0};
+    for (size_t i = 0; i < n && i < sizeof(got) - 1; i++) {
+        debounce_edge_t e = debounce_sample(&d, w->raw[i] == '1');
+        got[i] = (e == DEBOUNCE_EDGE_PRESS) ? 'P' : (e == DEBOUNCE_EDGE_RELEASE) ? 'R' : '.';
+    }
+    if (strcmp(got, w->edges) != 0) {
+        printf("FAIL %s\n  raw      %s\n  expected %s\n  got      %s\n", w->name, w->raw, w->edges, got);
+        host_test_failures++;
+    }
+}
+
+/**
+ * @brief Wellenform durch den echten Abtaster: Pegel setzen, Timer feuern, Ring lesen
+ *
+ * Threshold ist BUTTON_DEBOUNCE_SAMPLES (5). Abtastung k liegt bei k * BUTTON_SAMPLE_PERIOD_US.
+ */
+static void test_sampler(void) {
+    //                   0         1         2
+    //                   0123456789012345678901
+    const char *raw   = "0010110111111100000000";
+    const int press_at = 10, press_raw_at = 4;      // Erste Abweichung nach dem letzten Ruhezustand
+    const int release_at = 18, release_raw_at = 14;
+
+    CHECK_EQ(BUTTON_DEBOUNCE_SAMPLES, 5);  // Erwartungen oben gelten für 5 Abtastungen
+
+    clock_use_virtual(0);
+    host_gpio_set_level(BTN_LEFT, 1);
+    init_controls();
+
+    for (int k = 0; raw[k] != '\0'; k++) {
+        host_gpio_set_level(BTN_LEFT, raw[k] == '1' ? 0 : 1);
+        host_timer_service(clock_now_us());
+        CHECK_EQ(controls_is_held(BUTTON_LEFT), k >= press_at && k < release_at);
+        clock_advance_us(BUTTON_SAMPLE_PERIOD_US);
+    }
+
+    const int64_t period = BUTTON_SAMPLE_PERIOD_US;
+    input_event_t ev;
+    CHECK(controls_poll(&ev));
+    CHECK_EQ(ev.button, BUTTON_LEFT);
+    CHECK_EQ(ev.edge, INPUT_EDGE_PRESS);
+    CHECK_EQ(ev.timestamp_us, press_at * period);
+    CHECK_EQ(ev.raw_us, press_raw_at * period);
+
+    CHECK(controls_poll(&ev));
+    CHECK_EQ(ev.button, BUTTON_LEFT);
+    CHECK_EQ(ev.edge, INPUT_EDGE_RELEASE);
+    CHECK_EQ(ev.timestamp_us, release_at * period);
+    CHECK_EQ(ev.raw_us, release_raw_at * period);
+
+    CHECK(!controls_poll(&ev));  // Prellen erzeugt keine weiteren Events
+}
+
+int main(void) {
+    for (size_t i = 0; i < sizeof(s_waveforms) / sizeof(s_waveforms[0]); i++) {
+        test_waveform(&s_waveforms[i]);
+    }
+    test_sampler();
+    return HOST_TEST_RESULT();
+}
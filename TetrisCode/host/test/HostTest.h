@@ -0,0 +1,33 @@
+#ifndef HOST_TEST_H
+#define HOST_TEST_H
+
+#include <stdio.h>
+#include <stdint.h>
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// HOST TEST - Minimale Prüf-Makros für die Tests in host/test (ein Executable pro Modul)
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// Fehlgeschlagene Prüfungen werden gemeldet und gezählt, der Test läuft weiter.
+// main() endet mit "return HOST_TEST_RESULT();" (0 = bestanden, für ctest).
+
+static int host_test_failures = 0;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+        printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+        host_test_failures++; \
+    } \
+} while (0)
+
+#define CHECK_EQ(actual, expected) do { \
+    long long a_ = (long long)(actual), e_ = (long long)(expected); \
+    if (a_ != e_) { \
+        printf("FAIL %s:%d: %s == %lld, expected %lld\n", __FILE__, __LINE__, #actual, a_, e_); \
+        host_test_failures++; \
+    } \
+} while (0)
+
+#define HOST_TEST_RESULT() \
+    (printf("%s: %s\n", __FILE__, host_test_failures ? "FAILED" : "ok"), host_test_failures ? 1 : 0)
+
+#endif // HOST_TEST_H
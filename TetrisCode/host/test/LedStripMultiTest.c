@@ -0,0 +1,174 @@
+/**
+ * @file LedStripMultiTest.c
+ * @brief Mehrkanal-LED-Gerät (LedStripMulti.c) gegen den RMT-Mock
+ *
+ * Pro Kanal wird der aufgezeichnete Symbolstrom mit der Bit-für-Bit Referenz
+ * der GRB-Bytes seines Ausschnitts verglichen: richtige Datenleitung, richtige
+ * LEDs, keine Überlappung/Lücke an den Panelgrenzen, Reset-Symbol am Ende.
+ * Außerdem: alle Kanäle starten vor dem ersten Warten (parallel), del()
+ * gibt Kanäle und Encoder frei, ungültige Aufteilungen werden abgelehnt.
+ */
+
+#include "HostTest.h"
+#include "RmtMock.h"
+#include "LedStripMulti.h"
+#include "Ws2812Lut.h"
+#include "Globals.h"
+#include "led_strip_interface.h"
+#include <string.h>
+
+#define TEST_MAX_BYTES (LED_STRIP_NUM_LEDS * 3)
+
+static rmt_symbol_word_t s_ref_stream[WS2812_FRAME_SYMBOLS(TEST_MAX_BYTES)];
+
+// Farbe pro Kettenindex: alle drei Kanäle unterscheidbar, über 256 LEDs hinaus eindeutig
+static void test_color(uint32_t i, uint8_t *r, uint8_t *g, uint8_t *b) {
+    *r = (uint8_t)i;
+    *g = (uint8_t)(i * 7 + 3);
+    *b = (uint8_t)(0x40 | (i >> 8));
+}
+
+/**
+ * @brief Referenz: GRB-Bytes der LEDs [first, first + count), jedes Bit einzeln, dann Reset
+ */
+static size_t encode_reference(uint32_t first, uint32_t count, rmt_symbol_word_t *out) {
+    size_t k = 0;
+    for (uint32_t i = first; i < first + count; i++) {
+        uint8_t r, g, b;
+        test_color(i, &r, &g, &b);
+        const uint8_t grb[3] = { g, r, b };
+        for (int c = 0; c < 3; c++) {
+            for (int bit = 7; bit >= 0; bit--) {
+                out[k++] = ws2812_bit_symbol((grb[c] >> bit) & 1);
+            }
+        }
+    }
+    out[k++] = ws2812_reset_symbol();
+    return k;
+}
+
+static void check_channel_stream(int c, const led_channel_span_t *span) {
+    const rmt_mock_channel_t *ch = rmt_mock_channel(c);
+    size_t ref_len = encode_reference(span->first_led, span->num_leds, s_ref_stream);
+
+    CHECK_EQ(ch->num_symbols, ref_len);
+    for (size_t i = 0; i < ref_len && i < ch->num_symbols; i++) {
+        if (ch->symbols[i].val != s_ref_stream[i].val) {
+            printf("FAIL channel %d (LEDs %u..%u): symbol %zu (LED %zu) is %08x, expected %08x\n",
+                   c, span->first_led, span->first_led + span->num_leds - 1, i,
+                   span->first_led + i / 24, (unsigned)ch->symbols[i].val, (unsigned)s_ref_stream[i].val);
+            host_test_failures++;
+            return;
+        }
+    }
+}
+
+// ============================================================================
+// KANAL-AUFTEILUNG
+// ============================================================================
+
+static void test_channel_map(void) {
+    led_channel_span_t spans[LED_MULTI_MAX_CHANNELS];
+
+    // 6 Panels auf 3 Kanäle: je 2
+    CHECK(led_channel_map_build(384, 64, 3, spans));
+    for (int c = 0; c < 3; c++) {
+        CHECK_EQ(spans[c].first_led, c * 128);
+        CHECK_EQ(spans[c].num_leds, 128);
+    }
+
+    // 5 Panels auf 3 Kanäle: vordere Kanäle bekommen den Rest
+    CHECK(led_channel_map_build(320, 64, 3, spans));
+    CHECK_EQ(spans[0].num_leds, 128);
+    CHECK_EQ(spans[1].first_led, 128);
+    CHECK_EQ(spans[1].num_leds, 128);
+    CHECK_EQ(spans[2].first_led, 256);
+    CHECK_EQ(spans[2].num_leds, 64);
+
+    CHECK(led_channel_map_build(384, 64, 1, spans));
+    CHECK_EQ(spans[0].first_led, 0);
+    CHECK_EQ(spans[0].num_leds, 384);
+
+    // Ungültig: keine ganzen Panels, mehr Kanäle als Panels, 0 Kanäle, zu viele Kanäle
+    CHECK(!led_channel_map_build(380, 64, 2, spans));
+    CHECK(!led_channel_map_build(128, 64, 3, spans));
+    CHECK(!led_channel_map_build(384, 64, 0, spans));
+    CHECK(!led_channel_map_build(384, 0, 2, spans));
+    CHECK(!led_channel_map_build(64 * 8, 64, LED_MULTI_MAX_CHANNELS + 1, spans));
+}
+
+// ============================================================================
+// GERÄT ÜBER DEN MOCK
+// ============================================================================
+
+static void test_device(uint32_t num_leds, uint8_t channels) {
+    static const int gpios[LED_MULTI_MAX_CHANNELS] = { LED_GPIO_PIN, LED_GPIO_PIN_2, LED_GPIO_PIN_3 };
+    rmt_mock_reset();
+
+    led_strip_config_t strip_config = { .strip_gpio_num = LED_GPIO_PIN, .max_leds = num_leds };
+    led_strip_multi_config_t multi_config = {
+        .num_channels = channels,
+        .gpio_nums = gpios,
+        .panel_leds = LED_PANEL_LEDS,
+    };
+    led_strip_t *strip = NULL;
+    CHECK_EQ(led_strip_new_multi_rmt_device(&strip_config, &multi_config, &strip), ESP_OK);
+    if (strip == NULL) return;
+
+    CHECK_EQ(rmt_mock_channel_count(), channels);
+    for (int c = 0; c < channels; c++) {
+        CHECK_EQ(rmt_mock_channel(c)->gpio_num, gpios[c]);
+        CHECK(rmt_mock_channel(c)->enabled);
+    }
+
+    for (uint32_t i = 0; i < num_leds; i++) {
+        uint8_t r, g, b;
+        test_color(i, &r, &g, &b);
+        CHECK_EQ(strip->set_pixel(strip, i, r, g, b), ESP_OK);
+    }
+    CHECK_EQ(strip->set_pixel(strip, num_leds, 1, 2, 3), ESP_ERR_INVALID_ARG);
+
+    rmt_mock_reset_streams();
+    CHECK_EQ(strip->refresh(strip), ESP_OK);
+
+    // Erst alle Übertragungen, dann alle Waits (sonst liefen die Kanäle nacheinander)
+    CHECK_EQ(rmt_mock_log_count(), 2 * channels);
+    for (int k = 0; k < rmt_mock_log_count(); k++) {
+        const rmt_mock_log_t *entry = rmt_mock_log(k);
+        CHECK_EQ(entry->op, k < channels ? RMT_MOCK_TRANSMIT : RMT_MOCK_WAIT);
+        CHECK_EQ(entry->channel, k % channels);
+    }
+
+    led_channel_span_t spans[LED_MULTI_MAX_CHANNELS];
+    CHECK(led_channel_map_build(num_leds, LED_PANEL_LEDS, channels, spans));
+    for (int c = 0; c < channels; c++) {
+        CHECK_EQ(rmt_mock_channel(c)->transmits, 1);
+        check_channel_stream(c, &spans[c]);
+    }
+
+    CHECK_EQ(strip->del(strip), ESP_OK);
+    CHECK_EQ(rmt_mock_live_channels(), 0);
+    CHECK_EQ(rmt_mock_live_encoders(), 0);
+}
+
+static void test_invalid_split(void) {
+    static const int gpios[LED_MULTI_MAX_CHANNELS] = { LED_GPIO_PIN, LED_GPIO_PIN_2, LED_GPIO_PIN_3 };
+    rmt_mock_reset();
+
+    led_strip_config_t strip_config = { .strip_gpio_num = LED_GPIO_PIN, .max_leds = 2 * LED_PANEL_LEDS };
+    led_strip_multi_config_t multi_config = { .num_channels = 3, .gpio_nums = gpios, .panel_leds = LED_PANEL_LEDS };
+    led_strip_t *strip = NULL;
+    CHECK_EQ(led_strip_new_multi_rmt_device(&strip_config, &multi_config, &strip), ESP_ERR_INVALID_ARG);
+    CHECK(strip == NULL);
+    CHECK_EQ(rmt_mock_channel_count(), 0);  // Abgelehnt, bevor ein Kanal belegt wird
+}
+
+int main(void) {
+    test_channel_map();
+    test_device(LED_STRIP_NUM_LEDS, 3);
+    test_device(LED_STRIP_NUM_LEDS, 2);
+    test_device(LED_STRIP_NUM_LEDS, 1);
+    test_device(5 * LED_PANEL_LEDS, 3);     // Ungleiche Ausschnitte
+    test_invalid_split();
+    return HOST_TEST_RESULT();
+}
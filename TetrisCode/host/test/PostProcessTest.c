@@ -0,0 +1,122 @@
+/**
+ * @file PostProcessTest.c
+ * @brief SWAR-Kernel (post_process_frame) gegen die Skalar-Referenz
+ *
+ * Beide laufen über viele Frames mit eigenem Fehlerspeicher nebeneinander;
+ * jeder Ausgabewert muss übereinstimmen, mit und ohne Dithering und für
+ * Helligkeiten bis 255 (lut[255] = 0xFF00, Grenzfall für den Übertrag
+ * zwischen den Wort-Hälften). Dazu die Sigma-Delta-Eigenschaft: bei
+ * konstantem Eingang ist die Summe über 256 Frames genau lut[c].
+ * Änderungen über post_request_*() greifen erst beim nächsten Frame.
+ */
+
+#include "HostTest.h"
+#include "PostProcess.h"
+#include "Globals.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST_FRAMES 300
+
+static uint8_t s_in[POST_MAX_CHANNELS];
+static uint8_t s_out[POST_MAX_CHANNELS];
+static uint8_t s_ref[POST_MAX_CHANNELS];
+static uint8_t s_ref_err[POST_MAX_CHANNELS];
+
+static void compare_kernels(uint8_t brightness, bool dither, bool animate) {
+    post_init(brightness);
+    post_set_dither(true);
+    memset(s_ref_err, 0, sizeof(s_ref_err));
+    srand(brightness * 2 + dither);
+    for (size_t i = 0; i < POST_MAX_CHANNELS; i++) s_in[i] = (uint8_t)rand();
+
+    for (int f = 0; f < TEST_FRAMES; f++) {
+        if (animate) {
+            for (int k = 0; k < 64; k++) s_in[rand() % POST_MAX_CHANNELS] = (uint8_t)rand();
+        }
+        post_process_frame(s_in, s_out, POST_MAX_CHANNELS, dither);
+        post_process_reference(post_lut(), s_in, s_ref, s_ref_err, POST_MAX_CHANNELS, dither);
+
+        for (size_t i = 0; i < POST_MAX_CHANNELS; i++) {
+            if (s_out[i] != s_ref[i]) {
+                printf("FAIL brightness %u, dither %d, frame %d, channel %zu (in %u): SWAR %u, reference %u\n",
+                       (unsigned)brightness, dither, f, i, s_in[i], s_out[i], s_ref[i]);
+                host_test_failures++;
+                return;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Konstanter Eingang: Summe über 256 Frames = lut[c] (nichts geht verloren)
+ */
+static void test_dither_average(uint8_t brightness) {
+    post_init(brightness);
+    post_set_dither(true);
+    for (size_t i = 0; i < POST_MAX_CHANNELS; i++) s_in[i] = (uint8_t)i;
+
+    static uint32_t sum[POST_MAX_CHANNELS];
+    memset(sum, 0, sizeof(sum));
+    for (int f = 0; f < 256; f++) {
+        post_process_frame(s_in, s_out, POST_MAX_CHANNELS, true);
+        for (size_t i = 0; i < POST_MAX_CHANNELS; i++) sum[i] += s_out[i];
+    }
+    for (size_t i = 0; i < POST_MAX_CHANNELS; i++) {
+        if (sum[i] != post_lut()[s_in[i]]) {
+            printf("FAIL brightness %u, input %u: 256-frame sum %lu, lut %u\n",
+                   (unsigned)brightness, s_in[i], (unsigned long)sum[i], post_lut()[s_in[i]]);
+            host_test_failures++;
+            return;
+        }
+    }
+}
+
+static void test_lut(void) {
+    post_init(255);
+    CHECK_EQ(post_lut()[0], 0);
+    CHECK_EQ(post_lut()[255], 0xFF00);
+    for (int c = 1; c < 256; c++) CHECK(post_lut()[c] >= post_lut()[c - 1]);
+
+    post_init(POST_BRIGHTNESS);
+    CHECK_EQ(post_get_brightness(), POST_BRIGHTNESS);
+    CHECK_EQ(post_lut()[255], POST_BRIGHTNESS * 256);
+    CHECK_EQ(post_get_dither(), POST_DITHER_DEFAULT);
+}
+
+static void test_requests(void) {
+    post_init(POST_BRIGHTNESS);
+    memset(s_in, 255, sizeof(s_in));
+
+    post_request_brightness(40);
+    post_request_dither(false);
+    CHECK_EQ(post_get_brightness(), POST_BRIGHTNESS);  // Noch nicht übernommen
+    CHECK_EQ(post_lut()[255], POST_BRIGHTNESS * 256);
+
+    post_process_frame(s_in, s_out, POST_MAX_CHANNELS, true);
+    CHECK_EQ(post_get_brightness(), 40);
+    CHECK(!post_get_dither());
+    CHECK_EQ(s_out[0], 40);
+
+    post_process_frame(s_in, s_out, POST_MAX_CHANNELS, true);  // Anforderung nur einmal
+    CHECK_EQ(post_get_brightness(), 40);
+
+    post_request_dither(true);
+    post_process_frame(s_in, s_out, POST_MAX_CHANNELS, true);
+    CHECK(post_get_dither());
+}
+
+int main(void) {
+    test_lut();
+
+    static const uint8_t brightness[] = { 1, 7, POST_BRIGHTNESS, 128, 254, 255 };
+    for (size_t b = 0; b < sizeof(brightness); b++) {
+        compare_kernels(brightness[b], true, false);
+        compare_kernels(brightness[b], true, true);
+        compare_kernels(brightness[b], false, true);
+        test_dither_average(brightness[b]);
+    }
+
+    test_requests();
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,117 @@
+/**
+ * @file PowerLimitTest.c
+ * @brief Stromlimit (PowerLimit.c, flush_limited() im Compositor) über zufällige Frames
+ *
+ * Die Frames laufen durch den echten Compositor und die Nachbearbeitung
+ * (Helligkeit 255, ohne Dithering, damit das Budget oft überschritten wird);
+ * gelesen wird der präsentierte Frame über die Capture-Senke. Der
+ * angeforderte (ungeskalierte) Wert jedes Pixels kommt aus
+ * post_process_reference() über dieselben Design-Werte. Pro Frame:
+ * - die inkrementelle Kanalsumme entspricht einem vollen Scan
+ * - der präsentierte Frame liegt im Budget (LED_CURRENT_BUDGET_MA)
+ * - jeder präsentierte Wert ist power_limit_apply(angefordert, Faktor)
+ * - ein neuer Faktor schreibt alle Pixel neu, sonst nur geänderte
+ */
+
+#include "HostTest.h"
+#include "CaptureSink.h"
+#include "Compositor.h"
+#include "PostProcess.h"
+#include "PowerLimit.h"
+#include "Globals.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST_FRAMES 2000
+#define TEST_CHANNELS (COMPOSITOR_PIXELS * 3)
+
+/** @brief Design-Werte in LAYER_BACKGROUND und daraus angeforderte Strip-Werte */
+static pixel_rgb_t s_design[COMPOSITOR_PIXELS];
+static pixel_rgb_t s_requested[COMPOSITOR_PIXELS];
+static uint8_t s_err_unused[TEST_CHANNELS];
+
+static uint32_t channel_sum(const pixel_rgb_t *frame) {
+    uint32_t sum = 0;
+    for (int i = 0; i < COMPOSITOR_PIXELS; i++) sum += (uint32_t)frame[i].r + frame[i].g + frame[i].b;
+    return sum;
+}
+
+/**
+ * @brief Nächster Frame: meist wenige Pixel ändern, manchmal hell füllen oder fast leeren
+ */
+static void mutate_frame(void) {
+    int mode = rand() % 10;
+    int count = (mode < 7) ? 1 + rand() % 24 : COMPOSITOR_PIXELS;
+
+    for (int k = 0; k < count; k++) {
+        int i = (count == COMPOSITOR_PIXELS) ? k : rand() % COMPOSITOR_PIXELS;
+        pixel_rgb_t c;
+        if (mode == 7) {
+            c = (pixel_rgb_t){ 0, 0, 0 };                       // Fast leer → unter Budget
+        } else if (mode == 8) {
+            c = (pixel_rgb_t){ 255, 255, 255 };                 // Weiß → weit darüber
+        } else {
+            c = (pixel_rgb_t){ (uint8_t)rand(), (uint8_t)rand(), (uint8_t)rand() };
+        }
+        s_design[i] = c;
+        compositor_set(LAYER_BACKGROUND, i / LED_WIDTH, i % LED_WIDTH, c.r, c.g, c.b);
+    }
+}
+
+int main(void) {
+    compositor_init();
+    post_set_brightness(255);
+    post_set_dither(false);
+    capture_sink_register();
+    compositor_commit();
+    compositor_present();            // Erste Übergabe mit voller Maske
+
+    srand(4711);
+    uint16_t last_scale = POWER_SCALE_ONE;
+    int scale_changes = 0, limited = 0;
+
+    for (int f = 0; f < TEST_FRAMES; f++) {
+        mutate_frame();
+        int written = compositor_commit();
+        compositor_present();
+
+        post_process_reference(post_lut(), (const uint8_t *)s_design, (uint8_t *)s_requested,
+                               s_err_unused, TEST_CHANNELS, false);
+
+        CHECK_EQ(power_limit_channel_sum(), channel_sum(s_requested));
+
+        power_stats_t stats;
+        power_limit_get_stats(&stats);
+        uint16_t scale = stats.scale;
+        CHECK(power_limit_estimate_ma(channel_sum(s_capture.frame)) <= LED_CURRENT_BUDGET_MA);
+        if (scale < POWER_SCALE_ONE) limited++;
+
+        for (int i = 0; i < COMPOSITOR_PIXELS; i++) {
+            const pixel_rgb_t *req = &s_requested[i], *got = &s_capture.frame[i];
+            if (got->r != power_limit_apply(req->r, scale) || got->g != power_limit_apply(req->g, scale) ||
+                got->b != power_limit_apply(req->b, scale)) {
+                printf("FAIL frame %d, pixel %d: presented %02x%02x%02x, requested %02x%02x%02x at scale %u\n",
+                       f, i, got->r, got->g, got->b, req->r, req->g, req->b, (unsigned)scale);
+                host_test_failures++;
+                break;
+            }
+        }
+
+        if (scale != last_scale) {
+            scale_changes++;
+            CHECK_EQ(written, COMPOSITOR_PIXELS);
+            CHECK_EQ(captured_changed_count(), COMPOSITOR_PIXELS);
+        } else {
+            CHECK_EQ(captured_changed_count(), written);
+        }
+        last_scale = scale;
+    }
+
+    // Die Zufallsfolge muss beide Richtungen oft genug treffen, sonst prüft der Test nichts
+    printf("[PowerLimitTest] %d frames, %d limited, %d scale changes\n", TEST_FRAMES, limited, scale_changes);
+    CHECK(limited > TEST_FRAMES / 10);
+    CHECK(limited < TEST_FRAMES);
+    CHECK(scale_changes > 20);
+
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,174 @@
+/**
+ * @file RmtMock.c
+ * @brief RMT TX-Treiber Ersatz: Symbolströme pro Kanal statt Hardware (Semantik siehe RmtMock.h)
+ *
+ * Nachgebildet ist nur, was die LED-Treiber benutzen: TX-Kanäle, Simple-Encoder,
+ * rmt_transmit() und rmt_tx_wait_all_done(). Eine Übertragung wird sofort
+ * vollständig kodiert; "Warten" ist nur ein Protokolleintrag.
+ */
+
+#include "RmtMock.h"
+#include "driver/rmt_tx.h"
+#include "esp_check.h"
+#include <stdio.h>
+#include <string.h>
+
+struct rmt_channel_t {
+    int index;
+};
+
+typedef struct {
+    rmt_encoder_t base;
+    rmt_simple_encoder_config_t config;
+    bool deleted;
+} rmt_mock_encoder_t;
+
+static struct rmt_channel_t s_handles[RMT_MOCK_MAX_CHANNELS];
+static rmt_mock_channel_t s_channels[RMT_MOCK_MAX_CHANNELS];
+static int s_channel_count = 0;
+
+static rmt_mock_encoder_t s_encoders[RMT_MOCK_MAX_CHANNELS];
+static int s_encoder_count = 0;
+
+static rmt_mock_log_t s_log[RMT_MOCK_LOG_LEN];
+static int s_log_count = 0;
+
+static void log_op(rmt_mock_op_t op, int channel) {
+    if (s_log_count < RMT_MOCK_LOG_LEN) {
+        s_log[s_log_count++] = (rmt_mock_log_t){ .op = op, .channel = channel };
+    }
+}
+
+// ============================================================================
+// MOCK-STEUERUNG
+// ============================================================================
+
+void rmt_mock_reset(void) {
+    memset(s_channels, 0, sizeof(s_channels));
+    memset(s_encoders, 0, sizeof(s_encoders));
+    s_channel_count = 0;
+    s_encoder_count = 0;
+    s_log_count = 0;
+}
+
+void rmt_mock_reset_streams(void) {
+    for (int i = 0; i < s_channel_count; i++) s_channels[i].num_symbols = 0;
+    s_log_count = 0;
+}
+
+int rmt_mock_channel_count(void) { return s_channel_count; }
+const rmt_mock_channel_t *rmt_mock_channel(int index) { return &s_channels[index]; }
+int rmt_mock_log_count(void) { return s_log_count; }
+const rmt_mock_log_t *rmt_mock_log(int index) { return &s_log[index]; }
+
+int rmt_mock_live_channels(void) {
+    int live = 0;
+    for (int i = 0; i < s_channel_count; i++) live += !s_channels[i].deleted;
+    return live;
+}
+
+int rmt_mock_live_encoders(void) {
+    int live = 0;
+    for (int i = 0; i < s_encoder_count; i++) live += !s_encoders[i].deleted;
+    return live;
+}
+
+// ============================================================================
+// RMT TX API
+// ============================================================================
+
+esp_err_t rmt_new_tx_channel(const rmt_tx_channel_config_t *config, rmt_channel_handle_t *ret_chan) {
+    if (config == NULL || ret_chan == NULL || config->mem_block_symbols < 2) return ESP_ERR_INVALID_ARG;
+    if (s_channel_count >= RMT_MOCK_MAX_CHANNELS) return ESP_ERR_NOT_FOUND;  // Wie "no free channels"
+
+    int i = s_channel_count++;
+    s_channels[i] = (rmt_mock_channel_t){ .gpio_num = config->gpio_num, .mem_block_symbols = config->mem_block_symbols };
+    s_handles[i].index = i;
+    *ret_chan = &s_handles[i];
+    return ESP_OK;
+}
+
+esp_err_t rmt_new_simple_encoder(const rmt_simple_encoder_config_t *config, rmt_encoder_handle_t *ret_encoder) {
+    if (config == NULL || config->callback == NULL || ret_encoder == NULL) return ESP_ERR_INVALID_ARG;
+    if (s_encoder_count >= RMT_MOCK_MAX_CHANNELS) return ESP_ERR_NO_MEM;
+
+    rmt_mock_encoder_t *enc = &s_encoders[s_encoder_count++];
+    enc->config = *config;
+    enc->deleted = false;
+    *ret_encoder = &enc->base;
+    return ESP_OK;
+}
+
+esp_err_t rmt_enable(rmt_channel_handle_t chan) {
+    s_channels[chan->index].enabled = true;
+    return ESP_OK;
+}
+
+esp_err_t rmt_disable(rmt_channel_handle_t chan) {
+    s_channels[chan->index].enabled = false;
+    return ESP_OK;
+}
+
+esp_err_t rmt_del_channel(rmt_channel_handle_t chan) {
+    rmt_mock_channel_t *ch = &s_channels[chan->index];
+    if (ch->enabled || ch->deleted) return ESP_ERR_INVALID_STATE;  // Treiber verlangt erst disable
+    ch->deleted = true;
+    return ESP_OK;
+}
+
+esp_err_t rmt_del_encoder(rmt_encoder_handle_t encoder) {
+    rmt_mock_encoder_t *enc = __containerof(encoder, rmt_mock_encoder_t, base);
+    if (enc->deleted) return ESP_ERR_INVALID_STATE;
+    enc->deleted = true;
+    return ESP_OK;
+}
+
+/**
+ * @brief Callback blockweise aufrufen wie der Simple-Encoder des Treibers
+ *
+ * Freier Platz ist der Rest des aktuellen Ping-Pong-Halbblocks; unter
+ * min_chunk_size wird der Halbblock als voll betrachtet und der nächste begonnen.
+ */
+esp_err_t rmt_transmit(rmt_channel_handle_t chan, rmt_encoder_handle_t encoder, const void *payload,
+                       size_t payload_bytes, const rmt_transmit_config_t *config) {
+    rmt_mock_channel_t *ch = &s_channels[chan->index];
+    rmt_mock_encoder_t *enc = __containerof(encoder, rmt_mock_encoder_t, base);
+    if (!ch->enabled || ch->deleted || enc->deleted) return ESP_ERR_INVALID_STATE;
+    log_op(RMT_MOCK_TRANSMIT, chan->index);
+    ch->transmits++;
+
+    size_t half = ch->mem_block_symbols / 2;
+    if (enc->config.min_chunk_size > half) return ESP_ERR_INVALID_ARG;
+    size_t written = 0;             // symbols_written für den Callback (pro Übertragung)
+    size_t block_used = 0;
+    bool done = false;
+
+    while (!done) {
+        size_t free_symbols = half - block_used;
+        if (free_symbols < enc->config.min_chunk_size) {
+            block_used = 0;
+            continue;
+        }
+        if (ch->num_symbols + free_symbols > RMT_MOCK_MAX_SYMBOLS) {
+            printf("[RmtMock] channel %d: stream exceeds %d symbols\n", chan->index, RMT_MOCK_MAX_SYMBOLS);
+            return ESP_ERR_NO_MEM;
+        }
+
+        size_t got = enc->config.callback(payload, payload_bytes, written, free_symbols,
+                                          &ch->symbols[ch->num_symbols], &done, enc->config.arg);
+        if (got > free_symbols || (got == 0 && !done)) {
+            printf("[RmtMock] channel %d: callback returned %zu of %zu free symbols\n",
+                   chan->index, got, free_symbols);
+            return ESP_FAIL;
+        }
+        written += got;
+        ch->num_symbols += got;
+        block_used += got;
+    }
+    return ESP_OK;
+}
+
+esp_err_t rmt_tx_wait_all_done(rmt_channel_handle_t chan, int timeout_ms) {
+    log_op(RMT_MOCK_WAIT, chan->index);
+    return ESP_OK;
+}
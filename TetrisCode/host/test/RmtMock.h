@@ -0,0 +1,57 @@
+#ifndef RMT_MOCK_H
+#define RMT_MOCK_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "driver/rmt_types.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// RMT MOCK - TX-Kanäle und Simple-Encoder ohne Hardware (host/test)
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// rmt_transmit() ruft den Simple-Encoder-Callback wie der Treiber blockweise auf (höchstens
+// mem_block_symbols / 2 freie Symbole, Ping-Pong) und hängt die Symbole an den Strom des
+// Kanals an. Jeder Aufruf von rmt_transmit()/rmt_tx_wait_all_done() landet im Protokoll,
+// damit Tests die Reihenfolge (erst alle starten, dann warten) prüfen können.
+
+#define RMT_MOCK_MAX_CHANNELS 8
+#define RMT_MOCK_MAX_SYMBOLS  (8 * 3 * 512 + 1)
+#define RMT_MOCK_LOG_LEN      64
+
+typedef enum {
+    RMT_MOCK_TRANSMIT,
+    RMT_MOCK_WAIT,
+} rmt_mock_op_t;
+
+typedef struct {
+    rmt_mock_op_t op;
+    int channel;                // Index in Erzeugungsreihenfolge
+} rmt_mock_log_t;
+
+// Beobachtbarer Zustand eines Kanals
+typedef struct {
+    int gpio_num;
+    size_t mem_block_symbols;
+    bool enabled;
+    bool deleted;
+    uint32_t transmits;
+    size_t num_symbols;         // Symbole seit rmt_mock_reset_streams()
+    rmt_symbol_word_t symbols[RMT_MOCK_MAX_SYMBOLS];
+} rmt_mock_channel_t;
+
+// Alles vergessen (Kanäle, Encoder, Protokoll)
+void rmt_mock_reset(void);
+
+// Nur Symbolströme und Protokoll leeren, Kanäle bleiben
+void rmt_mock_reset_streams(void);
+
+int rmt_mock_channel_count(void);
+const rmt_mock_channel_t *rmt_mock_channel(int index);
+
+// Noch nicht gelöschte Kanäle/Encoder (Leck-Prüfung nach del)
+int rmt_mock_live_channels(void);
+int rmt_mock_live_encoders(void);
+
+int rmt_mock_log_count(void);
+const rmt_mock_log_t *rmt_mock_log(int index);
+
+#endif // RMT_MOCK_H
@@ -0,0 +1,27 @@
+# Zwei Läufe mit gleichem Seed müssen identisch sein, ein anderer Seed muss abweichen.
+#   cmake -DSIM=<tetris_sim> -P SimDeterminism.cmake
+function(run_sim seed out_var)
+    execute_process(COMMAND ${SIM} --seed ${seed} --seconds 300
+                    OUTPUT_VARIABLE out RESULT_VARIABLE rc)
+    if(NOT rc EQUAL 0)
+        message(FATAL_ERROR "tetris_sim --seed ${seed} failed (${rc})")
+    endif()
+    string(REGEX MATCHALL "\\[Sim\\] (games|result)[^\n]*" lines "${out}")
+    if(lines STREQUAL "")
+        message(FATAL_ERROR "tetris_sim --seed ${seed}: no result lines")
+    endif()
+    set(${out_var} "${lines}" PARENT_SCOPE)
+endfunction()
+
+run_sim(7 first)
+run_sim(7 second)
+run_sim(8 other)
+
+message(STATUS "seed 7: ${first}")
+message(STATUS "seed 8: ${other}")
+if(NOT first STREQUAL second)
+    message(FATAL_ERROR "same seed, different run:\n${first}\n${second}")
+endif()
+if(first STREQUAL other)
+    message(FATAL_ERROR "seed has no effect on the run")
+endif()
@@ -0,0 +1,187 @@
+/**
+ * @file SubCellGoldenTest.c
+ * @brief Golden Frames für das Sub-Cell Rendering (SubCell.c) durch den Compositor
+ *
+ * Jeder Fall zeichnet einen Block mit einem Bruchteil der nächsten Reihe in
+ * LAYER_ACTIVE, committet und liest den präsentierten Frame über die
+ * Capture-Senke (CaptureSink.h). Verglichen wird das 4x5 Fenster um den Block mit
+ * test/golden/SubCellGolden.txt (Text, ein Pixel = rrggbb, "......" = aus).
+ *
+ * Die Nachbearbeitung läuft mit Helligkeit 255 ohne Dithering, der Frame ist
+ * also gamma(Design-Wert) in voller Auflösung. Unabhängig von den Golden
+ * Files wird geprüft, dass eine einzelne Zelle über ihre zwei Reihen so viel
+ * Licht abgibt wie eine volle Zelle (Aufteilung im linearen Licht).
+ *
+ * Golden Files neu schreiben (nach gewollter Änderung, Diff prüfen):
+ *   subcell_golden_test --update
+ */
+
+#include "HostTest.h"
+#include "CaptureSink.h"
+#include "SubCell.h"
+#include "Compositor.h"
+#include "PostProcess.h"
+#include "PowerLimit.h"
+#include "Blocks.h"
+#include "Globals.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define WINDOW_X 6
+#define WINDOW_Y 4
+#define WINDOW_W 4
+#define WINDOW_H 5          // Block (4 Reihen) + die Reihe darunter
+#define LINE_LEN 128
+
+/** @brief Frame desselben Blocks auf Stufe 0 (volle Zellen) */
+static pixel_rgb_t s_full[COMPOSITOR_PIXELS];
+
+// ============================================================================
+// FÄLLE
+// ============================================================================
+
+typedef struct {
+    const char *name;
+    uint8_t type;               // Index in blocks[] (I, J, L, O, S, T, Z)
+    uint8_t rotation;
+} golden_piece_t;
+
+static const golden_piece_t s_pieces[] = {
+    { "I flat", 0, 0 },
+    { "I upright", 0, 1 },
+    { "O", 3, 0 },
+    { "S", 4, 0 },
+    { "T", 5, 0 },
+};
+
+static const uint8_t s_levels[] = { 0, 1, 4, 8, 12, 15 };
+
+static void render_case(const golden_piece_t *piece, uint8_t level) {
+    TetrisBlock block = blocks[piece->type][piece->rotation];
+    assign_block_color(&block, piece->type);
+    block.x = WINDOW_X;
+    block.y = WINDOW_Y;
+
+    compositor_clear_layer(LAYER_ACTIVE);
+    subcell_render(LAYER_ACTIVE, &block, (uint16_t)(level * (65536 / SUBCELL_LEVELS)));
+    compositor_commit();
+    compositor_present();
+}
+
+// Ein Fall als Textblock: Kopfzeile, dann WINDOW_H Zeilen
+static void format_case(const golden_piece_t *piece, uint8_t level, char lines[][LINE_LEN]) {
+    snprintf(lines[0], LINE_LEN, "# %s, level %u/%d", piece->name, (unsigned)level, SUBCELL_LEVELS);
+    for (int dy = 0; dy < WINDOW_H; dy++) {
+        char *p = lines[dy + 1];
+        p += sprintf(p, "y%-2d", WINDOW_Y + dy);
+        for (int dx = 0; dx < WINDOW_W; dx++) {
+            const pixel_rgb_t *c = captured(WINDOW_Y + dy, WINDOW_X + dx);
+            if (c->r == 0 && c->g == 0 && c->b == 0) {
+                p += sprintf(p, " ......");
+            } else {
+                p += sprintf(p, " %02x%02x%02x", c->r, c->g, c->b);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Zellen ohne Nachbarn in derselben Spalte: Licht oben + unten = volle Zelle
+ *
+ * Licht ~ Ausgabewert (gamma ist schon angewendet). Toleranz für die Rundung der
+ * 8.8 Gewichte und der Design-Werte vor gamma.
+ */
+static void check_light_sum(const golden_piece_t *piece, uint8_t level) {
+    const TetrisBlock *shape = &blocks[piece->type][piece->rotation];
+    for (int bx = 0; bx < 4; bx++) {
+        int cells = 0, by_cell = 0;
+        for (int by = 0; by < 4; by++) {
+            if (shape->shape[by][bx]) {
+                cells++;
+                by_cell = by;
+            }
+        }
+        if (cells != 1) continue;
+
+        const pixel_rgb_t *top = captured(WINDOW_Y + by_cell, WINDOW_X + bx);
+        const pixel_rgb_t *bottom = captured(WINDOW_Y + by_cell + 1, WINDOW_X + bx);
+        const pixel_rgb_t *full = &s_full[(WINDOW_Y + by_cell) * LED_WIDTH + WINDOW_X + bx];
+        const uint8_t *t = &top->r, *b = &bottom->r, *f = &full->r;
+        for (int ch = 0; ch < 3; ch++) {
+            int sum = t[ch] + b[ch];
+            int tolerance = 2 + f[ch] / 32;
+            if (abs(sum - f[ch]) > tolerance) {
+                printf("FAIL %s, level %u, column %d, channel %d: %d + %d = %d, full cell %d\n",
+                       piece->name, (unsigned)level, bx, ch, t[ch], b[ch], sum, f[ch]);
+                host_test_failures++;
+            }
+        }
+    }
+}
+
+// ============================================================================
+// GOLDEN FILE
+// ============================================================================
+
+static int run_cases(FILE *golden, FILE *update) {
+    int cases = 0;
+    char lines[WINDOW_H + 1][LINE_LEN];
+    char expected[LINE_LEN];
+
+    for (size_t p = 0; p < sizeof(s_pieces) / sizeof(s_pieces[0]); p++) {
+        render_case(&s_pieces[p], 0);
+        memcpy(s_full, s_capture.frame, sizeof(s_full));
+
+        for (size_t l = 0; l < sizeof(s_levels); l++) {
+            render_case(&s_pieces[p], s_levels[l]);
+            format_case(&s_pieces[p], s_levels[l], lines);
+            check_light_sum(&s_pieces[p], s_levels[l]);
+            cases++;
+
+            for (int k = 0; k <= WINDOW_H; k++) {
+                if (update) {
+                    fprintf(update, "%s\n", lines[k]);
+                    continue;
+                }
+                if (fgets(expected, sizeof(expected), golden) == NULL) {
+                    printf("FAIL golden file ends before '%s'\n", lines[0]);
+                    host_test_failures++;
+                    return cases;
+                }
+                expected[strcspn(expected, "\n")] = '\0';
+                if (strcmp(expected, lines[k]) != 0) {
+                    printf("FAIL %s\n  expected %s\n  got      %s\n", lines[0], expected, lines[k]);
+                    host_test_failures++;
+                }
+            }
+            if (update) fprintf(update, "\n");
+            else if (fgets(expected, sizeof(expected), golden) == NULL) expected[0] = '\0';
+        }
+    }
+    return cases;
+}
+
+int main(int argc, char **argv) {
+    bool update = argc > 1 && strcmp(argv[1], "--update") == 0;
+
+    compositor_init();
+    subcell_init();                 // Host-sdkconfig ohne CONFIG_TETRIS_SUBCELL_RENDER
+    post_set_brightness(255);
+    post_set_dither(false);
+    capture_sink_register();
+
+    FILE *file = fopen(SUBCELL_GOLDEN_PATH, update ? "w" : "r");
+    if (file == NULL) {
+        printf("FAIL cannot open %s\n", SUBCELL_GOLDEN_PATH);
+        return 1;
+    }
+    int cases = run_cases(update ? NULL : file, update ? file : NULL);
+    fclose(file);
+
+    power_stats_t power;
+    power_limit_get_stats(&power);
+    CHECK_EQ(power.limited_frames, 0);  // Sonst wären die Frames skaliert
+
+    if (update) printf("Wrote %d cases to %s\n", cases, SUBCELL_GOLDEN_PATH);
+    return HOST_TEST_RESULT();
+}
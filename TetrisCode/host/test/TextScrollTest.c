@@ -0,0 +1,163 @@
+/**
+ * @file TextScrollTest.c
+ * @brief Spalten-Bitmaps, Abschneiden und Schritt-Zeitplan des Lauftexts (TextScroll.c)
+ *
+ * Die Spalten werden gegen font3x5_glyph() des erwarteten Strings geprüft
+ * (Glyph-Spalten plus eine leere Spalte je Zeichen). Gezeichnet wird über
+ * die Capture-Senke; nur wenige Pixel sind an, das Stromlimit greift nie.
+ */
+
+#include "HostTest.h"
+#include "CaptureSink.h"
+#include "TextScroll.h"
+#include "Compositor.h"
+#include "PostProcess.h"
+#include "Globals.h"
+#include <string.h>
+
+#define STEP_MS 50
+#define TEXT_ROW 8
+
+static text_scroll_t s_ts;
+
+/** @brief Spalten von ts mit dem gesetzten Text expected vergleichen */
+static void check_cols(int line, const text_scroll_t *ts, const char *expected) {
+    int n = (int)strlen(expected);
+    if (ts->width != n * (FONT3X5_W + 1)) {
+        printf("FAIL line %d: width %u, expected %d for \"%s\"\n", line, (unsigned)ts->width,
+               n * (FONT3X5_W + 1), expected);
+        host_test_failures++;
+        return;
+    }
+    for (int i = 0; i < n; i++) {
+        const uint8_t *glyph = font3x5_glyph(expected[i]);
+        const uint8_t *cols = &ts->cols[i * (FONT3X5_W + 1)];
+        if (memcmp(cols, glyph, FONT3X5_W) != 0 || cols[FONT3X5_W] != 0) {
+            printf("FAIL line %d: char %d of \"%s\" does not match the font\n", line, i, expected);
+            host_test_failures++;
+            return;
+        }
+    }
+}
+
+#define CHECK_COLS(ts, expected) check_cols(__LINE__, ts, expected)
+
+static void test_numbers(void) {
+    const pixel_rgb_t white = { 100, 100, 100 };
+    text_scroll_init(&s_ts, LAYER_OVERLAY, TEXT_ROW, white, STEP_MS);
+
+    text_scroll_append_number(&s_ts, 0);
+    CHECK_COLS(&s_ts, "0");
+
+    text_scroll_clear(&s_ts);
+    text_scroll_append_number(&s_ts, UINT32_MAX);
+    CHECK_COLS(&s_ts, "4294967295");
+
+    text_scroll_clear(&s_ts);
+    text_scroll_append_number(&s_ts, 1000000000u);  // Nullen innerhalb der Zahl
+    CHECK_COLS(&s_ts, "1000000000");
+
+    text_scroll_clear(&s_ts);
+    text_scroll_append(&s_ts, "Lv ");
+    text_scroll_append_number(&s_ts, 7);
+    text_scroll_append(&s_ts, " $&");
+    CHECK_COLS(&s_ts, "LV 7 $&");
+}
+
+static void test_truncation(void) {
+    const int max_chars = TEXT_SCROLL_MAX_COLS / (FONT3X5_W + 1);
+    char text[TEXT_SCROLL_MAX_COLS];
+    for (int i = 0; i < max_chars - 1; i++) text[i] = (char)('A' + i % 26);
+    text[max_chars - 1] = '\0';
+
+    // Eine Zahl am Ende: nur ganze Zeichen, bis die Spalten voll sind
+    text_scroll_clear(&s_ts);
+    text_scroll_append(&s_ts, text);
+    text_scroll_append_number(&s_ts, 987);
+    CHECK_EQ(s_ts.width, TEXT_SCROLL_MAX_COLS);
+    text[max_chars - 1] = '9';
+    text[max_chars] = '\0';
+    CHECK_COLS(&s_ts, text);
+
+    text_scroll_append(&s_ts, "XYZ");
+    text_scroll_append_number(&s_ts, 1);
+    CHECK_EQ(s_ts.width, TEXT_SCROLL_MAX_COLS);
+    CHECK_COLS(&s_ts, text);
+}
+
+static void test_timing(void) {
+    const pixel_rgb_t white = { 100, 100, 100 };
+    const int64_t step_us = STEP_MS * 1000;
+    int64_t t0 = 1234567;           // Nicht auf step_us ausgerichtet
+
+    text_scroll_init(&s_ts, LAYER_OVERLAY, TEXT_ROW, white, STEP_MS);
+    CHECK_EQ(text_scroll_next_us(&s_ts), INT64_MAX);   // Leer: nichts zu tun
+    CHECK(!text_scroll_advance(&s_ts, t0));
+
+    text_scroll_set_text(&s_ts, "HI", t0);
+    CHECK_EQ(text_scroll_next_us(&s_ts), t0 + step_us);
+    CHECK(text_scroll_advance(&s_ts, t0));             // Erste Spalte sofort
+    CHECK(!text_scroll_advance(&s_ts, t0 + step_us - 1));
+    CHECK_EQ(text_scroll_next_us(&s_ts), t0 + step_us);
+    CHECK(text_scroll_advance(&s_ts, t0 + step_us));
+
+    // Verspäteter Aufruf: nächster Schritt bleibt auf dem Raster ab dem Start
+    CHECK(text_scroll_advance(&s_ts, t0 + 3 * step_us + 23000));
+    CHECK_EQ(s_ts.last_col, 3);
+    CHECK_EQ(text_scroll_next_us(&s_ts), t0 + 4 * step_us);
+
+    // Nach Breite + LED_WIDTH Spalten beginnt der Text wieder rechts
+    int64_t cycle = (int64_t)(s_ts.width + LED_WIDTH) * step_us;
+    CHECK(text_scroll_advance(&s_ts, t0 + cycle - 1));
+    CHECK_EQ(s_ts.last_col, s_ts.width + LED_WIDTH - 1);
+    CHECK(text_scroll_advance(&s_ts, t0 + cycle));
+    CHECK_EQ(s_ts.last_col, 0);
+    CHECK_EQ(text_scroll_next_us(&s_ts), t0 + cycle + step_us);
+
+    text_scroll_erase(&s_ts);
+}
+
+static void test_render(void) {
+    const pixel_rgb_t white = { 100, 100, 100 };
+    const int64_t step_us = STEP_MS * 1000;
+    const int k = LED_WIDTH + 2;    // Textspalte 0 steht bei x = 2
+
+    compositor_reset();
+    text_scroll_init(&s_ts, LAYER_OVERLAY, TEXT_ROW, white, STEP_MS);
+    text_scroll_set_text(&s_ts, "T7", 0);
+    CHECK(text_scroll_advance(&s_ts, k * step_us));
+    compositor_commit();
+    compositor_present();
+
+    for (int x = 0; x < LED_WIDTH; x++) {
+        int src = k - (LED_WIDTH - x);
+        uint8_t bits = (src >= 0 && src < s_ts.width) ? s_ts.cols[src] : 0;
+        for (int y = 0; y < FONT3X5_H; y++) {
+            bool lit = captured(TEXT_ROW + y, x)->r != 0;
+            if (lit != (bool)(bits & (1u << y))) {
+                printf("FAIL pixel (%d,%d) %s\n", TEXT_ROW + y, x, lit ? "lit" : "dark");
+                host_test_failures++;
+            }
+        }
+    }
+    CHECK(captured(TEXT_ROW, 2)->r != 0);               // Oberer Balken des 'T'
+    CHECK(captured(TEXT_ROW - 1, 2)->r == 0);           // Nur die eigenen Zeilen
+
+    text_scroll_erase(&s_ts);
+    compositor_commit();
+    compositor_present();
+    CHECK(captured(TEXT_ROW, 2)->r == 0);
+}
+
+int main(void) {
+    compositor_init();
+    post_set_brightness(255);
+    post_set_dither(false);
+    capture_sink_register();
+
+    test_numbers();
+    test_truncation();
+    test_timing();
+    test_render();
+    return HOST_TEST_RESULT();
+}
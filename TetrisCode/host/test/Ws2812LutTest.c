@@ -0,0 +1,120 @@
+/**
+ * @file Ws2812LutTest.c
+ * @brief Symbolstrom des LUT-Encoders gegen die Bit-für-Bit Referenz
+ *
+ * Der RMT-Treiber ruft ws2812_lut_encode() mit wechselnd viel freiem Platz auf,
+ * bis *done gesetzt ist. Das wird hier mit verschiedenen Blockgrößen (auch
+ * genau ein Byte, sodass das Reset-Symbol in einen eigenen Aufruf fällt)
+ * nachgestellt. Erwartet wird exakt der Strom, den der Bytes-Encoder liefern
+ * würde: pro Bit ws2812_bit_symbol(), MSB zuerst, danach ws2812_reset_symbol().
+ */
+
+#include "HostTest.h"
+#include "Ws2812Lut.h"
+#include "Globals.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define FRAME_BYTES (LED_STRIP_NUM_LEDS * 3)
+
+static rmt_symbol_word_t s_lut_stream[WS2812_FRAME_SYMBOLS(FRAME_BYTES)];
+static rmt_symbol_word_t s_ref_stream[WS2812_FRAME_SYMBOLS(FRAME_BYTES)];
+
+/**
+ * @brief Referenz: jedes Bit einzeln (wie der Bytes-Encoder von led_strip)
+ */
+static size_t encode_reference(const uint8_t *bytes, size_t n, rmt_symbol_word_t *out) {
+    size_t k = 0;
+    for (size_t i = 0; i < n; i++) {
+        for (int bit = 7; bit >= 0; bit--) {
+            out[k++] = ws2812_bit_symbol((bytes[i] >> bit) & 1);
+        }
+    }
+    out[k++] = ws2812_reset_symbol();
+    return k;
+}
+
+/**
+ * @brief Wie der RMT Simple-Encoder: Callback mit höchstens chunk freien Symbolen, bis done
+ */
+static size_t encode_lut(const uint8_t *bytes, size_t n, size_t chunk, rmt_symbol_word_t *out) {
+    size_t written = 0;
+    bool done = false;
+    size_t capacity = WS2812_FRAME_SYMBOLS(n);
+
+    while (!done) {
+        size_t free_symbols = capacity - written < chunk ? capacity - written : chunk;
+        size_t got = ws2812_lut_encode(bytes, n, written, free_symbols, &out[written], &done, NULL);
+        if (got == 0 && !done) {
+            printf("FAIL chunk %zu: encoder stalled at %zu symbols\n", chunk, written);
+            host_test_failures++;
+            break;
+        }
+        CHECK(got <= free_symbols);
+        written += got;
+    }
+    return written;
+}
+
+static void compare_streams(const uint8_t *bytes, size_t n, size_t chunk, const char *what) {
+    memset(s_lut_stream, 0xEE, sizeof(s_lut_stream));
+    size_t ref_len = encode_reference(bytes, n, s_ref_stream);
+    size_t lut_len = encode_lut(bytes, n, chunk, s_lut_stream);
+
+    CHECK_EQ(ref_len, WS2812_FRAME_SYMBOLS(n));
+    CHECK_EQ(lut_len, ref_len);
+    for (size_t i = 0; i < ref_len && i < lut_len; i++) {
+        if (s_lut_stream[i].val != s_ref_stream[i].val) {
+            printf("FAIL %s, chunk %zu: symbol %zu is %08x, expected %08x\n",
+                   what, chunk, i, (unsigned)s_lut_stream[i].val, (unsigned)s_ref_stream[i].val);
+            host_test_failures++;
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Referenz-Symbole selbst gegen das WS2812 Datenblatt-Timing (10 MHz Ticks)
+ */
+static void test_reference_timing(void) {
+    rmt_symbol_word_t zero = ws2812_bit_symbol(false);
+    rmt_symbol_word_t one = ws2812_bit_symbol(true);
+    rmt_symbol_word_t reset = ws2812_reset_symbol();
+
+    CHECK_EQ(zero.level0, 1);
+    CHECK_EQ(zero.duration0, 3);    // 0.3 us high
+    CHECK_EQ(zero.level1, 0);
+    CHECK_EQ(zero.duration1, 9);    // 0.9 us low
+    CHECK_EQ(one.level0, 1);
+    CHECK_EQ(one.duration0, 9);
+    CHECK_EQ(one.level1, 0);
+    CHECK_EQ(one.duration1, 3);
+    CHECK_EQ(reset.level0, 0);
+    CHECK_EQ(reset.level1, 0);
+    CHECK_EQ(reset.duration0 + reset.duration1, 500);  // 50 us low
+}
+
+int main(void) {
+    test_reference_timing();
+
+    // Alle Bytewerte einmal, dann ein zufälliger ganzer Frame
+    uint8_t all_values[256];
+    for (int i = 0; i < 256; i++) all_values[i] = (uint8_t)i;
+
+    static uint8_t frame[FRAME_BYTES];
+    srand(12345);
+    for (size_t i = 0; i < sizeof(frame); i++) frame[i] = (uint8_t)rand();
+
+    static const size_t chunks[] = { 8, 9, 15, 48, 64, 1000, WS2812_FRAME_SYMBOLS(FRAME_BYTES) };
+    for (size_t c = 0; c < sizeof(chunks) / sizeof(chunks[0]); c++) {
+        compare_streams(all_values, sizeof(all_values), chunks[c], "all byte values");
+        compare_streams(frame, sizeof(frame), chunks[c], "random frame");
+    }
+
+    // Randfälle: ein Byte, leere Übertragung (nur Reset)
+    uint8_t single = 0xA5;
+    compare_streams(&single, 1, 8, "single byte");
+    compare_streams(&single, 0, 8, "empty frame");
+
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,83 @@
+#ifndef ANIM_H
+#define ANIM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "Compositor.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// ANIM - Sprite- und Keyframe-Animationen als Daten, nicht-blockierend
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// Sprite:   w x h Pixel, zeilenweise RLE. Ein Byte pro Lauf: ANIM_RUN(n, c) = n Pixel (1..32)
+//           mit Palettenindex c (0 = transparent, 1..7 = palette[c - 1]). Sprites, Keyframes
+//           und Clips sind const und liegen damit im Flash (.rodata). ASCII-Art → RLE:
+//           tools/anim_rle.py
+// Keyframe: Sprite (NULL = leer), Dauer, Überblendung vom vorherigen Keyframe und eine lineare
+//           Bewegung (x0,y0) → (x1,y1) relativ zum Ursprung über die Dauer (ganze Zellen).
+//           Beim Überblenden zählt transparent als schwarz; erst danach wird die Ebene frei.
+// Clip:     Keyframe-Folge, loops Durchläufe (0 = endlos). hold_last: letzter Frame bleibt nach
+//           dem Ende stehen, sonst wird die Fläche in der Ebene wieder freigegeben.
+// Player:   Zustand einer laufenden Animation in einer Compositor-Ebene (gehört dem Aufrufer).
+//
+// anim_advance() zeichnet nur, wenn sich Keyframe, Position oder Blend-Gewicht geändert haben;
+// anim_next_us() liefert den Zeitpunkt der nächsten Änderung (Scheduler-Deadline, beim
+// Überblenden im Render-Takt). Der Aufrufer committet (led_strip_semaphore).
+
+#define ANIM_RUN(n, c)   ((uint8_t)((((n) - 1) << 3) | (c)))
+#define ANIM_RUN_MAX     32
+
+typedef struct {
+    uint8_t w, h;
+    const uint8_t *rle;
+    uint16_t rle_len;
+    const pixel_rgb_t *palette;     // Einträge für Index 1..7
+} anim_sprite_t;
+
+typedef struct {
+    const anim_sprite_t *sprite;    // NULL = leerer Frame
+    uint16_t hold_ms;               // Dauer inkl. Überblendung
+    uint16_t blend_ms;              // 0 = harter Schnitt
+    int8_t y0, x0;                  // Position am Anfang ...
+    int8_t y1, x1;                  // ... und am Ende des Keyframes
+} anim_key_t;
+
+typedef struct {
+    const anim_key_t *keys;
+    uint8_t key_count;
+    uint8_t loops;                  // 0 = endlos
+    bool hold_last;
+} anim_clip_t;
+
+typedef struct {
+    const anim_clip_t *clip;
+    layer_id_t layer;
+    int16_t oy, ox;                 // Ursprung in der Matrix
+    uint8_t key;
+    uint16_t loop;
+    bool running;
+    int64_t key_start_us;
+    int64_t now_us;                 // Zeit des letzten anim_advance()
+
+    // Zuletzt gezeichneter Zustand und belegte Fläche [y0,y1) x [x0,x1)
+    bool drawn;
+    uint8_t last_key;
+    int16_t last_y, last_x;
+    uint16_t last_weight;
+    int8_t fy0, fx0, fy1, fx1;
+} anim_player_t;
+
+void anim_start(anim_player_t *p, const anim_clip_t *clip, layer_id_t layer, int y, int x,
+                int64_t now_us);
+
+// Gibt die belegte Fläche frei (ohne Commit)
+void anim_stop(anim_player_t *p);
+
+// Auf now_us vorspulen und zeichnen. @return true wenn sich die Ebene geändert hat
+bool anim_advance(anim_player_t *p, int64_t now_us);
+
+bool anim_running(const anim_player_t *p);
+
+// Nächste sichtbare Änderung (INT64_MAX wenn beendet)
+int64_t anim_next_us(const anim_player_t *p);
+
+#endif // ANIM_H
@@ -0,0 +1,17 @@
+#ifndef ANIM_CLIPS_H
+#define ANIM_CLIPS_H
+
+#include "Anim.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// ANIM CLIPS - Effekte der LED-Matrix als Daten (AnimClips.c)
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// Ursprung beim anim_start(), jeweils in LAYER_OVERLAY:
+
+// Line-Clear Blinken einer Reihe: (Reihe, 0), LINE_CLEAR_BLINK_TIMES × an/aus
+extern const anim_clip_t anim_clip_line_clear;
+
+// Game Over: (0, 0), ganze Matrix GAME_OVER_BLINK_COUNT × rot/schwarz, endet schwarz
+extern const anim_clip_t anim_clip_game_over;
+
+#endif // ANIM_CLIPS_H
@@ -0,0 +1,45 @@
+#ifndef AUTOSHIFT_H
+#define AUTOSHIFT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// AUTOSHIFT - Delayed Auto-Shift (DAS) und Auto-Repeat (ARR) für die horizontale Bewegung
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// Press: sofort 1 Schritt. Nach DAS (ab Press-Zeitstempel) folgt alle ARR ein weiterer Schritt.
+// Die Schritt-Zeitpunkte hängen nur an den Flanken-Zeitstempeln, nicht an der Verarbeitungszeit.
+// Zuletzt gedrückte Richtung gewinnt; Loslassen schaltet auf die noch gehaltene Richtung zurück.
+
+#define AUTOSHIFT_LEFT   (-1)
+#define AUTOSHIFT_RIGHT  (1)
+
+typedef struct {
+    int64_t das_us;         // Verzögerung bis zur ersten Wiederholung
+    int64_t arr_us;         // Abstand der Wiederholungen (min. 1ms)
+    bool held_left;
+    bool held_right;
+    int dir;                // Aktive Richtung (AUTOSHIFT_LEFT/RIGHT) oder 0
+    int64_t start_us;       // Press-Zeitpunkt der aktiven Richtung
+    uint32_t steps_done;    // Bereits ausgeführte Schritte seit start_us
+} autoshift_t;
+
+void autoshift_init(autoshift_t *s, int64_t das_us, int64_t arr_us);
+
+// Alle gehaltenen Richtungen vergessen (z.B. beim Spielstart)
+void autoshift_reset(autoshift_t *s);
+
+// Flanken aus dem Input-Event-Ring (controls_poll(), input_event_t.timestamp_us)
+void autoshift_press(autoshift_t *s, int dir, int64_t t_us);
+void autoshift_release(autoshift_t *s, int dir, int64_t t_us);
+
+// Anzahl der bis now_us fälligen Schritte (max. max_steps) in autoshift_direction()
+int autoshift_take(autoshift_t *s, int64_t now_us, int max_steps);
+
+// Aktive Richtung oder 0
+int autoshift_direction(const autoshift_t *s);
+
+// Zeitpunkt des nächsten fälligen Schritts (INT64_MAX wenn keine Richtung aktiv)
+int64_t autoshift_next_us(const autoshift_t *s);
+
+#endif // AUTOSHIFT_H
@@ -0,0 +1,69 @@
+#ifndef BIN_LOG_H
+#define BIN_LOG_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "LogCatalog.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// BINLOG - Verzögertes binäres Logging für Hot Paths (ersetzt printf im Frame)
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// BLOG(LOG_ID, a, b, c) schreibt einen 24-Byte Record (ID, Zeitstempel, bis zu 3 int32) in den
+// lock-freien Ring des aktuellen Cores (Multi-Producer: Tasks + ISRs, ein Consumer). Ein
+// Drain-Task mit niedriger Priorität formatiert die Records über LogCatalog.h, oder gibt sie
+// als Hex aus (CONFIG_TETRIS_BINLOG_HEX) zum Dekodieren auf dem Host (tools/binlog_decode.py).
+// Ring voll → Record wird verworfen und gezählt (Hot Path blockiert nie).
+
+// Records pro Core-Ring (Zweierpotenz)
+#define BINLOG_RING_SIZE  128
+#define BINLOG_MAX_ARGS   3
+
+_Static_assert((BINLOG_RING_SIZE & (BINLOG_RING_SIZE - 1)) == 0, "BinLog.c indexes with SIZE - 1 as mask");
+
+typedef struct {
+    uint32_t seq;                   // Slot-Sequenz (intern: frei/belegt), im Dump = Position+1
+    uint16_t id;                    // log_id_t
+    uint8_t core;
+    uint8_t reserved;
+    uint32_t timestamp_us;          // Untere 32 Bit von clock_now_us()
+    int32_t args[BINLOG_MAX_ARGS];
+} binlog_record_t;
+
+typedef struct {
+    binlog_record_t slots[BINLOG_RING_SIZE];
+    uint32_t head;                  // Nächste Schreibposition (Producer, CAS)
+    uint32_t tail;                  // Nächste Leseposition (nur Consumer)
+    uint32_t written;               // Statistik
+    uint32_t dropped;               // Statistik: Ring voll
+} binlog_ring_t;
+
+typedef struct {
+    uint32_t written;
+    uint32_t dropped;
+} binlog_stats_t;
+
+// Ring (reine Logik, Host-kompilierbar)
+void binlog_ring_init(binlog_ring_t *r);
+bool binlog_ring_push(binlog_ring_t *r, uint16_t id, uint8_t core, uint32_t timestamp_us,
+                      int32_t a0, int32_t a1, int32_t a2);
+bool binlog_ring_peek(const binlog_ring_t *r, binlog_record_t *out);
+bool binlog_ring_pop(binlog_ring_t *r, binlog_record_t *out);
+
+// Logging (Task- und ISR-sicher, blockiert nie)
+void binlog_write(uint16_t id, int32_t a0, int32_t a1, int32_t a2);
+
+// BLOG(LOG_ID) ... BLOG(LOG_ID, a, b, c): fehlende Argumente werden 0
+#define BLOG(...) BLOG_(__VA_ARGS__, 0, 0, 0, 0)
+#define BLOG_(id, a0, a1, a2, ...) \
+    binlog_write((uint16_t)(id), (int32_t)(a0), (int32_t)(a1), (int32_t)(a2))
+
+// Record als Text formatieren (Drain-Task, Konsole)
+int binlog_format(const binlog_record_t *rec, char *buf, int size);
+
+// Drain-Task starten (einmal aus app_main, vor dem ersten BLOG im Betrieb)
+void binlog_start(void);
+
+// Summe über alle Core-Ringe
+void binlog_get_stats(binlog_stats_t *out);
+
+#endif // BIN_LOG_H
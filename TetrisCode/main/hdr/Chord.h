@@ -0,0 +1,55 @@
+#ifndef CHORD_H
+#define CHORD_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "InputRing.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// CHORD - Nicht-blockierende Erkennung von Tastenkombinationen (gehalten für hold_us)
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// Eine Kombination ist aktiv, wenn GENAU ihre Buttons gehalten werden. Loslassen eines
+// Buttons oder ein zusätzlicher Button vor Ablauf der Haltezeit bricht ab (kein Fehlauslösen).
+// Nach dem Auslösen muss die Kombination erst gelöst werden, bevor sie erneut auslöst.
+
+typedef enum {
+    CHORD_ACTION_NONE = 0,
+    CHORD_ACTION_SONG_NEXT,
+    CHORD_ACTION_RESET,
+} chord_action_t;
+
+#define CHORD_MASK(button)  (1u << (button))
+
+typedef struct {
+    uint8_t mask;               // CHORD_MASK(...) | CHORD_MASK(...)
+    int64_t hold_us;            // Haltezeit bis zum Auslösen
+    chord_action_t action;
+} chord_def_t;
+
+typedef struct {
+    const chord_def_t *defs;
+    int num_defs;
+    uint8_t held_mask;          // Aktuell gehaltene Buttons (aus den Events)
+    int candidate;              // Index in defs oder -1
+    int64_t since_us;           // Zeitpunkt, seit dem candidate komplett gehalten wird
+    bool fired;                 // candidate hat bereits ausgelöst
+} chord_recognizer_t;
+
+void chord_init(chord_recognizer_t *r, const chord_def_t *defs, int num_defs);
+
+// Alle gehaltenen Buttons vergessen (z.B. nach Reset)
+void chord_reset(chord_recognizer_t *r);
+
+// Press-/Release-Event einspeisen
+void chord_feed(chord_recognizer_t *r, const input_event_t *ev);
+
+// Liefert die Aktion genau einmal, sobald die Haltezeit bis now_us erreicht ist
+chord_action_t chord_poll(chord_recognizer_t *r, int64_t now_us);
+
+// true solange eine Kombination gehalten wird, aber noch nicht ausgelöst hat
+bool chord_pending(const chord_recognizer_t *r);
+
+// Zeitpunkt, an dem die gehaltene Kombination auslöst (INT64_MAX wenn keine)
+int64_t chord_deadline_us(const chord_recognizer_t *r);
+
+#endif // CHORD_H
@@ -0,0 +1,50 @@
+#ifndef CLOCK_H
+#define CLOCK_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// CLOCK - Zentrale Zeitquelle für alle Module (Spiel, Controls, Splash, Scheduler)
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// Zwei Backends:
+// - REAL:    esp_timer (µs) + vTaskDelay (auf volle Ticks aufgerundet, nie 0 Ticks)
+// - VIRTUAL: Zeit läuft nur durch clock_sleep_*() / clock_advance_*() → sofortiges Vorspulen,
+//            exakt reproduzierbare Zeitstempel (Host-Simulation, Timing-Tests)
+// Zufall gehört mit zur Zeitquelle: REAL nutzt esp_random(), VIRTUAL einen seedbaren PRNG,
+// damit ein Simulationslauf mit gleichem Seed dieselbe Blockfolge liefert.
+
+// Backend-Schnittstelle (eigene Backends können per clock_set_backend() gesetzt werden)
+typedef struct {
+    int64_t (*now_us)(void);        // Monotone Zeit in µs
+    void (*sleep_us)(int64_t us);   // Aufrufenden Task mindestens us schlafen lassen
+    uint32_t (*random)(void);       // 32 Bit Zufall (NULL → esp_random())
+    const char *name;
+} clock_backend_t;
+
+// Aktuelle Zeit
+int64_t clock_now_us(void);
+uint32_t clock_now_ms(void);
+
+// Schlafen (REAL: blockiert Task, VIRTUAL: springt sofort vorwärts)
+void clock_sleep_us(int64_t us);
+void clock_sleep_ms(uint32_t ms);
+
+// Zufall aus dem aktiven Backend (Seed wirkt nur auf VIRTUAL, 0 wird ersetzt)
+uint32_t clock_random(void);
+void clock_seed_random(uint32_t seed);
+
+// Backend wählen
+void clock_use_real(void);
+void clock_use_virtual(int64_t start_us);
+void clock_set_backend(const clock_backend_t *backend);
+bool clock_is_virtual(void);
+
+// Echtzeit in µs unabhängig vom Backend (z.B. um bei VIRTUAL anderen Tasks Zeit zu lassen)
+int64_t clock_wall_us(void);
+
+// Nur VIRTUAL: Zeit manuell vorspulen (ignoriert bei REAL)
+void clock_advance_us(int64_t us);
+void clock_advance_to(int64_t target_us);
+
+#endif // CLOCK_H
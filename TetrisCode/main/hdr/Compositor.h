@@ -0,0 +1,62 @@
+#ifndef COMPOSITOR_H
+#define COMPOSITOR_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "Globals.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// COMPOSITOR - Ebenen mit Dirty-Bitmasken → Frame-Senken (FrameSink.h)
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// Jede Ebene hält pro Matrix-Pixel (y,x) eine Farbe und ein Deckend-Bit. Sichtbar ist die
+// oberste deckende Ebene, sonst schwarz. Jede Änderung setzt das Bit des Pixels in der
+// 384-Bit Dirty-Maske der Ebene; compositor_commit() setzt nur diese Pixel neu zusammen und
+// schreibt davon nur die, deren Ergebnis sich geändert hat, in den Ausgabe-Frame.
+//
+// Ebenen werden nur vom GameLoop-Task verändert. Aufrufer hält led_strip_semaphore für
+// compositor_commit() und compositor_present() (gibt den Frame an die Senken, z.B. den Strip).
+
+typedef enum {
+    LAYER_BACKGROUND = 0,   // Splash-Design
+    LAYER_LOCKED,           // Fixierte Blöcke (grid[][])
+    LAYER_GHOST,            // Landeposition des aktiven Blocks (GHOST_PIECE_ENABLED)
+    LAYER_ACTIVE,           // Fallender Block
+    LAYER_OVERLAY,          // Blinken (Line-Clear, Game Over), Lauftext
+    LAYER_COUNT
+} layer_id_t;
+
+#define COMPOSITOR_PIXELS      (LED_WIDTH * LED_HEIGHT)
+#define COMPOSITOR_MASK_WORDS  (COMPOSITOR_PIXELS / 32)
+
+typedef struct {
+    uint8_t r, g, b;
+} pixel_rgb_t;
+
+// Alle Ebenen leer, Ausgabe-Cache schwarz (Strip muss gelöscht sein). Nach LedMatrixInit().
+void compositor_init(void);
+
+// Alle Ebenen leer (betroffene Pixel werden beim nächsten Commit schwarz)
+void compositor_reset(void);
+
+void compositor_set(layer_id_t layer, int y, int x, uint8_t r, uint8_t g, uint8_t b);
+// Blockfarbe aus der Palette (einmal vorberechnet: Design-Wert mit CONFIG_TETRIS_POSTPROCESS,
+// sonst mit BRIGHTNESSDIV und GAME_BRIGHTNESS_SCALE)
+void compositor_set_block(layer_id_t layer, int y, int x, uint8_t block_index);
+const pixel_rgb_t *compositor_block_color(uint8_t block_index);
+void compositor_clear(layer_id_t layer, int y, int x);
+void compositor_clear_layer(layer_id_t layer);
+void compositor_fill_layer(layer_id_t layer, uint8_t r, uint8_t g, uint8_t b);
+
+// Geänderte Pixel zusammensetzen und in den Ausgabe-Frame schreiben.
+// @return Anzahl der tatsächlich geschriebenen Pixel
+int compositor_commit(void);
+
+// Wie compositor_commit(), für Frames im festen Render-Takt: nur hier wird zeitlich gedithert
+// (bei langsamen Einzelbildern wie Blinken oder Splash würde Dithering flackern)
+int compositor_commit_frame(void);
+
+// Ausgabe-Frame mit den seit dem letzten Aufruf geänderten Pixeln an alle aktiven
+// Frame-Senken (ersetzt led_strip_refresh(); mit der Strip-Senke erst nach der Übertragung zurück)
+void compositor_present(void);
+
+#endif // COMPOSITOR_H
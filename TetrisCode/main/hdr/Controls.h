@@ -2,29 +2,47 @@
 #define CONTROLS_H
 
 #include <stdbool.h>
+#include <stdint.h>
 #include "driver/gpio.h"
 #include "Globals.h"
-// TickType_t is defined in FreeRTOS headers
-#include "freertos/FreeRTOS.h"
+#include "InputRing.h"
+
+// Input ring counters
+typedef struct {
+    uint32_t pushed;        // events written by the sampler
+    uint32_t overflows;     // events dropped because the ring was full
+    uint32_t high_water;    // max. ring fill level
+    uint32_t pending;       // events currently waiting
+} controls_stats_t;
 
 void init_controls(void);
-// Non-blocking: try to get a button event from ISR queue. Returns true if event available.
-// out_gpio will be set to the gpio number of the pressed button.
-bool controls_get_event(gpio_num_t *out_gpio);
 
-// Blocking wait for event with timeout in ticks
-bool controls_wait_event(gpio_num_t *out_gpio, TickType_t ticks_to_wait);
+// Non-blocking: next press/release event from the input ring. Returns true if an event is available.
+// This is the ONLY way to consume button events (single consumer: the GameLoop task).
+bool controls_poll(input_event_t *out_event);
+
+// Blocking: wait for the next PRESS (release events are consumed). timeout_us < 0 waits forever.
+bool controls_wait_press(input_event_t *out_event, int64_t timeout_us);
+
+// Discard all pending events
+void controls_flush(void);
 
-// Deprecated: polling helper (kept for compatibility)
-bool check_button_pressed(gpio_num_t gpio);
+// Debounced held state (current sampler state, does not consume events)
+bool controls_is_held(button_id_t button);
 
-// Returns true if all defined buttons are currently pressed (active low)
+// Returns true if all defined buttons are currently pressed
 bool controls_all_buttons_pressed(void);
 
-// Disable ISR for all buttons (prevents new events from being queued)
-void controls_disable_isr(void);
+// Returns true if at least one button is currently pressed
+bool controls_any_button_held(void);
+
+// Synthetic edge for the stress benchmark (pushed by the sampler, not debounced, held state unchanged)
+void controls_inject(button_id_t button, input_edge_t edge);
+
+// Input ring counters (pushed / overflows / high water / pending)
+void controls_get_stats(controls_stats_t *out);
 
-// Enable ISR for all buttons
-void controls_enable_isr(void);
+// Button name for logging
+const char *controls_button_name(button_id_t button);
 
 #endif // CONTROLS_H
@@ -0,0 +1,31 @@
+#ifndef DEBOUNCE_H
+#define DEBOUNCE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// DEBOUNCE - Integrator-Entprellung für periodisch abgetastete Buttons
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// Pro Abtastung zählt der Integrator bei "gedrückt" hoch und bei "losgelassen" runter
+// (begrenzt auf 0..threshold). Der Zustand kippt erst, wenn der Integrator eine Grenze
+// erreicht. Prellen hebt sich dadurch auf, ohne dass Presses danach "blind" sind.
+
+typedef enum {
+    DEBOUNCE_EDGE_NONE = 0,
+    DEBOUNCE_EDGE_PRESS,
+    DEBOUNCE_EDGE_RELEASE,
+} debounce_edge_t;
+
+typedef struct {
+    uint8_t integrator;     // 0 = stabil losgelassen, threshold = stabil gedrückt
+    uint8_t threshold;      // Abtastungen bis zum Zustandswechsel
+    bool pressed;           // Entprellter Zustand
+} debounce_t;
+
+void debounce_init(debounce_t *d, uint8_t threshold, bool pressed);
+
+// Eine Roh-Abtastung einspeisen (true = gedrückt). Rückgabe: erzeugte Flanke
+debounce_edge_t debounce_sample(debounce_t *d, bool raw_pressed);
+
+#endif // DEBOUNCE_H
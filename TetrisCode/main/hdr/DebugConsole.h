@@ -0,0 +1,17 @@
+#ifndef DEBUG_CONSOLE_H
+#define DEBUG_CONSOLE_H
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// DEBUG CONSOLE - Diagnose-Befehle über die serielle Konsole (esp_console REPL)
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// Aktiv mit CONFIG_TETRIS_DEBUG_CONSOLE. Befehle:
+//   latency [reset]   Input-to-Photon Latenz pro Button (p50/p95/p99)
+//   input             Input-Ring Zähler
+//   prof [reset]      Laufzeit pro GameLoop-Stufe (min/mean/p99/max)
+//   sysmon            CPU pro Task, Stack-Reserven, Heap
+//   log               Zähler des binären Logs (geschrieben / verworfen)
+
+// REPL-Task starten und Befehle registrieren (einmal aus app_main)
+void debug_console_start(void);
+
+#endif // DEBUG_CONSOLE_H
@@ -2,6 +2,7 @@
 #define DISPLAY_INIT_H
 
 #include <stdint.h>
+#include <stdbool.h>
 #include "lvgl.h"
 
 extern lv_disp_t* g_disp;
@@ -9,6 +10,9 @@ extern lv_disp_t* g_disp;
 // I2C und Display initialisieren
 void display_init(void);
 
+// true wenn das OLED initialisiert ist (sonst sind alle display_* Aufrufe No-ops)
+bool display_available(void);
+
 // Score und Highscore auf dem Display anzeigen
 void display_update_score(uint32_t current_score, uint32_t highscore);
 
@@ -0,0 +1,26 @@
+#ifndef FONT_3X5_H
+#define FONT_3X5_H
+
+#include <stdint.h>
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// FONT 3x5 - Konstanter Font-Atlas für die LED-Matrix (Font3x5.c, erzeugt von tools/font3x5.py)
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// Pro Zeichen drei Spalten-Bytes, Bit y = Zeile y. Abgedeckt: ' ' bis 'Z' (Ziffern, Großbuchstaben,
+// Satzzeichen); Kleinbuchstaben werden auf Großbuchstaben abgebildet, alles andere ist leer.
+
+#define FONT3X5_W      3
+#define FONT3X5_H      5
+#define FONT3X5_FIRST  ' '
+#define FONT3X5_LAST   'Z'
+#define FONT3X5_COUNT  (FONT3X5_LAST - FONT3X5_FIRST + 1)
+
+extern const uint8_t font3x5_atlas[FONT3X5_COUNT][FONT3X5_W];
+
+static inline const uint8_t *font3x5_glyph(char c) {
+    if (c >= 'a' && c <= 'z') c = (char)(c - 'a' + 'A');
+    if (c < FONT3X5_FIRST || c > FONT3X5_LAST) c = ' ';
+    return font3x5_atlas[c - FONT3X5_FIRST];
+}
+
+#endif // FONT_3X5_H
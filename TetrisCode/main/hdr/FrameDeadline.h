@@ -0,0 +1,51 @@
+#ifndef FRAME_DEADLINE_H
+#define FRAME_DEADLINE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// FRAME DEADLINE - Überläufe des Frame-Budgets zählen und optionale Arbeit abwerfen
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// Slack = Frame-Beginn + Budget - Ende der Iteration. Negativer Slack (Überlauf) erhöht die
+// Abwurf-Stufe um eins, genug Reserve über mehrere Frames senkt sie wieder (Hysterese).
+// Die Stufen sind kumulativ: QUALITY_ELIDE_REFRESH wirft auch Blinken und HUD-Rate ab.
+
+typedef enum {
+    QUALITY_FULL = 0,           // Alles an
+    QUALITY_SKIP_BLINK,         // Line-Clear Blinken überspringen, Sub-Cell Glättung aus
+    QUALITY_SLOW_HUD,           // OLED-Score nur noch alle FRAME_SHED_HUD_INTERVAL_MS
+    QUALITY_ELIDE_REFRESH,      // Nur jeden zweiten LED-Refresh senden
+    QUALITY_LEVEL_COUNT
+} quality_level_t;
+
+typedef struct {
+    int64_t budget_us;
+    quality_level_t level;
+    uint32_t frames;
+    uint32_t overruns;
+    int32_t last_slack_us;
+    int32_t min_slack_us;
+    int64_t slack_sum_us;           // Für den Mittelwert
+    uint32_t shed_count;            // Stufe erhöht
+    uint32_t restore_count;         // Stufe gesenkt
+    uint32_t frames_since_change;   // Frames seit der letzten Stufenänderung
+    uint32_t headroom_streak;       // Aufeinanderfolgende Frames mit genug Reserve
+} frame_deadline_t;
+
+void frame_deadline_init(frame_deadline_t *fd, int64_t budget_us);
+
+// Statistik zurücksetzen (Stufe bleibt)
+void frame_deadline_reset_stats(frame_deadline_t *fd);
+
+// Ende einer Iteration auswerten.
+// Rückgabe: +1 Stufe erhöht (abwerfen), -1 Stufe gesenkt (wiederherstellen), 0 unverändert
+int frame_deadline_end(frame_deadline_t *fd, int64_t start_us, int64_t end_us);
+
+static inline bool frame_deadline_sheds(const frame_deadline_t *fd, quality_level_t level) {
+    return fd->level >= level;
+}
+
+const char *frame_deadline_level_name(quality_level_t level);
+
+#endif // FRAME_DEADLINE_H
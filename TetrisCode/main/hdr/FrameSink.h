@@ -0,0 +1,104 @@
+#ifndef FRAME_SINK_H
+#define FRAME_SINK_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include "esp_err.h"
+#include "sdkconfig.h"
+#include "led_strip.h"
+#include "Compositor.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// FRAME SINK - Ausgabe eines fertig zusammengesetzten Frames (Compositor → Strip, Datei, Terminal)
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// Der Compositor übergibt bei compositor_present() den ganzen Frame (COMPOSITOR_PIXELS, Index
+// y * LED_WIDTH + x, Werte wie sie auf die LEDs gehen) und eine Bitmaske der Pixel, die sich
+// seit dem letzten present geändert haben. Senken, die nur Änderungen übertragen, werten die
+// Maske aus; frisch aktivierte Senken bekommen einmal eine volle Maske.
+//
+// Alle registrierten und aktiven Senken bekommen jeden Frame (z.B. Strip + Shared Memory).
+// Welche Senken es gibt, legt Kconfig fest (TETRIS_SINK_*); an/aus zur Laufzeit über
+// frame_sink_request_enable() (Konsole "sink"), ausgeführt beim nächsten present im GameLoop.
+
+typedef struct frame_sink_t frame_sink_t;
+
+struct frame_sink_t {
+    const char *name;
+    esp_err_t (*present)(frame_sink_t *sink, const pixel_rgb_t *frame, const uint32_t *changed);
+    void (*del)(frame_sink_t *sink);
+
+    // Vom Register verwaltet
+    bool enabled;
+    volatile int8_t request;        // -1 = nichts, 0 = aus, 1 = an
+    bool full;                      // Nächster Frame mit voller Maske
+    uint32_t frames;
+    uint32_t errors;
+    uint32_t last_ticks;            // Profiler-Ticks (PROFILE_TICKS_PER_US)
+    uint32_t max_ticks;
+    uint64_t sum_ticks;
+};
+
+// ============================================================================
+// REGISTER
+// ============================================================================
+
+// Senke anhängen (höchstens FRAME_SINK_MAX). Vor dem ersten present, nur aus app_main.
+esp_err_t frame_sink_register(frame_sink_t *sink, bool enabled);
+
+int frame_sink_count(void);
+frame_sink_t *frame_sink_get(int index);
+frame_sink_t *frame_sink_find(const char *name);
+
+// Aus anderen Tasks: an/aus beim nächsten present
+void frame_sink_request_enable(frame_sink_t *sink, bool enabled);
+
+// Frame an alle aktiven Senken (Aufrufer hält led_strip_semaphore)
+void frame_sink_present_all(const pixel_rgb_t *frame, const uint32_t *changed);
+
+void frame_sink_print_stats(void);
+
+// Kosten pro Frame: jede registrierte Senke bekommt frames komplett neue Testbilder
+// (volle Maske), danach ist die Ausgabe schwarz. Nur mit CONFIG_TETRIS_FRAME_SINK_BENCH.
+void frame_sink_bench(int frames);
+
+// ============================================================================
+// SENKEN
+// ============================================================================
+
+// led_strip Gerät (RMT, LUT, Multi-RMT oder SPI): geänderte Pixel über ledMatrix.LED_Number
+// setzen, dann led_strip_refresh(). Der Strip muss beim Anlegen gelöscht sein.
+esp_err_t frame_sink_new_led_strip(led_strip_handle_t strip, const char *name, frame_sink_t **ret_sink);
+
+// Binäre PPM (P6), jede LED als scale × scale Block. Enthält path ein Format für die
+// Frame-Nummer (z.B. "%05u"), eine Datei pro Frame, sonst alle Frames hintereinander in einer
+// Datei (ffmpeg image2pipe).
+esp_err_t frame_sink_new_ppm(const char *path, int scale, frame_sink_t **ret_sink);
+
+// ANSI-Terminal (24-Bit Farbe, zwei Zeichen pro LED): nur geänderte Pixel per Cursor-Position,
+// höchstens alle interval_ms ein Bild (UART schafft keine 60 Frames)
+esp_err_t frame_sink_new_ansi(FILE *out, uint32_t interval_ms, frame_sink_t **ret_sink);
+
+// Shared Memory: letzter Frame mit Sequenzzähler (ungerade = wird geschrieben). Leser in
+// anderen Tasks oder Prozessen kopieren ohne Lock mit frame_shared_read().
+typedef struct {
+    volatile uint32_t seq;
+    uint16_t width;
+    uint16_t height;
+    pixel_rgb_t px[COMPOSITOR_PIXELS];
+} frame_shared_t;
+
+esp_err_t frame_sink_new_shared(frame_shared_t *shared, frame_sink_t **ret_sink);
+
+// Konsistente Kopie; @return Sequenznummer des gelesenen Frames
+uint32_t frame_shared_read(const frame_shared_t *shared, pixel_rgb_t *out);
+
+// Puffer einer Shared-Senke (z.B. über frame_sink_get()), NULL für andere Senken
+const frame_shared_t *frame_sink_shared_buffer(const frame_sink_t *sink);
+
+#if CONFIG_IDF_TARGET_LINUX
+// POSIX Shared Memory (shm_open), z.B. für einen Viewer-Prozess auf dem Host
+frame_shared_t *frame_shared_open_posix(const char *name);
+#endif
+
+#endif // FRAME_SINK_H
@@ -1,7 +1,20 @@
 #ifndef GAMELOOP_H
 #define GAMELOOP_H
 
+#include "FrameDeadline.h"
+
 // GameLoop starten (FreeRTOS Task)
 void start_game_loop(void);
 
+// Ohne Task: einmal initialisieren, dann Iteration für Iteration (Host-Simulation)
+void game_loop_init(void);
+void game_loop_step(void);
+
+// Frame-Deadline Statistik (Kopie, aus anderen Tasks) bzw. Reset am Ende der nächsten Iteration
+void game_loop_get_deadline(frame_deadline_t *out);
+void game_loop_request_deadline_reset(void);
+
+// OLED-Score in der nächsten Iteration neu zeichnen (aus anderen Tasks, z.B. StressBench)
+void game_loop_request_hud_update(void);
+
 #endif // GAMELOOP_H
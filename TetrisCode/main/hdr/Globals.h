@@ -3,6 +3,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include "sdkconfig.h"
 #include "led_strip.h"
 #include "driver/gpio.h"
 #include "freertos/FreeRTOS.h"
@@ -13,6 +14,11 @@
 //////////////////////////////////////////////////////////////////////////////////////////////////
 // LED Matrix (WS2812B) Pin
 #define LED_GPIO_PIN   GPIO_NUM_1
+// SPI-Bus für CONFIG_TETRIS_LED_DRIVER_SPI (MOSI = LED_GPIO_PIN über die GPIO-Matrix)
+#define LED_SPI_HOST   SPI2_HOST
+// Weitere Datenleitungen für CONFIG_TETRIS_LED_DRIVER_MULTI (Panelgruppe 2 und 3)
+#define LED_GPIO_PIN_2 GPIO_NUM_15
+#define LED_GPIO_PIN_3 GPIO_NUM_16
 
 // Button Pins (Pull-up, active-LOW)
 #define BTN_LEFT       GPIO_NUM_4   // Linke Bewegung
@@ -34,24 +40,84 @@
 #define LED_HEIGHT 24
 #define LED_STRIP_NUM_LEDS (LED_WIDTH * LED_HEIGHT)  // 384 LEDs total
 
+// Die Matrix besteht aus 6 verketteten 8x8 Panels (siehe MatrixNummer.c)
+#define LED_PANEL_LEDS 64
+#define LED_PANEL_COUNT (LED_STRIP_NUM_LEDS / LED_PANEL_LEDS)
+
+// Parallele Datenleitungen (LedStripMulti.c); ganze Panels pro Kanal
+#if CONFIG_TETRIS_LED_DRIVER_MULTI
+#define LED_OUTPUT_CHANNELS CONFIG_TETRIS_LED_CHANNELS
+#else
+#define LED_OUTPUT_CHANNELS 1
+#endif
+#define LED_CHANNEL_MAX_LEDS (((LED_PANEL_COUNT + LED_OUTPUT_CHANNELS - 1) / LED_OUTPUT_CHANNELS) * LED_PANEL_LEDS)
+
+// RMT TX memory per channel in symbols (ESP32-S3: 4 TX channels with 48 symbols each).
+// Buzzer and every LED channel take exactly one block so 3 LED channels + buzzer fit.
+#define RMT_MEM_BLOCK_SYMBOLS 48
+
+// WS2812B frame time: 24 bit * 1.25 us per LED + 280 us reset/latch (~11.8 ms for 384 LEDs)
+// Used to model the strip refresh (compositor_present) on the virtual clock (longest channel when parallel)
+#define LED_STRIP_FRAME_US (LED_CHANNEL_MAX_LEDS * 24 * 5 / 4 + 280)
+
+// Frames per encoder in the boot-time encoder benchmark (CONFIG_TETRIS_LED_ENCODER_BENCH)
+#define LED_ENCODER_BENCH_FRAMES 100
+
+// SPI encode throughput benchmark: strip sizes and repetitions per encoder
+#define LED_SPI_BENCH_SMALL  LED_STRIP_NUM_LEDS
+#define LED_SPI_BENCH_LARGE  4096
+#define LED_SPI_BENCH_ROUNDS 20
+
+// Frame sinks (FrameSink.c): registered outputs for the composed frame (strip + optional viewers)
+#define FRAME_SINK_MAX 6
+// ANSI terminal viewer: at most one picture per interval (a full frame is ~8 KB on the UART)
+#define FRAME_SINK_ANSI_INTERVAL_MS 250
+// LED values are dim PWM levels; the terminal shows them multiplied by this (saturating)
+#define FRAME_SINK_ANSI_GAIN 16
+// PPM writer (Linux target): file name pattern ("%u" = frame number) and pixels per LED
+#define FRAME_SINK_PPM_PATH "frames/frame_%05u.ppm"
+#define FRAME_SINK_PPM_SCALE 8
+// Shared-memory sink on the Linux target (shm_open name, see FrameSink.h)
+#define FRAME_SINK_SHM_NAME "/tetris_frame"
+// Frames per sink in the boot-time sink benchmark (CONFIG_TETRIS_FRAME_SINK_BENCH)
+#define FRAME_SINK_BENCH_FRAMES 50
+
 //////////////////////////////////////////////////////////////////////////////////////////////////
 // GAME TIMING CONFIGURATION (all in milliseconds)
 //////////////////////////////////////////////////////////////////////////////////////////////////
 // Block fall speed: how often a block falls one row (lower = faster)
 #define FALL_INTERVAL_MS 300
 
+// Lock delay: max. number of times moving/rotating a resting block restarts its lock timer
+// (the lock delay itself is defined per level in SpeedManager.c)
+#define LOCK_DELAY_MAX_RESETS 15
+
 // Render/refresh frequency: how often LEDs update (lower = smoother, ~60 FPS = 16ms)
 #define RENDER_INTERVAL_MS 16
 
-// Main loop frequency: how often input is checked (lower = more responsive, should be <= RENDER_INTERVAL_MS)
-#define LOOP_INTERVAL_MS 5
+// Scheduler: interval for the GameLoop CPU load report
+#define SCHED_LOAD_REPORT_MS 5000
+
+// Scheduler on the virtual clock: block for one tick at least this often (wall time) so IDLE
+// runs on the GameLoop core and the task watchdog stays fed
+#define SCHED_VIRTUAL_YIELD_MS 200
 
 // Splash animation duration: how long the TETRIS startup screen shows
 #define SPLASH_DURATION_MS 4000
 
-// Splash scroll delay between frames
+// Splash scroll delay between frames (one text column per step)
 #define SPLASH_SCROLL_DELAY_MS 40
 
+// Splash text: top row of the 3x5 scrolling text (TextScroll.c)
+#define SPLASH_TEXT_ROW 2
+
+// Scroll score, level and highscore through the splash only when no OLED is connected
+// (1 = always, e.g. to check the matrix text with the OLED attached)
+#define SPLASH_SCORES_WITH_OLED 0
+
+// WAIT state: ignore presses for this long after entering (and until all buttons are released)
+#define WAIT_INPUT_GUARD_MS 500
+
 //////////////////////////////////////////////////////////////////////////////////////////////////
 // I2C & OLED DISPLAY CONFIGURATION (SSD1306)
 //////////////////////////////////////////////////////////////////////////////////////////////////
@@ -80,11 +146,22 @@
 // Brightness scale for game blocks (0-255, 128 = 50%, 255 = 100%)
 #define GAME_BRIGHTNESS_SCALE 125
 
+// With CONFIG_TETRIS_POSTPROCESS all compositor colors are design values (0-255) that pass
+// through gamma and POST_BRIGHTNESS; the overlay colors below are given in that domain.
+#if CONFIG_TETRIS_POSTPROCESS
+// Brightness scale for splash text (0-255, design value ≈ block brightness)
+#define SPLASH_BRIGHTNESS_SCALE 235
+#else
 // Brightness scale for splash text (0-255)
 #define SPLASH_BRIGHTNESS_SCALE 10
+#endif
 
 // Game Over blink brightness (0-255, 50% = 0x80)
+#if CONFIG_TETRIS_POSTPROCESS
+#define GAME_OVER_BLINK_R 255
+#else
 #define GAME_OVER_BLINK_R 128
+#endif
 #define GAME_OVER_BLINK_G 0
 #define GAME_OVER_BLINK_B 0
 
@@ -97,20 +174,115 @@
 // Number of times to blink on Game Over
 #define GAME_OVER_BLINK_COUNT 3
 
+// Cross-fade at the start of each Game Over blink phase (0 = hard switch)
+#define GAME_OVER_BLINK_FADE_MS 100
+
 // Line Clear Animation Settings
 #define LINE_CLEAR_BLINK_TIMES 2
 #define LINE_CLEAR_BLINK_ON_MS 150
 #define LINE_CLEAR_BLINK_OFF_MS 150
+#if CONFIG_TETRIS_POSTPROCESS
+#define LINE_CLEAR_BLINK_R 255
+#define LINE_CLEAR_BLINK_G 255
+#define LINE_CLEAR_BLINK_B 255
+#else
 #define LINE_CLEAR_BLINK_R 128
 #define LINE_CLEAR_BLINK_G 128
 #define LINE_CLEAR_BLINK_B 128
+#endif
+// Pause after the cleared rows collapsed, before the next block spawns
+#define LINE_CLEAR_SETTLE_MS 100
+
+// Frame post-processing (PostProcess.c, CONFIG_TETRIS_POSTPROCESS):
+// output = gamma(design / 255) * POST_BRIGHTNESS, temporally dithered at the render rate.
+// POST_BRIGHTNESS 12 matches the old block peak (255 / BRIGHTNESSDIV * GAME_BRIGHTNESS_SCALE / 255)
+#define POST_GAMMA 2.2f
+#define POST_BRIGHTNESS 12
+#define POST_DITHER_DEFAULT true
+// Cycle budget for the post kernel per frame (counted in post_stats_t.over_budget)
+#define POST_BUDGET_US 200
+
+// Current limiter (PowerLimit.c, CONFIG_TETRIS_CURRENT_LIMIT): WS2812B draws ~LED_MA_PER_CHANNEL
+// per color channel at 255 plus a quiescent current per LED even when black. When the estimate
+// of the final strip values exceeds LED_CURRENT_BUDGET_MA the whole frame is scaled down.
+// Budget = 5 V / 2 A supply minus ~500 mA for the ESP32-S3, buzzer and margin.
+#define LED_MA_PER_CHANNEL 20
+#define LED_IDLE_UA_PER_LED 700
+#define LED_CURRENT_BUDGET_MA 1500
+
+// Ghost piece: landing position of the falling block, block color / GHOST_BRIGHTNESS_DIV
+#define GHOST_PIECE_ENABLED 0
+#define GHOST_BRIGHTNESS_DIV 4
 
 //////////////////////////////////////////////////////////////////////////////////////////////////
 // INPUT DEBOUNCING
 //////////////////////////////////////////////////////////////////////////////////////////////////
-// Button debounce time in milliseconds (faster block movement during game)
-// Reduced so gameplay feels more responsive and start requires shorter press
-#define BUTTON_DEBOUNCE_MS 150
+// Buttons are sampled by a periodic timer and debounced by an integrator per button:
+// a press/release is reported after BUTTON_DEBOUNCE_SAMPLES net agreeing samples (~5 ms)
+#define BUTTON_SAMPLE_PERIOD_US 1000
+#define BUTTON_DEBOUNCE_SAMPLES 5
+
+// Delayed auto-shift: hold LEFT/RIGHT this long before the block starts repeating
+#define AUTOSHIFT_DAS_MS 170
+
+// Auto-repeat rate: one cell every ARR ms after DAS (min. 1 ms)
+#define AUTOSHIFT_ARR_MS 50
+
+// Chords: how long LEFT+RIGHT (next song) / ROTATE+FASTER (emergency reset) must be held
+#define CHORD_SONG_HOLD_MS 1000
+#define CHORD_RESET_HOLD_MS 1000
+
+// Soft drop (FASTER held): one row every SOFT_DROP_INTERVAL_MS (unless the level is faster)
+#define SOFT_DROP_INTERVAL_MS 30
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// FRAME DEADLINE (FrameDeadline.c)
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// Every GameLoop iteration must finish within one render interval after its deadline
+#define FRAME_BUDGET_US ((int64_t)RENDER_INTERVAL_MS * 1000)
+
+// Shed at most one quality level per this many frames (lets the last step take effect)
+#define FRAME_SHED_HOLD_FRAMES 4
+
+// Restore one level after this many consecutive frames with at least FRAME_HEADROOM_US slack
+#define FRAME_RESTORE_FRAMES 120
+#define FRAME_HEADROOM_US 2000
+
+// While shedding the HUD: update the OLED score at most this often
+#define FRAME_SHED_HUD_INTERVAL_MS 500
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// STRESS BENCHMARK (StressBench.c, CONFIG_TETRIS_STRESS_BENCH)
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// Wait after boot (splash, WAIT input guard), then run the load for this long
+#define STRESS_BENCH_WARMUP_MS 6000
+#define STRESS_BENCH_DURATION_MS 30000
+
+// Synthetic taps (press + release after half a period) and OLED score updates (multiples of 10 ms)
+#define STRESS_BENCH_INPUT_PERIOD_MS 60
+#define STRESS_BENCH_HUD_PERIOD_MS 20
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// SYSTEM MONITOR (SysMonitor.c)
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// Sample period and rolling window length (text report once per window)
+#define SYSMON_SAMPLE_MS 1000
+#define SYSMON_WINDOW_SAMPLES 10
+
+// Warn when a task has less than this many stack bytes left (high-water mark)
+#define SYSMON_STACK_WARN_BYTES 512
+
+// Warn when the minimum-ever free heap drops below this
+#define SYSMON_HEAP_WARN_BYTES (16 * 1024)
+
+// Warn when the largest free block is less than this share of the free heap (fragmentation)
+#define SYSMON_FRAG_WARN_PERCENT 50
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// LOGGING (BinLog.c)
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// How often the drain task formats the binary log records (ring: BINLOG_RING_SIZE per core)
+#define BINLOG_DRAIN_MS 20
 
 //////////////////////////////////////////////////////////////////////////////////////////////////
 // GRID & COLLISION CONFIGURATION
@@ -0,0 +1,49 @@
+#ifndef GRAVITY_H
+#define GRAVITY_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// GRAVITY - Fallgeschwindigkeit als Bruchteil-Reihen pro Mikrosekunde mit Akkumulator
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// Geschwindigkeit im Q0.32 Format: Reihen pro µs * 2^32.
+// Der Akkumulator sammelt Bruchteile; pro Fall-Event können mehrere Reihen fällig sein.
+
+#define GRAVITY_Q32_ONE_ROW   (1ULL << 32)
+
+// Sonderwert: Block fällt sofort bis auf den Boden (20G)
+#define GRAVITY_INSTANT       UINT32_MAX
+
+// Umrechnung: eine Reihe alle interval_ms Millisekunden
+#define GRAVITY_FROM_INTERVAL_MS(ms)  ((uint32_t)(GRAVITY_Q32_ONE_ROW / ((uint64_t)(ms) * 1000)))
+
+// Umrechnung: G = Reihen pro 60Hz-Frame (16667 µs)
+#define GRAVITY_FROM_G(g)             ((uint32_t)(((uint64_t)(g) * GRAVITY_Q32_ONE_ROW) / 16667))
+
+typedef struct {
+    uint32_t rate_q32;      // Reihen pro µs (Q0.32) oder GRAVITY_INSTANT
+    uint64_t accum_q32;     // Angesammelte Reihen (Q32.32)
+    int64_t last_us;        // Zeitpunkt der letzten Akkumulation
+} gravity_state_t;
+
+// Startet die Akkumulation neu (z.B. beim Spawn), Bruchteil = 0
+void gravity_reset(gravity_state_t *g, uint32_t rate_q32, int64_t now_us);
+
+// Geschwindigkeit ändern ohne den angesammelten Bruchteil zu verlieren
+void gravity_set_rate(gravity_state_t *g, uint32_t rate_q32, int64_t now_us);
+
+// Akkumuliert bis now_us und entnimmt die ganzen Reihen (max. max_rows).
+// Rückgabe: Anzahl Reihen, um die der Block fallen soll
+int gravity_take_rows(gravity_state_t *g, int64_t now_us, int max_rows);
+
+// Verwirft den angesammelten Bruchteil (Block liegt auf / wurde bewegt)
+void gravity_clear_fraction(gravity_state_t *g, int64_t now_us);
+
+// Zeitpunkt, an dem die nächste ganze Reihe fällig ist
+int64_t gravity_next_row_us(const gravity_state_t *g, int64_t now_us);
+
+// Aktueller Bruchteil der nächsten Reihe (0..65535, für Sub-Cell Rendering)
+uint16_t gravity_fraction_q16(const gravity_state_t *g, int64_t now_us);
+
+#endif // GRAVITY_H
@@ -10,8 +10,15 @@ extern uint8_t grid[GRID_HEIGHT][GRID_WIDTH];
 
 void grid_init(void);
 bool grid_check_collision(const TetrisBlock *block);
+// Swept collision: how many rows (0..max_rows) the block can fall without colliding
+int grid_drop_distance(const TetrisBlock *block, int max_rows);
 void grid_fix_block(const TetrisBlock *block);
-void grid_clear_full_rows(void);
+
+// Line clear in steps (driven by the GameLoop CLEARING state, nothing blocks):
+// find full rows → blink them on/off (anim_clip_line_clear) → collapse (clear, pack, redraw,
+// score/speed update)
+int grid_find_full_rows(int rows_out[GRID_HEIGHT]);
+void grid_collapse_rows(const int *rows, int count);
 void grid_print(void);
 
 #endif // GRID_H
@@ -0,0 +1,55 @@
+#ifndef INPUT_RING_H
+#define INPUT_RING_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// INPUT RING - Lock-freier Single-Producer/Single-Consumer Ringpuffer für Button-Events
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// Producer: Button-Abtaster (Timer/ISR). Consumer: genau EIN Task (GameLoop).
+// head wird nur vom Producer, tail nur vom Consumer geschrieben (Acquire/Release).
+
+// Kapazität (Zweierpotenz)
+#define INPUT_RING_SIZE 32
+
+typedef enum {
+    BUTTON_LEFT = 0,
+    BUTTON_RIGHT,
+    BUTTON_ROTATE,
+    BUTTON_FASTER,
+    BUTTON_COUNT
+} button_id_t;
+
+typedef enum {
+    INPUT_EDGE_PRESS = 0,
+    INPUT_EDGE_RELEASE,
+} input_edge_t;
+
+typedef struct {
+    uint8_t button;         // button_id_t
+    uint8_t edge;           // input_edge_t
+    int64_t timestamp_us;   // Entprellte Flanke (clock_now_us Zeitbasis)
+    int64_t raw_us;         // Erste Roh-Abtastung dieses Wechsels (vor dem Entprellen)
+} input_event_t;
+
+typedef struct {
+    input_event_t buf[INPUT_RING_SIZE];
+    uint32_t head;          // Nächster Schreibindex (Producer)
+    uint32_t tail;          // Nächster Leseindex (Consumer)
+    uint32_t pushed;        // Statistik: erfolgreich geschrieben (Producer)
+    uint32_t overflows;     // Statistik: verworfen weil voll (Producer)
+    uint32_t high_water;    // Statistik: maximaler Füllstand (Producer)
+} input_ring_t;
+
+void input_ring_init(input_ring_t *r);
+
+// Producer-Seite (ISR-/Timer-sicher, blockiert nie). false = voll, Event verworfen
+bool input_ring_push(input_ring_t *r, const input_event_t *ev);
+
+// Consumer-Seite
+bool input_ring_pop(input_ring_t *r, input_event_t *out);
+uint32_t input_ring_count(const input_ring_t *r);
+void input_ring_flush(input_ring_t *r);
+
+#endif // INPUT_RING_H
@@ -0,0 +1,62 @@
+#ifndef LATENCY_TRACE_H
+#define LATENCY_TRACE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "InputRing.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// LATENCY TRACE - Input-to-Photon Latenz pro Button (Histogramm + Perzentile)
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// Ablauf pro Event:
+//   raw_us (erste Roh-Abtastung) → timestamp_us (entprellte Flanke) → mark (Spiellogik hat den
+//   Block verändert) → latched (compositor_present fertig, Frame liegt auf den LEDs)
+// Alle Zeiten in clock_now_us() Zeitbasis → funktioniert auch mit dem virtuellen Clock-Backend.
+
+// Histogramm: lineare Buckets à 250µs bis 64ms, darüber ein Overflow-Bucket
+#define LATENCY_BUCKET_US     250
+#define LATENCY_BUCKET_COUNT  256
+
+// Max. gleichzeitig auf ein Frame wartende Events
+#define LATENCY_PENDING_MAX   8
+
+typedef struct {
+    uint32_t count;
+    uint32_t buckets[LATENCY_BUCKET_COUNT + 1];   // letzter = Overflow
+    int64_t min_us;
+    int64_t max_us;
+    int64_t sum_us;
+} latency_hist_t;
+
+// Zusammenfassung pro Button (für Konsole/Logs)
+typedef struct {
+    uint32_t count;
+    int64_t min_us, max_us, mean_us;
+    int64_t p50_us, p95_us, p99_us;
+    int64_t debounce_mean_us;   // raw → entprellte Flanke
+    int64_t logic_mean_us;      // Flanke → Block verändert
+    int64_t frame_mean_us;      // Block verändert → LEDs gelatcht
+} latency_summary_t;
+
+// Histogramm (reine Logik)
+void latency_hist_reset(latency_hist_t *h);
+void latency_hist_add(latency_hist_t *h, int64_t us);
+// Perzentil in Promille (500 = p50). Obergrenze des Buckets, begrenzt auf max_us
+int64_t latency_hist_percentile(const latency_hist_t *h, uint32_t permille);
+
+// Tracer (nur vom GameLoop-Task aufgerufen)
+void latency_trace_reset(void);
+// Event hat den Block sichtbar verändert → Latenz beim nächsten latched() abschließen
+void latency_trace_mark(const input_event_t *ev, int64_t now_us);
+// Frame mit allen markierten Events liegt auf den LEDs
+void latency_trace_latched(int64_t now_us);
+// Markierte Events verwerfen (State-Wechsel vor dem nächsten Frame, z.B. Line-Clear)
+void latency_trace_discard_pending(void);
+
+// Auswertung (auch aus anderen Tasks, z.B. Konsole; Werte können ein Sample alt sein)
+bool latency_trace_summary(button_id_t button, latency_summary_t *out);
+void latency_trace_print(void);
+// Reset wird beim nächsten latched() im GameLoop-Task ausgeführt
+void latency_trace_request_reset(void);
+
+#endif // LATENCY_TRACE_H
@@ -0,0 +1,37 @@
+#ifndef LED_STRIP_LUT_H
+#define LED_STRIP_LUT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "led_strip.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// LED STRIP LUT - led_strip Gerät (RMT) mit Nibble-Tabellen-Encoder (Ws2812Lut.h)
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// Ersetzt led_strip_new_rmt_device(); danach gelten die normalen led_strip_* Funktionen.
+// Nur WS2812 / GRB, eine feste RMT-Auflösung (WS2812_RMT_RESOLUTION_HZ).
+
+typedef struct {
+    size_t mem_block_symbols;   // RMT-Speicher (0 = RMT_MEM_BLOCK_SYMBOLS)
+    bool with_dma;
+} led_strip_lut_config_t;
+
+// Encoder-Zeit im ISR (CONFIG_TETRIS_LED_ENCODER_BENCH, sonst 0)
+typedef struct {
+    uint32_t frames;
+    uint32_t callbacks;
+    uint64_t cycles;
+} led_strip_lut_stats_t;
+
+esp_err_t led_strip_new_lut_rmt_device(const led_strip_config_t *strip_config,
+                                       const led_strip_lut_config_t *lut_config,
+                                       led_strip_handle_t *ret_strip);
+
+void led_strip_lut_get_stats(led_strip_handle_t strip, led_strip_lut_stats_t *out);
+
+// Vergleich Bytes-Encoder (led_strip) ↔ LUT: CPU-Zeit im ISR pro Frame (beide auf dem GPIO
+// aus strip_config, nacheinander). Vor dem Anlegen des eigentlichen Strips aufrufen.
+void led_strip_encoder_bench(const led_strip_config_t *strip_config, int frames);
+
+#endif // LED_STRIP_LUT_H
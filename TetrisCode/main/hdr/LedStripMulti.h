@@ -0,0 +1,41 @@
+#ifndef LED_STRIP_MULTI_H
+#define LED_STRIP_MULTI_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "led_strip.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// LED STRIP MULTI - ein led_strip Gerät über mehrere parallele RMT-Kanäle
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// Die Kette aus LED_PANEL_COUNT Panels wird in Gruppen ganzer Panels aufgeteilt, jede Gruppe
+// hängt an einer eigenen Datenleitung. Indizes bleiben die der durchgehenden Kette
+// (MatrixNummer.c), set_pixel() schreibt in einen gemeinsamen GRB-Frame; refresh() startet
+// alle Kanäle gleichzeitig mit ihrem Ausschnitt und wartet auf alle → Drahtzeit / Kanäle.
+
+#define LED_MULTI_MAX_CHANNELS 3
+
+// Ausschnitt der Kette, den ein Kanal sendet
+typedef struct {
+    uint16_t first_led;
+    uint16_t num_leds;
+} led_channel_span_t;
+
+typedef struct {
+    uint8_t num_channels;
+    const int *gpio_nums;       // Datenleitung pro Kanal (num_channels Einträge)
+    uint32_t panel_leds;        // LEDs pro Panel (Kanalgrenzen nur zwischen Panels)
+} led_strip_multi_config_t;
+
+// Verteilt num_leds (ganze Panels) möglichst gleichmäßig auf channels Kanäle, vordere Kanäle
+// bekommen bei Rest ein Panel mehr. Reine Logik (Host-kompilierbar).
+// @return false bei ungültiger Aufteilung (mehr Kanäle als Panels, kein ganzes Panel, ...)
+bool led_channel_map_build(uint32_t num_leds, uint32_t panel_leds, uint8_t channels,
+                           led_channel_span_t *spans);
+
+esp_err_t led_strip_new_multi_rmt_device(const led_strip_config_t *strip_config,
+                                         const led_strip_multi_config_t *multi_config,
+                                         led_strip_handle_t *ret_strip);
+
+#endif // LED_STRIP_MULTI_H
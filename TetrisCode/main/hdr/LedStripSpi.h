@@ -0,0 +1,29 @@
+#ifndef LED_STRIP_SPI_LUT_H
+#define LED_STRIP_SPI_LUT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "led_strip.h"
+#include "driver/spi_master.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// LED STRIP SPI - led_strip Gerät auf SPI-MOSI mit Tabellen-Expansion (Ws2812Spi.h)
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// Ersetzt led_strip_new_spi_device(); danach gelten die normalen led_strip_* Funktionen.
+// set_pixel() schreibt die fertigen SPI-Bytes direkt in den DMA-fähigen Sendepuffer,
+// refresh() sendet ihn ohne weitere Umrechnung. Nur WS2812 / GRB.
+
+typedef struct {
+    spi_host_device_t spi_bus;  // Der ganze Bus ist danach belegt (nur MOSI wird genutzt)
+    bool with_dma;              // Ohne DMA max. 64 Byte pro Transfer → nur für kurze Strips
+} led_strip_spi_lut_config_t;
+
+esp_err_t led_strip_new_spi_lut_device(const led_strip_config_t *strip_config,
+                                       const led_strip_spi_lut_config_t *spi_config,
+                                       led_strip_handle_t *ret_strip);
+
+// Encode-Durchsatz Bit-Schleife ↔ Tabelle für 384 und 4096 LEDs (reine CPU, kein GPIO)
+void led_strip_spi_encode_bench(void);
+
+#endif // LED_STRIP_SPI_LUT_H
@@ -0,0 +1,37 @@
+#ifndef LOG_CATALOG_H
+#define LOG_CATALOG_H
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// LOG CATALOG - Nachrichten des binären Logs (BinLog.h)
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// Ein Eintrag pro Nachricht: X(ID, "printf-Format"). Max. 3 Argumente, alle int32 (%ld / %lu).
+// Neue Einträge nur ANHÄNGEN: die ID ist die Position in der Liste und steht so im Dump
+// (tools/binlog_decode.py liest diese Datei, um Dumps auf dem Host zu dekodieren).
+
+#define BINLOG_CATALOG(X) \
+    X(LOG_RENDER_SEM_TIMEOUT,   "[Render] Semaphore timeout, skipping frame") \
+    X(LOG_GRID_SEM_TIMEOUT,     "[Grid] ERROR: LED semaphore timeout in grid_fix_block") \
+    X(LOG_GRID_SCORE_TIMEOUT,   "[Grid] ERROR: Score semaphore timeout") \
+    X(LOG_GRID_LINES_CLEARED,   "[Grid] Cleared %ld lines!") \
+    X(LOG_SPEED_SEM_TIMEOUT,    "[SpeedManager] ERROR: Speed semaphore timeout") \
+    X(LOG_SPEED_LINES,          "[SpeedManager] Lines cleared: %lu total, Current speed: %lu ms") \
+    X(LOG_SPEED_LEVEL_UP,       "[SpeedManager] LEVEL UP! Lines: %lu, Speed: %lu ms (was %lu ms)") \
+    X(LOG_SPEED_RESET,          "[SpeedManager] Reset - Speed: %lu ms") \
+    X(LOG_INPUT_OVERFLOW,       "[Controls] WARNING: input ring full, %lu events dropped in total") \
+    X(LOG_INPUT_PRESS,          "[Event] button %ld pressed") \
+    X(LOG_SCHED_LOAD,           "[Scheduler] GameLoop CPU load: %lu.%lu%% (%lu wakeups)") \
+    X(LOG_CHORD_SONG,           "[GameLoop] Song change (LEFT + RIGHT), now song #%ld") \
+    X(LOG_CHORD_RESET,          "[GameLoop] Emergency reset triggered (ROTATE + FASTER buttons)") \
+    X(LOG_GAME_START,           "[GameLoop] Button %ld pressed, starting game!") \
+    X(LOG_FRAME_SHED,           "[Deadline] Overrun (slack %ld us) -> shedding, quality level %ld (%lu overruns)") \
+    X(LOG_FRAME_RESTORE,        "[Deadline] Headroom back (slack %ld us) -> restoring, quality level %ld") \
+    X(LOG_GRID_COLLAPSE_SEM_TIMEOUT, "[Grid] ERROR: LED semaphore timeout in grid_collapse_rows")
+
+#define BINLOG_CATALOG_ENUM(id, fmt) id,
+
+typedef enum {
+    BINLOG_CATALOG(BINLOG_CATALOG_ENUM)
+    LOG_ID_COUNT
+} log_id_t;
+
+#endif // LOG_CATALOG_H
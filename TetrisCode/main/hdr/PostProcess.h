@@ -0,0 +1,55 @@
+#ifndef POST_PROCESS_H
+#define POST_PROCESS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// POST PROCESS - Gamma, globale Helligkeit und zeitliches Dithering über den ganzen Frame
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// Eingang: Design-Farben 0..255 (Compositor-Frame, 384 x 3 Byte). Eine 256-Einträge Tabelle
+// enthält gamma(c) * Helligkeit als 8.8 Festkomma, d.h. Helligkeit ist schon eingerechnet
+// und wird nur bei post_set_brightness() neu berechnet. Mit Dithering wird der Nachkomma-
+// Anteil pro Kanal über die Frames aufsummiert (Sigma-Delta): bei 60 FPS ergibt das 8 Bit
+// zusätzliche effektive Auflösung, auch wenn die Helligkeit nur wenige LED-Stufen erlaubt.
+//
+// Kernel: 2 Kanäle pro 32-Bit Wort (SWAR, Tabelle + Fehler ≤ 0xFFFF, kein Übertrag zwischen
+// den Hälften), Skalar-Referenz für den Vergleich.
+
+#define POST_MAX_CHANNELS (384 * 3)
+
+typedef struct {
+    uint32_t frames;
+    uint32_t last_ticks;        // Dauer des letzten Kernels (profiler_now Ticks)
+    uint32_t max_ticks;
+    uint32_t over_budget;       // Frames über POST_BUDGET_US
+} post_stats_t;
+
+// Tabelle für POST_GAMMA und brightness berechnen, Fehlerspeicher löschen
+void post_init(uint8_t brightness);
+
+// Helligkeit 0..255 (= Ausgabewert für Design-Farbe 255)
+void post_set_brightness(uint8_t brightness);
+uint8_t post_get_brightness(void);
+
+void post_set_dither(bool enabled);
+bool post_get_dither(void);
+
+// Aus anderen Tasks (Konsole): wird vom Render-Pfad zu Beginn des nächsten Frames übernommen
+void post_request_brightness(uint8_t brightness);
+void post_request_dither(bool enabled);
+
+// n Kanäle (gerade Anzahl, ≤ POST_MAX_CHANNELS) von in nach out.
+// dither=false rundet (z.B. Einzelbilder langsamer Animationen, sonst Flackern).
+void post_process_frame(const uint8_t *in, uint8_t *out, size_t n, bool dither);
+
+// Skalar-Referenz mit eigenem Fehlerspeicher err (n Byte), für Vergleich (host/test)
+void post_process_reference(const uint16_t *lut, const uint8_t *in, uint8_t *out, uint8_t *err,
+                            size_t n, bool dither);
+const uint16_t *post_lut(void);
+
+void post_get_stats(post_stats_t *out);
+void post_reset_stats(void);
+
+#endif // POST_PROCESS_H
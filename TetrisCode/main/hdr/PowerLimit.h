@@ -0,0 +1,49 @@
+#ifndef POWER_LIMIT_H
+#define POWER_LIMIT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// POWER LIMIT - Stromschätzung der LED-Matrix und Skalierung auf das Netzteil-Budget
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// Modell: I = LED_IDLE_UA_PER_LED * LEDs + Summe aller Kanalwerte * LED_MA_PER_CHANNEL / 255.
+// Die Kanalsumme wird nur bei Pixeländerungen angepasst (alt abziehen, neu addieren), nie
+// neu gescannt. Liegt die Schätzung über LED_CURRENT_BUDGET_MA, wird der ganze Frame mit
+// einem 8.8 Faktor skaliert (gleichmäßig, damit Farben und Verhältnisse erhalten bleiben).
+
+#define POWER_SCALE_ONE 256
+
+typedef struct {
+    uint32_t frames;
+    uint32_t limited_frames;    // Frames mit Skalierung < 1
+    uint32_t limit_events;      // Übergänge unbegrenzt → begrenzt
+    uint32_t last_ma;           // Geschätzter Strom ohne Begrenzung
+    uint32_t peak_ma;
+    uint16_t scale;             // Aktueller Faktor (POWER_SCALE_ONE = 1.0)
+    uint16_t min_scale;
+} power_stats_t;
+
+// Kanalsumme 0 (alle LEDs aus), Statistik löschen
+void power_limit_reset(void);
+
+// Ein Pixel ändert sich von old_rgb auf new_rgb (je 3 Byte, ungeskaliert)
+void power_limit_pixel(const uint8_t *old_rgb, const uint8_t *new_rgb);
+
+// Frame-Ende: Faktor aus der aktuellen Summe (POWER_SCALE_ONE wenn innerhalb des Budgets)
+uint16_t power_limit_end_frame(void);
+
+// Skalierten Kanalwert für den Strip
+static inline uint8_t power_limit_apply(uint8_t v, uint16_t scale) {
+    return (uint8_t)((v * scale) >> 8);
+}
+
+// Geschätzter Strom in mA für eine Kanalsumme (reine Logik)
+uint32_t power_limit_estimate_ma(uint32_t channel_sum);
+
+// Aktuelle Kanalsumme (ungeskaliert), z.B. zum Vergleich mit einem vollen Scan im Test
+uint32_t power_limit_channel_sum(void);
+
+void power_limit_get_stats(power_stats_t *out);
+
+#endif // POWER_LIMIT_H
@@ -0,0 +1,89 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sdkconfig.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// PROFILER - Laufzeit pro Stufe einer GameLoop-Iteration (Zyklenzähler, feste Histogramme)
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// Zeitbasis: CPU-Zyklenzähler auf dem Gerät, clock_gettime (ns) auf dem Linux-Target.
+// Histogramm: log-lineare Buckets (4 pro Zweierpotenz, max. 25% Bucket-Breite), keine Allokation.
+// Nur aus dem GameLoop-Task aufrufen; Auswertung über Snapshot (profiler_request_snapshot).
+
+typedef enum {
+    PROFILE_STAGE_FRAME = 0,    // Gesamte Iteration (ohne Warten in scheduler_wait)
+    PROFILE_STAGE_INPUT,        // Events lesen + Chord-Erkennung
+    PROFILE_STAGE_COLLISION,    // grid_check_collision (pro Aufruf)
+    PROFILE_STAGE_SPAWN,        // spawn_block
+    PROFILE_STAGE_RENDER,       // render_grid Pixel schreiben
+    PROFILE_STAGE_REFRESH,      // compositor_present (Frame-Senken, Strip-Übertragung)
+    PROFILE_STAGE_HUD,          // OLED-Updates (gemessen an den Aufrufstellen im GameLoop)
+    PROFILE_STAGE_COUNT
+} profile_stage_t;
+
+#define PROFILE_BUCKET_COUNT 124
+
+typedef struct {
+    uint32_t count;
+    uint32_t min_ticks;
+    uint32_t max_ticks;
+    uint64_t sum_ticks;
+    uint32_t buckets[PROFILE_BUCKET_COUNT];
+} profile_hist_t;
+
+#if CONFIG_IDF_TARGET_LINUX
+#include <time.h>
+#define PROFILE_TICKS_PER_US 1000
+static inline uint32_t profiler_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec);
+}
+#else
+#include "esp_cpu.h"
+#define PROFILE_TICKS_PER_US CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ
+static inline uint32_t profiler_now(void) {
+    return (uint32_t)esp_cpu_get_cycle_count();
+}
+#endif
+
+// Dauer in Ticks eintragen (Überlauf des 32-Bit Zählers ist bei Differenzen egal)
+void profiler_record(profile_stage_t stage, uint32_t ticks);
+
+// Ende einer GameLoop-Iteration: angeforderten Snapshot/Reset ausführen
+void profiler_frame_end(void);
+
+// Aus anderen Tasks (Konsole): Snapshot anfordern, Bereitschaft prüfen, ausgeben
+void profiler_request_snapshot(void);
+bool profiler_snapshot_ready(void);
+void profiler_print_snapshot(void);
+void profiler_request_reset(void);
+
+// Histogramm (reine Logik)
+void profile_hist_reset(profile_hist_t *h);
+void profile_hist_add(profile_hist_t *h, uint32_t ticks);
+uint32_t profile_hist_percentile(const profile_hist_t *h, uint32_t permille);
+
+// Scoped Probe: misst bis zum Ende des umgebenden Blocks
+#if CONFIG_TETRIS_PROFILER
+typedef struct {
+    profile_stage_t stage;
+    uint32_t start;
+} profile_probe_t;
+
+static inline void profile_probe_end(profile_probe_t *p) {
+    profiler_record(p->stage, profiler_now() - p->start);
+}
+
+#define PROFILE_CONCAT_(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_(a, b)
+#define PROFILE_SCOPE(stage) \
+    profile_probe_t PROFILE_CONCAT(_profile_probe_, __LINE__) \
+        __attribute__((cleanup(profile_probe_end))) = { (stage), profiler_now() }
+#else
+#define PROFILE_SCOPE(stage) do { } while (0)
+#endif
+
+#endif // PROFILER_H
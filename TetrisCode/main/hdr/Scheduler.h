@@ -0,0 +1,59 @@
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "freertos/FreeRTOS.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// SCHEDULER - Deadline-basierte Events für den GameLoop (µs-Auflösung, Zeitbasis clock_now_us())
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// Der GameLoop-Task blockiert in scheduler_wait() bis die nächste Deadline fällig ist
+// oder ein Input (Button-Flanke) ihn weckt. Keine Tick-Granularität (CONFIG_FREERTOS_HZ=100).
+
+// Event-Typen (jeder Typ hat genau eine Deadline)
+typedef enum {
+    SCHED_EVT_FALL = 0,     // Block fällt eine Reihe
+    SCHED_EVT_RENDER,       // Frame rendern
+    SCHED_EVT_AUTOREPEAT,   // Input-Wiederholung (gehaltene Buttons)
+    SCHED_EVT_ANIMATION,    // Animationsschritt (Blink, Splash)
+    SCHED_EVT_LOCK,         // Lock Delay abgelaufen → aufliegenden Block fixieren
+    SCHED_EVT_CHORD,        // Haltezeit einer Tastenkombination abgelaufen
+    SCHED_EVT_COUNT
+} sched_event_t;
+
+#define SCHED_EVT_BIT(evt)  (1u << (evt))
+
+// Zusätzliches Bit im Rückgabewert von scheduler_wait(): Input-Notification (Button-Flanke)
+#define SCHED_WAKE_INPUT    (1u << 31)
+
+// Muss aus dem Task aufgerufen werden, der später scheduler_wait() aufruft
+void scheduler_init(void);
+
+// Deadline absolut (clock_now_us() Zeitbasis, µs) bzw. relativ zu jetzt setzen
+void scheduler_arm_at(sched_event_t evt, int64_t deadline_us);
+void scheduler_arm_in(sched_event_t evt, int64_t delay_us);
+
+// Periodisch neu setzen: letzte Deadline + period_us (driftfrei). Verpasste Perioden
+// werden übersprungen statt nachgeholt.
+void scheduler_arm_periodic(sched_event_t evt, int64_t period_us);
+
+void scheduler_cancel(sched_event_t evt);
+bool scheduler_is_armed(sched_event_t evt);
+
+// Blockiert bis mindestens ein Event fällig ist oder Input eintrifft.
+// Rückgabe: Bitmaske SCHED_EVT_BIT(...) der fälligen Events, ggf. | SCHED_WAKE_INPUT
+uint32_t scheduler_wait(void);
+
+// Weckt den Scheduler-Task (ISR- bzw. Task-Kontext)
+void scheduler_notify_input_from_isr(BaseType_t *higher_priority_task_woken);
+void scheduler_notify_input(void);
+
+// Beginn des aktuellen Frames: früheste Deadline der Events aus dem letzten scheduler_wait()
+// (bei reinem Input: Aufwachzeit). Verspätetes Aufwachen zählt so zur Frame-Zeit.
+int64_t scheduler_frame_start_us(void);
+
+// CPU-Auslastung des Scheduler-Tasks im letzten Messfenster (in Promille)
+uint32_t scheduler_get_load_permille(void);
+
+#endif // SCHEDULER_H
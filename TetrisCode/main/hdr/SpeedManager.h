@@ -10,9 +10,18 @@
 // Initialisiert den Speed Manager (muss einmal zu Spielstart aufgerufen werden)
 void speed_manager_init(void);
 
-// Gibt die aktuelle Fallgeschwindigkeit in Millisekunden zurück
+// Gibt die aktuelle Fallgeschwindigkeit in Millisekunden pro Reihe zurück (0 = sofort)
 uint32_t speed_manager_get_fall_interval(void);
 
+// Gibt die aktuelle Gravity in Reihen pro µs (Q0.32, siehe Gravity.h) zurück
+uint32_t speed_manager_get_gravity(void);
+
+// Gibt das Lock Delay des aktuellen Levels in Millisekunden zurück
+uint32_t speed_manager_get_lock_delay_ms(void);
+
+// Aktuelles Level (1 = Start-Geschwindigkeit)
+uint32_t speed_manager_get_level(void);
+
 // Ruft dies auf, wenn der Score sich ändert (nach Zeilen)
 void speed_manager_update_score(uint32_t lines_cleared);
 
@@ -2,6 +2,7 @@
 #define SPLASH_H
 
 #include <stdint.h>
+#include <stdbool.h>
 
 /**
  * @brief Initialize LED state before splash display
@@ -16,6 +17,17 @@ void splash_init(void);
 // splash remains visible (use SPLASH_DURATION_MS constant from Globals.h).
 void splash_show(uint32_t duration_ms);
 
+// Non-blocking splash: splash_begin() draws the static design and restarts the scrolling
+// "TETRIS" (TextScroll.c), splash_tick() brings the text up to the current time.
+// splash_next_us() is the time of the next scroll step (scheduler deadline).
+void splash_begin(void);
+void splash_tick(void);
+int64_t splash_next_us(void);
+
+// After splash_begin(): scroll "TETRIS  SCORE n  LV n  NEW HIGH" (or "HI n") instead, for
+// setups without the OLED. level 0 = no game played yet (highscore only).
+void splash_show_scores(uint32_t score, uint32_t level, uint32_t highscore, bool new_high);
+
 // Clear the splash image from the LEDs (used when the game starts)
 void splash_clear(void);
 
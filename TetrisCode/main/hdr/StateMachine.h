@@ -0,0 +1,50 @@
+#ifndef STATE_MACHINE_H
+#define STATE_MACHINE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// STATE MACHINE - Tabellengesteuerter, hierarchischer Zustandsautomat (nicht-blockierend)
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// Jeder Zustand hat enter/exit/tick Handler (NULL erlaubt) und optional einen Eltern-Zustand.
+// tick läuft vom äußersten Eltern-Zustand bis zum aktiven Blatt. Übergänge werden mit
+// sm_request() angefordert und erst nach dem Tick ausgeführt (exit bis zum gemeinsamen
+// Vorfahren, danach enter bis zum Ziel). Handler dürfen selbst wieder Übergänge anfordern.
+
+#define SM_NO_PARENT  (-1)
+#define SM_NO_STATE   (-1)
+
+// Maximale Verschachtelungstiefe
+#define SM_MAX_DEPTH  4
+
+typedef struct {
+    const char *name;
+    int parent;                         // Index des Eltern-Zustands oder SM_NO_PARENT
+    void (*enter)(void);
+    void (*exit)(void);
+    void (*tick)(uint32_t events);      // events = Rückgabe von scheduler_wait()
+} sm_state_t;
+
+typedef struct {
+    const sm_state_t *states;
+    int num_states;
+    int current;                        // Aktives Blatt
+    int pending;                        // Angeforderter Übergang oder SM_NO_STATE
+} state_machine_t;
+
+// Betritt den Startzustand (inkl. aller Eltern-Zustände)
+void sm_init(state_machine_t *sm, const sm_state_t *states, int num_states, int initial);
+
+// Übergang anfordern (letzte Anforderung vor dem Ausführen gewinnt)
+void sm_request(state_machine_t *sm, int next);
+
+// Tick-Handler ausführen, danach angeforderte Übergänge durchführen
+void sm_tick(state_machine_t *sm, uint32_t events);
+
+// true wenn state das aktive Blatt oder einer seiner Vorfahren ist
+bool sm_in_state(const state_machine_t *sm, int state);
+
+int sm_current(const state_machine_t *sm);
+
+#endif // STATE_MACHINE_H
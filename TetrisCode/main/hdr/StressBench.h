@@ -0,0 +1,23 @@
+#ifndef STRESS_BENCH_H
+#define STRESS_BENCH_H
+
+#include <stdbool.h>
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// STRESS BENCH - Input-Latenz und Frame-Jitter unter Worst-Case Last (CONFIG_TETRIS_STRESS_BENCH)
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// Last: Musik läuft, OLED-Score alle STRESS_BENCH_HUD_PERIOD_MS, jeder fixierte Block löst einen
+// Line-Clear aus, synthetische Taps (LEFT/RIGHT/ROTATE) bei gehaltenem FASTER.
+// Ergebnis: Report mit Topologie-Name + eine "BENCH ..." Zeile zum Vergleich mehrerer Builds.
+// Ohne CONFIG_TETRIS_STRESS_BENCH sind alle Funktionen leer.
+
+// Benchmark-Task starten (einmal nach dem Boot bzw. per Konsole 'bench')
+void stress_bench_start(void);
+
+// Läuft gerade ein Durchlauf?
+bool stress_bench_active(void);
+
+// Vom GameLoop vor dem Fixieren eines Blocks: unterste Reihe füllen → Line-Clear erzwingen
+void stress_bench_prepare_lock(void);
+
+#endif // STRESS_BENCH_H
@@ -0,0 +1,34 @@
+#ifndef SUB_CELL_H
+#define SUB_CELL_H
+
+#include <stdint.h>
+#include "Blocks.h"
+#include "Compositor.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// SUB CELL - Aktiver Block zwischen zwei Fall-Events (CONFIG_TETRIS_SUBCELL_RENDER)
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// Der Bruchteil f der nächsten Reihe (gravity_fraction_q16) wird auf SUBCELL_LEVELS Stufen
+// quantisiert: q = f * SUBCELL_LEVELS. Jede Block-Zelle gibt SUBCELL_LEVELS - q Stufen an ihre
+// Reihe und q an die Reihe darunter; Zellen desselben Blocks addieren sich (senkrecht
+// benachbarte Zellen bleiben voll hell). Die Farbe pro (Blockfarbe, Stufe) ist vorberechnet,
+// mit CONFIG_TETRIS_POSTPROCESS im linearen Licht (Stufe^(1/POST_GAMMA)), damit die Summe der
+// beiden Reihen so hell wirkt wie eine volle Zelle.
+
+#define SUBCELL_LEVELS 16
+
+// Gewichte und Farbtabellen berechnen (nach compositor_init(), braucht die Blockpalette)
+void subcell_init(void);
+
+// Stufe 0..SUBCELL_LEVELS-1 aus einem Q16-Bruchteil
+static inline uint8_t subcell_level(uint16_t frac_q16) {
+    return (uint8_t)(((uint32_t)frac_q16 * SUBCELL_LEVELS) >> 16);
+}
+
+// Vorberechnete Farbe: Blockfarbe mit level / SUBCELL_LEVELS Anteil
+const pixel_rgb_t *subcell_color(uint8_t block_index, uint8_t level);
+
+// Block um frac_q16 Reihen nach unten versetzt in die Ebene zeichnen (Ebene vorher leeren)
+void subcell_render(layer_id_t layer, const TetrisBlock *block, uint16_t frac_q16);
+
+#endif // SUB_CELL_H
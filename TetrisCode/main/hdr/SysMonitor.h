@@ -0,0 +1,45 @@
+#ifndef SYS_MONITOR_H
+#define SYS_MONITOR_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// SYSTEM MONITOR - CPU pro Task, Stack-High-Water, Heap (Hintergrund-Task)
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// Tastet alle SYSMON_SAMPLE_MS die FreeRTOS Runtime-Stats und den Heap ab, hält ein
+// rollendes Fenster von SYSMON_WINDOW_SAMPLES Samples und warnt vor Stack-Overflow /
+// Heap-Fragmentierung. Ausgabe als Text-Report (pro Fenster) oder binär (pro Sample,
+// CONFIG_TETRIS_SYSMON_BINARY). Runtime-Stats benötigen CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS.
+
+// Binärformat (little endian, gepackt): Header, task_count * Task-Record, Fletcher-16
+#define SYSMON_FRAME_MAGIC0   'S'
+#define SYSMON_FRAME_MAGIC1   'M'
+#define SYSMON_FRAME_VERSION  1
+
+typedef struct __attribute__((packed)) {
+    uint8_t magic[2];
+    uint8_t version;
+    uint8_t task_count;
+    uint32_t timestamp_ms;
+    uint32_t heap_free;
+    uint32_t heap_min_free;             // Minimum seit Boot
+    uint32_t heap_largest_block;
+    uint16_t core_load_permille[2];     // 1000 - Anteil des IDLE-Tasks pro Core
+} sysmon_frame_header_t;
+
+typedef struct __attribute__((packed)) {
+    char name[16];
+    uint8_t priority;
+    uint8_t core;                       // 0xFF = keine Affinität / unbekannt
+    uint16_t cpu_permille;              // Anteil an EINEM Core im letzten Sample
+    uint32_t stack_free;                // High-Water-Mark in Bytes
+} sysmon_frame_task_t;
+
+// Monitor-Task starten (einmal aus app_main)
+void sysmon_start(void);
+
+// Report sofort anfordern (z.B. Konsole); wird im Monitor-Task ausgegeben
+void sysmon_request_report(void);
+
+#endif // SYS_MONITOR_H
@@ -0,0 +1,44 @@
+#ifndef TASK_CONFIG_H
+#define TASK_CONFIG_H
+
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// TASK CONFIG - Zentrale Task-Topologie: Core, Priorität und Stack pro Task
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// Alle Tasks werden über task_config_create() (bzw. für LVGL/Konsole über deren Config-Structs)
+// mit den Werten aus der Tabelle der gewählten Topologie erzeugt (Kconfig TETRIS_TOPOLOGY_*).
+// Nicht in der Tabelle: esp_timer Task (Button-Abtaster, Scheduler-Deadlines) und dessen ISR
+// laufen laut sdkconfig auf Core 0; RMT-Interrupts auf dem Core, der den Kanal angelegt hat
+// (LED-Strip: app_main, Core 0; Buzzer: ThemeTask).
+
+typedef enum {
+    TASK_ROLE_GAMELOOP = 0,
+    TASK_ROLE_THEME,
+    TASK_ROLE_LVGL,
+    TASK_ROLE_CONSOLE,
+    TASK_ROLE_SYSMON,
+    TASK_ROLE_BINLOG,
+    TASK_ROLE_BENCH,
+    TASK_ROLE_COUNT
+} task_role_t;
+
+typedef struct {
+    const char *name;
+    uint32_t stack_bytes;
+    UBaseType_t priority;
+    BaseType_t core;            // 0, 1 oder tskNO_AFFINITY
+} task_config_t;
+
+const task_config_t *task_config(task_role_t role);
+const char *task_topology_name(void);
+
+// Task gemäß Tabelle erzeugen (xTaskCreatePinnedToCore)
+BaseType_t task_config_create(task_role_t role, TaskFunction_t fn, void *arg, TaskHandle_t *out);
+
+// Tabelle der aktiven Topologie ausgeben
+void task_config_print(void);
+
+#endif // TASK_CONFIG_H
@@ -0,0 +1,54 @@
+#ifndef TEXT_SCROLL_H
+#define TEXT_SCROLL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "Compositor.h"
+#include "Font3x5.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// TEXT SCROLL - Lauftext (Strings und Zahlen) im 3x5 Font, nicht-blockierend
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// Der Text wird beim Setzen einmal in Spalten-Bitmaps übersetzt (Bit y = Zeile y, eine leere
+// Spalte nach jedem Zeichen). Danach ist die Position nur eine Funktion der Zeit: Spalte k =
+// (vergangene Zeit / step_ms) mod (Breite + LED_WIDTH), von rechts herein bis links hinaus.
+// text_scroll_advance() zeichnet bei jedem Spaltenschritt genau LED_WIDTH x FONT3X5_H Zellen
+// in die Ebene - feste Kosten unabhängig von der Textlänge. Der Scroller besitzt diese Zeilen
+// der Ebene; Aufrufer committet (led_strip_semaphore).
+
+#define TEXT_SCROLL_MAX_COLS 256   // 64 Zeichen
+
+typedef struct {
+    uint8_t cols[TEXT_SCROLL_MAX_COLS];
+    uint16_t width;                 // Gültige Spalten in cols
+    layer_id_t layer;
+    int8_t row;                     // Oberste Zeile des Texts in der Matrix
+    pixel_rgb_t color;
+    uint16_t step_ms;               // Zeit pro Spalte
+    int64_t start_us;
+    int64_t now_us;                 // Zeit des letzten text_scroll_advance()
+    int32_t last_col;               // Zuletzt gezeichnete Spalte (-1 = noch nichts)
+} text_scroll_t;
+
+void text_scroll_init(text_scroll_t *ts, layer_id_t layer, int row, pixel_rgb_t color,
+                      uint16_t step_ms);
+
+// Text neu aufbauen (leeren, anhängen) und mit text_scroll_restart() von rechts starten
+void text_scroll_clear(text_scroll_t *ts);
+void text_scroll_append(text_scroll_t *ts, const char *text);
+void text_scroll_append_number(text_scroll_t *ts, uint32_t value);
+void text_scroll_restart(text_scroll_t *ts, int64_t now_us);
+
+// Kurzform: clear + append + restart
+void text_scroll_set_text(text_scroll_t *ts, const char *text, int64_t now_us);
+
+// Auf now_us nachführen. @return true wenn eine neue Spalte gezeichnet wurde
+bool text_scroll_advance(text_scroll_t *ts, int64_t now_us);
+
+// Zeitpunkt des nächsten Spaltenschritts
+int64_t text_scroll_next_us(const text_scroll_t *ts);
+
+// Textzeilen der Ebene freigeben (ohne Commit)
+void text_scroll_erase(text_scroll_t *ts);
+
+#endif // TEXT_SCROLL_H
@@ -48,7 +48,7 @@ typedef enum {
 } ThemeSongIndex;
 
 /* Wechsele zur nächsten Musik (mit Cycling: TETRIS → STARWARS → ... → SILENCE → TETRIS)
-   Diese Funktion wird durch die Tastenkombination (alle 4 Buttons) aufgerufen */
+   Diese Funktion wird durch die Tastenkombination LEFT + RIGHT aufgerufen */
 void theme_next_song(void);
 
 /* Gebe aktuelle Song-Nummer zurück */
@@ -0,0 +1,116 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sdkconfig.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// TRACE - Zeitleiste von Frames, Line Clears, Noten und HUD-Flushes (Flight Recorder)
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// TRACE_BEGIN/TRACE_END/TRACE_INSTANT schreiben einen 12-Byte Event in einen RAM-Ring, der die
+// ältesten Events überschreibt. Die Konsole ('trace dump') gibt den Ring als "TR <hex>" Zeilen
+// aus; tools/trace2chrome.py macht daraus Chrome Trace JSON (chrome://tracing, ui.perfetto.dev).
+// Jede Spur (Track) wird dort eine eigene Zeile, damit der Jitter zwischen GameLoop, ThemeTask,
+// LVGL-Task und RMT-Refresh direkt sichtbar ist.
+
+// Spuren in der Zeitleiste (Index = tid im Chrome Trace)
+#define TRACE_TRACKS(X) \
+    X(TRACE_TRACK_GAMELOOP, "GameLoopTask") \
+    X(TRACE_TRACK_STATE,    "Game state") \
+    X(TRACE_TRACK_RMT,      "LED refresh (RMT)") \
+    X(TRACE_TRACK_HUD,      "HUD (OLED)") \
+    X(TRACE_TRACK_LVGL,     "LVGL flush") \
+    X(TRACE_TRACK_THEME,    "ThemeTask") \
+    X(TRACE_TRACK_INPUT,    "Input sampler")
+
+// Ein Eintrag pro Event: X(ID, "Name", Spur). Neue Einträge nur ANHÄNGEN: die ID steht so im
+// Dump (tools/trace2chrome.py liest diese Datei).
+#define TRACE_CATALOG(X) \
+    X(TRACE_FRAME,       "frame",       TRACE_TRACK_GAMELOOP) \
+    X(TRACE_INPUT,       "input",       TRACE_TRACK_GAMELOOP) \
+    X(TRACE_SPAWN,       "spawn",       TRACE_TRACK_GAMELOOP) \
+    X(TRACE_STATE,       "state",       TRACE_TRACK_STATE) \
+    X(TRACE_LINE_CLEAR,  "line_clear",  TRACE_TRACK_STATE) \
+    X(TRACE_RENDER,      "render",      TRACE_TRACK_RMT) \
+    X(TRACE_REFRESH,     "refresh",     TRACE_TRACK_RMT) \
+    X(TRACE_HUD,         "hud_update",  TRACE_TRACK_HUD) \
+    X(TRACE_HUD_FLUSH,   "flush",       TRACE_TRACK_LVGL) \
+    X(TRACE_NOTE,        "note",        TRACE_TRACK_THEME) \
+    X(TRACE_BUTTON,      "button",      TRACE_TRACK_INPUT) \
+    X(TRACE_QUALITY,     "quality",     TRACE_TRACK_STATE)
+
+#define TRACE_TRACK_ENUM(id, name) id,
+#define TRACE_CATALOG_ENUM(id, name, track) id,
+
+typedef enum {
+    TRACE_TRACKS(TRACE_TRACK_ENUM)
+    TRACE_TRACK_COUNT
+} trace_track_t;
+
+typedef enum {
+    TRACE_CATALOG(TRACE_CATALOG_ENUM)
+    TRACE_ID_COUNT
+} trace_id_t;
+
+// Phasen wie im Chrome Trace Format
+#define TRACE_PH_BEGIN     'B'
+#define TRACE_PH_END       'E'
+#define TRACE_PH_INSTANT   'i'
+#define TRACE_PH_COMPLETE  'X'     // arg = Dauer in µs, timestamp = Beginn
+
+// Events im Ring (Zweierpotenz, 12 Byte pro Event im Dump, im RAM + 4 Byte Sequenz)
+#define TRACE_RING_SIZE  1024
+
+_Static_assert((TRACE_RING_SIZE & (TRACE_RING_SIZE - 1)) == 0, "Trace.c indexes with SIZE - 1 as mask");
+
+typedef struct __attribute__((packed)) {
+    uint32_t timestamp_us;          // Untere 32 Bit von clock_now_us()
+    uint16_t id;                    // trace_id_t
+    uint8_t phase;                  // TRACE_PH_*
+    uint8_t core;
+    int32_t arg;
+} trace_event_t;
+
+typedef struct {
+    uint32_t recorded;              // Events seit Start (inkl. überschriebener)
+    uint32_t capacity;
+    bool enabled;
+} trace_stats_t;
+
+// Event schreiben (Task- und ISR-sicher, blockiert nie)
+void trace_record(uint16_t id, uint8_t phase, int32_t arg);
+
+// Abgeschlossene Spanne nachträglich eintragen (z.B. aus einem Callback mit Dauer)
+void trace_complete(uint16_t id, uint32_t start_us, uint32_t duration_us);
+
+// Aufzeichnung an/aus; Ring leeren (ältere Events erscheinen in keinem Dump mehr)
+void trace_set_enabled(bool enabled);
+void trace_clear(void);
+void trace_get_stats(trace_stats_t *out);
+
+// Ring als "TR <hex>" Zeilen ausgeben (pausiert die Aufzeichnung währenddessen)
+void trace_dump(void);
+
+#if CONFIG_TETRIS_TRACE
+#define TRACE_BEGIN(id)          trace_record((id), TRACE_PH_BEGIN, 0)
+#define TRACE_END(id)            trace_record((id), TRACE_PH_END, 0)
+#define TRACE_INSTANT(id, arg)   trace_record((id), TRACE_PH_INSTANT, (int32_t)(arg))
+
+// Scoped Spanne: TRACE_END automatisch am Ende des umgebenden Blocks
+static inline void trace_scope_end(const uint16_t *id) {
+    trace_record(*id, TRACE_PH_END, 0);
+}
+#define TRACE_CONCAT_(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_(a, b)
+#define TRACE_SCOPE(id) \
+    const uint16_t TRACE_CONCAT(_trace_scope_, __LINE__) \
+        __attribute__((cleanup(trace_scope_end))) = (trace_record((id), TRACE_PH_BEGIN, 0), (id))
+#else
+#define TRACE_BEGIN(id)          do { } while (0)
+#define TRACE_END(id)            do { } while (0)
+#define TRACE_INSTANT(id, arg)   do { (void)(arg); } while (0)
+#define TRACE_SCOPE(id)          do { } while (0)
+#endif
+
+#endif // TRACE_H
@@ -0,0 +1,41 @@
+#ifndef WS2812_LUT_H
+#define WS2812_LUT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "driver/rmt_encoder.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// WS2812 LUT - Pixel-Bytes → RMT-Symbole über eine konstante Nibble-Tabelle
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// Der Bytes-Encoder von led_strip prüft im ISR jedes Bit einzeln (9216 Bits pro Frame bei 384
+// LEDs). Hier kopiert der Callback pro Nibble 4 fertige Symbole aus s_nibble_lut (16 x 4 Worte,
+// 256 Byte im DRAM). Timing wie led_strip: 0 = 0.3us high / 0.9us low, 1 = 0.9us / 0.3us.
+
+// RMT-Auflösung, für die die Tabelle berechnet ist
+#define WS2812_RMT_RESOLUTION_HZ  (10 * 1000 * 1000)
+
+#define WS2812_T0H_TICKS  3     // 0.3 us
+#define WS2812_T0L_TICKS  9     // 0.9 us
+#define WS2812_T1H_TICKS  9     // 0.9 us
+#define WS2812_T1L_TICKS  3     // 0.3 us
+
+// Reset/Latch: 50 us low, als ein Symbol aus zwei Hälften
+#define WS2812_RESET_TICKS  (WS2812_RMT_RESOLUTION_HZ / 1000000 * 50 / 2)
+
+// Symbole pro Byte bzw. pro Übertragung (inkl. Reset-Symbol)
+#define WS2812_SYMBOLS_PER_BYTE  8
+#define WS2812_FRAME_SYMBOLS(bytes)  ((bytes) * WS2812_SYMBOLS_PER_BYTE + 1)
+
+// Callback für rmt_new_simple_encoder() (min_chunk_size = WS2812_SYMBOLS_PER_BYTE).
+// Schreibt so viele ganze Bytes wie in symbols_free passen, am Ende das Reset-Symbol (*done).
+// Reine Logik (Host-kompilierbar), arg wird nicht verwendet.
+size_t ws2812_lut_encode(const void *data, size_t data_size, size_t symbols_written,
+                         size_t symbols_free, rmt_symbol_word_t *symbols, bool *done, void *arg);
+
+// Referenz: ein Bit als Symbol (wie der Bytes-Encoder, MSB zuerst)
+rmt_symbol_word_t ws2812_bit_symbol(bool one);
+rmt_symbol_word_t ws2812_reset_symbol(void);
+
+#endif // WS2812_LUT_H
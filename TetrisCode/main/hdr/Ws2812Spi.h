@@ -0,0 +1,33 @@
+#ifndef WS2812_SPI_H
+#define WS2812_SPI_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// WS2812 SPI - Pixel-Bytes → SPI-Bitstrom über eine 256-Einträge Tabelle
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// Bei 2.5 MHz ist ein WS2812-Bit 3 SPI-Bits: 0 = 100, 1 = 110 (0.4us Raster), ein Farbbyte
+// also 3 SPI-Bytes. led_strip_spi_dev.c setzt diese Bits in set_pixel() einzeln per Verzweigung;
+// hier steht die Expansion jedes Bytewerts fertig in s_spi_lut (256 x 3 Byte, DRAM).
+
+#define WS2812_SPI_CLOCK_HZ        (2500 * 1000)
+#define WS2812_SPI_BYTES_PER_COLOR 3
+#define WS2812_SPI_BYTES_PER_LED   (3 * WS2812_SPI_BYTES_PER_COLOR)
+
+// Reset/Latch am Ende des Puffers: >= 50 us low (16 Byte = 51.2 us bei 2.5 MHz)
+#define WS2812_SPI_RESET_BYTES     16
+
+// Größe des Sendepuffers (GRB-Daten + Reset)
+#define WS2812_SPI_BUFFER_SIZE(leds)  ((leds) * WS2812_SPI_BYTES_PER_LED + WS2812_SPI_RESET_BYTES)
+
+// n Farbbytes nach out (3 * n Byte), Tabellen-Version. Reine Logik (Host-kompilierbar).
+void ws2812_spi_encode(const uint8_t *bytes, size_t n, uint8_t *out);
+
+// Referenz: Bit für Bit wie __led_strip_spi_bit() in led_strip (für Vergleich/Benchmark)
+void ws2812_spi_encode_bits(const uint8_t *bytes, size_t n, uint8_t *out);
+
+// Expansion eines einzelnen Bytes (3 Byte, MSB zuerst)
+const uint8_t *ws2812_spi_lut(uint8_t value);
+
+#endif // WS2812_SPI_H
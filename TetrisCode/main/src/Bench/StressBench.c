@@ -0,0 +1,181 @@
+/**
+ * @file StressBench.c
+ * @brief Stress-Benchmark für die Task-Topologie (TaskConfig.c)
+ *
+ * Ein Durchlauf über STRESS_BENCH_DURATION_MS mit gleichzeitiger Worst-Case
+ * Last auf allen Tasks:
+ *
+ * - Musik: ThemeTask läuft durchgehend (RMT-Transmits für den Buzzer)
+ * - HUD: OLED-Score alle STRESS_BENCH_HUD_PERIOD_MS neu zeichnen lassen (im GameLoop:
+ *   LVGL-Lock + I2C-Flush)
+ * - Line-Clear: vor jedem Fixieren wird die unterste Reihe gefüllt
+ * - Input: FASTER gehalten (häufige Locks), Taps auf LEFT/RIGHT/ROTATE
+ *
+ * Gemessen wird mit den vorhandenen Instrumenten: Input-to-Photon Latenz
+ * (LatencyTrace), Slack/Überläufe pro Frame (FrameDeadline) und Laufzeit pro
+ * Stufe (Profiler). Pro Topologie ein Build, die "BENCH" Zeilen vergleichen.
+ */
+
+#include "StressBench.h"
+#include "sdkconfig.h"
+
+#if CONFIG_TETRIS_STRESS_BENCH
+
+#include "Globals.h"
+#include "Grid.h"
+#include "Controls.h"
+#include "GameLoop.h"
+#include "LatencyTrace.h"
+#include "Profiler.h"
+#include "ThemeSong.h"
+#include "TaskConfig.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <stdio.h>
+
+// ============================================================================
+// PRIVATE VARIABLEN
+// ============================================================================
+
+static TaskHandle_t s_bench_task = NULL;
+static volatile bool s_active = false;
+
+/** @brief Tap-Reihenfolge (Release folgt nach der halben Periode) */
+static const button_id_t s_tap_order[] = { BUTTON_LEFT, BUTTON_ROTATE, BUTTON_RIGHT, BUTTON_ROTATE };
+
+// ============================================================================
+// REPORT
+// ============================================================================
+
+static void stress_bench_report(void) {
+    frame_deadline_t fd;
+    game_loop_get_deadline(&fd);
+    long mean_slack = fd.frames ? (long)(fd.slack_sum_us / fd.frames) : 0;
+    long min_slack = fd.frames ? (long)fd.min_slack_us : 0;
+
+    printf("[Bench] ===== Results, topology '%s' =====\n", task_topology_name());
+    task_config_print();
+    latency_trace_print();
+
+    profiler_request_snapshot();
+    for (int i = 0; i < 50 && !profiler_snapshot_ready(); i++) {
+        vTaskDelay(1);
+    }
+    profiler_print_snapshot();
+
+    printf("[Bench] Frames %lu, overruns %lu, slack mean %ld us, min %ld us, jitter %ld us\n",
+           (unsigned long)fd.frames, (unsigned long)fd.overruns, mean_slack, min_slack,
+           mean_slack - min_slack);
+    printf("[Bench] Quality sheds %lu, restores %lu, final level %s\n",
+           (unsigned long)fd.shed_count, (unsigned long)fd.restore_count,
+           frame_deadline_level_name(fd.level));
+
+    // Eine Zeile pro Topologie zum Vergleich (Latenz über alle Buttons: schlechtester Wert)
+    int64_t p99 = 0, max = 0;
+    uint32_t samples = 0;
+    for (int b = 0; b < BUTTON_COUNT; b++) {
+        latency_summary_t s;
+        if (!latency_trace_summary((button_id_t)b, &s)) continue;
+        samples += s.count;
+        if (s.p99_us > p99) p99 = s.p99_us;
+        if (s.max_us > max) max = s.max_us;
+    }
+    printf("BENCH topology=%s samples=%lu lat_p99_us=%lld lat_max_us=%lld "
+           "overruns=%lu/%lu slack_min_us=%ld jitter_us=%ld\n",
+           task_topology_name(), (unsigned long)samples, (long long)p99, (long long)max,
+           (unsigned long)fd.overruns, (unsigned long)fd.frames, min_slack, mean_slack - min_slack);
+}
+
+// ============================================================================
+// BENCH TASK
+// ============================================================================
+
+/**
+ * @brief Ein Durchlauf: Aufwärmen, Last erzeugen, Report, Task beenden
+ *
+ * @param pvParameters Unused (NULL)
+ */
+static void stress_bench_task(void *pvParameters) {
+    const TickType_t step = pdMS_TO_TICKS(10);  // CONFIG_FREERTOS_HZ=100: ein Tick
+    const int step_ms = 10;
+
+    printf("[Bench] Starting in %d ms: %d ms of music + HUD + line-clear load, topology '%s'\n",
+           STRESS_BENCH_WARMUP_MS, STRESS_BENCH_DURATION_MS, task_topology_name());
+    vTaskDelay(pdMS_TO_TICKS(STRESS_BENCH_WARMUP_MS));
+
+    // Spiel starten (WAIT wartet auf einen Press), dann Messwerte zurücksetzen
+    controls_inject(BUTTON_ROTATE, INPUT_EDGE_PRESS);
+    controls_inject(BUTTON_ROTATE, INPUT_EDGE_RELEASE);
+    vTaskDelay(step);
+    theme_resume();
+    latency_trace_request_reset();
+    game_loop_request_deadline_reset();
+    profiler_request_reset();
+
+    s_active = true;
+    controls_inject(BUTTON_FASTER, INPUT_EDGE_PRESS);
+
+    int tap = 0;
+    for (int t = 0; t < STRESS_BENCH_DURATION_MS; t += step_ms) {
+        if (t % STRESS_BENCH_HUD_PERIOD_MS == 0) {
+            game_loop_request_hud_update();  // Zeichnet der GameLoop (LVGL nur aus einem Task)
+        }
+
+        int phase = t % STRESS_BENCH_INPUT_PERIOD_MS;
+        button_id_t button = s_tap_order[tap % (sizeof(s_tap_order) / sizeof(s_tap_order[0]))];
+        if (phase == 0) {
+            controls_inject(button, INPUT_EDGE_PRESS);  // Neues Spiel nach Game Over startet auch so
+        } else if (phase == STRESS_BENCH_INPUT_PERIOD_MS / 2) {
+            controls_inject(button, INPUT_EDGE_RELEASE);
+            tap++;
+        }
+        vTaskDelay(step);
+    }
+
+    controls_inject(BUTTON_FASTER, INPUT_EDGE_RELEASE);
+    s_active = false;
+
+    stress_bench_report();
+
+    s_bench_task = NULL;
+    vTaskDelete(NULL);
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+void stress_bench_start(void) {
+    if (s_bench_task != NULL) {
+        printf("[Bench] Already running\n");
+        return;
+    }
+    task_config_create(TASK_ROLE_BENCH, stress_bench_task, NULL, &s_bench_task);
+}
+
+bool stress_bench_active(void) {
+    return s_active;
+}
+
+void stress_bench_prepare_lock(void) {
+    if (!s_active) return;
+    for (int x = 0; x < GRID_WIDTH; x++) {
+        if (grid[GRID_HEIGHT - 1][x] == 0) {
+            grid[GRID_HEIGHT - 1][x] = (uint8_t)(1 + x % 7);
+        }
+    }
+}
+
+#else
+
+void stress_bench_start(void) {
+}
+
+bool stress_bench_active(void) {
+    return false;
+}
+
+void stress_bench_prepare_lock(void) {
+}
+
+#endif // CONFIG_TETRIS_STRESS_BENCH
@@ -1,12 +1,13 @@
 #include "Globals.h"
 
-// Define the centralized block color table here. Values are scaled by BRIGHTNESSDIV.
+// Define the centralized block color table here. Full-range design values: the compositor
+// palette applies BRIGHTNESSDIV / GAME_BRIGHTNESS_SCALE, or PostProcess.c gamma + brightness.
 const uint8_t block_colors[NUM_BLOCKS][3] = {
-    {0/BRIGHTNESSDIV, 255/BRIGHTNESSDIV, 80/BRIGHTNESSDIV},   // I - Cyan
-    {0/BRIGHTNESSDIV, 0/BRIGHTNESSDIV, 255/BRIGHTNESSDIV},     // J - Blau
-    {255/BRIGHTNESSDIV, 90/BRIGHTNESSDIV, 0/BRIGHTNESSDIV},   // L - Orange
-    {255/BRIGHTNESSDIV, 240/BRIGHTNESSDIV, 0/BRIGHTNESSDIV},   // O - Gelb
-    {0/BRIGHTNESSDIV, 255/BRIGHTNESSDIV, 0/BRIGHTNESSDIV},     // S - Grün
-    {128/BRIGHTNESSDIV, 0/BRIGHTNESSDIV, 128/BRIGHTNESSDIV},   // T - Lila
-    {255/BRIGHTNESSDIV, 0/BRIGHTNESSDIV, 0/BRIGHTNESSDIV}      // Z - Rot
+    {0, 255, 80},     // I - Cyan
+    {0, 0, 255},      // J - Blau
+    {255, 90, 0},     // L - Orange
+    {255, 240, 0},    // O - Gelb
+    {0, 255, 0},      // S - Grün
+    {128, 0, 128},    // T - Lila
+    {255, 0, 0}       // Z - Rot
 };
@@ -0,0 +1,176 @@
+/**
+ * @file Clock.c
+ * @brief Injizierbare Zeitquelle (Real- und Virtual-Backend)
+ *
+ * Vorher lasen GameLoop, Controls und Splash die Zeit jeweils selbst über
+ * xTaskGetTickCount() * portTICK_PERIOD_MS (10ms Auflösung) und schliefen
+ * über vTaskDelay. Dadurch konnte das Spiel nie schneller als Echtzeit laufen
+ * und Timing-Tests waren nicht deterministisch.
+ *
+ * Jetzt laufen alle Zeitabfragen über clock_now_*() und clock_sleep_*():
+ * - REAL-Backend: esp_timer_get_time() bzw. clock_gettime() auf dem Linux-Target
+ * - VIRTUAL-Backend: Zähler, der nur durch Schlafen/Vorspulen weiterläuft
+ *
+ * Der Block-Zufall hängt ebenfalls am Backend: esp_random() (Hardware-RNG)
+ * ist auf dem Gerät richtig, macht Simulationsläufe aber unwiederholbar.
+ * VIRTUAL nutzt deshalb einen xorshift32 mit festem Seed.
+ */
+
+#include "Clock.h"
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <stdio.h>
+#include <stdatomic.h>
+
+#include "esp_random.h"
+
+#if CONFIG_IDF_TARGET_LINUX
+#include <time.h>
+#else
+#include "esp_timer.h"
+#endif
+
+// ============================================================================
+// REAL BACKEND
+// ============================================================================
+
+static int64_t real_now_us(void) {
+#if CONFIG_IDF_TARGET_LINUX
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+#else
+    return esp_timer_get_time();
+#endif
+}
+
+/**
+ * @brief Schläft mindestens us Mikrosekunden
+ *
+ * Rundet auf volle Ticks AUF: pdMS_TO_TICKS(5) ergab bei 100Hz 0 Ticks,
+ * wodurch Schleifen leer drehten statt zu schlafen.
+ */
+static void real_sleep_us(int64_t us) {
+    if (us <= 0) return;
+    const int64_t tick_us = (int64_t)portTICK_PERIOD_MS * 1000;
+    vTaskDelay((TickType_t)((us + tick_us - 1) / tick_us));
+}
+
+static const clock_backend_t s_real_backend = {
+    .now_us = real_now_us,
+    .sleep_us = real_sleep_us,
+    .random = esp_random,
+    .name = "real",
+};
+
+// ============================================================================
+// VIRTUAL BACKEND
+// ============================================================================
+
+/**
+ * @brief Virtuelle Zeit in µs (läuft nur durch sleep/advance)
+ *
+ * Geschrieben vom GameLoop, gelesen auch vom Button-Abtaster (esp_timer Task) und
+ * anderen Tasks: 64 Bit auf dem 32-Bit Xtensa könnten sonst zerrissen gelesen werden
+ * (IDF bildet die 8-Byte Atomics dort mit einer kurzen Critical Section ab).
+ */
+static _Atomic int64_t s_virtual_now_us = 0;
+
+static int64_t virtual_now_us(void) {
+    return atomic_load_explicit(&s_virtual_now_us, memory_order_relaxed);
+}
+
+static void virtual_sleep_us(int64_t us) {
+    if (us > 0) atomic_fetch_add_explicit(&s_virtual_now_us, us, memory_order_relaxed);
+}
+
+/** @brief PRNG-Zustand (xorshift32, nie 0; nur vom GameLoop benutzt) */
+static uint32_t s_random_state = 0x2545F491u;
+
+static uint32_t virtual_random(void) {
+    uint32_t x = s_random_state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    s_random_state = x;
+    return x;
+}
+
+static const clock_backend_t s_virtual_backend = {
+    .now_us = virtual_now_us,
+    .sleep_us = virtual_sleep_us,
+    .random = virtual_random,
+    .name = "virtual",
+};
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+/** @brief Aktives Backend (Standard: Echtzeit) */
+static const clock_backend_t *s_backend = &s_real_backend;
+
+int64_t clock_now_us(void) {
+    return s_backend->now_us();
+}
+
+uint32_t clock_now_ms(void) {
+    return (uint32_t)(s_backend->now_us() / 1000);
+}
+
+void clock_sleep_us(int64_t us) {
+    s_backend->sleep_us(us);
+}
+
+void clock_sleep_ms(uint32_t ms) {
+    s_backend->sleep_us((int64_t)ms * 1000);
+}
+
+uint32_t clock_random(void) {
+    return s_backend->random ? s_backend->random() : esp_random();
+}
+
+void clock_seed_random(uint32_t seed) {
+    s_random_state = seed ? seed : 0x2545F491u;  // 0 ist ein Fixpunkt von xorshift
+}
+
+void clock_use_real(void) {
+    clock_set_backend(&s_real_backend);
+}
+
+void clock_use_virtual(int64_t start_us) {
+    atomic_store(&s_virtual_now_us, start_us);
+    clock_set_backend(&s_virtual_backend);
+}
+
+void clock_set_backend(const clock_backend_t *backend) {
+    if (backend == NULL || backend->now_us == NULL || backend->sleep_us == NULL) return;
+    s_backend = backend;
+    printf("[Clock] Using %s backend\n", backend->name ? backend->name : "custom");
+}
+
+int64_t clock_wall_us(void) {
+    return real_now_us();
+}
+
+bool clock_is_virtual(void) {
+    return s_backend == &s_virtual_backend;
+}
+
+void clock_advance_us(int64_t us) {
+    if (clock_is_virtual()) {
+        virtual_sleep_us(us);
+    }
+}
+
+void clock_advance_to(int64_t target_us) {
+    if (!clock_is_virtual()) return;
+
+    // Nur vorwärts, auch wenn ein anderer Task gleichzeitig schläft
+    int64_t now = atomic_load_explicit(&s_virtual_now_us, memory_order_relaxed);
+    while (target_us > now &&
+           !atomic_compare_exchange_weak_explicit(&s_virtual_now_us, &now, target_us,
+                                                  memory_order_relaxed, memory_order_relaxed)) {
+    }
+}
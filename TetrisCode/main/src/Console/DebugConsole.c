@@ -0,0 +1,340 @@
+/**
+ * @file DebugConsole.c
+ * @brief Serielle Diagnose-Konsole (esp_console REPL)
+ *
+ * Die REPL läuft in einem eigenen Task mit niedriger Priorität. Die Befehle
+ * lesen nur Zähler/Statistiken der Module und verändern keinen Spielzustand;
+ * Resets werden nur angefordert und vom besitzenden Task ausgeführt.
+ */
+
+#include "DebugConsole.h"
+#include "sdkconfig.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if CONFIG_TETRIS_DEBUG_CONSOLE
+
+#include "esp_console.h"
+#include "esp_err.h"
+#include "Controls.h"
+#include "LatencyTrace.h"
+#include "Profiler.h"
+#include "SysMonitor.h"
+#include "BinLog.h"
+#include "Trace.h"
+#include "GameLoop.h"
+#include "TaskConfig.h"
+#include "StressBench.h"
+#include "PostProcess.h"
+#include "PowerLimit.h"
+#include "FrameSink.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+// ============================================================================
+// BEFEHLE
+// ============================================================================
+
+/**
+ * @brief latency [reset] - Latenz-Tabelle ausgeben bzw. zurücksetzen
+ */
+static int cmd_latency(int argc, char **argv) {
+    if (argc > 1 && strcmp(argv[1], "reset") == 0) {
+        latency_trace_request_reset();
+        printf("[Console] Latency histograms reset on next frame\n");
+        return 0;
+    }
+    latency_trace_print();
+    return 0;
+}
+
+/**
+ * @brief input - Zähler des Input-Rings
+ */
+static int cmd_input(int argc, char **argv) {
+    controls_stats_t stats;
+    controls_get_stats(&stats);
+    printf("[Console] Input ring: %lu events, %lu dropped, high water %lu/%d, %lu pending\n",
+           (unsigned long)stats.pushed, (unsigned long)stats.overflows,
+           (unsigned long)stats.high_water, INPUT_RING_SIZE, (unsigned long)stats.pending);
+    return 0;
+}
+
+/**
+ * @brief prof [reset] - Laufzeit pro Stufe (Snapshot vom GameLoop am Iterationsende)
+ */
+static int cmd_prof(int argc, char **argv) {
+    if (argc > 1 && strcmp(argv[1], "reset") == 0) {
+        profiler_request_reset();
+        printf("[Console] Profiler histograms reset after the current frame\n");
+        return 0;
+    }
+
+    // GameLoop kopiert beim nächsten Iterationsende; WAIT/Splash iteriert alle 40ms
+    profiler_request_snapshot();
+    for (int i = 0; i < 50 && !profiler_snapshot_ready(); i++) {
+        vTaskDelay(1);
+    }
+    profiler_print_snapshot();
+    return 0;
+}
+
+/**
+ * @brief sysmon - Report des System-Monitors sofort ausgeben
+ */
+static int cmd_sysmon(int argc, char **argv) {
+    sysmon_request_report();
+    return 0;
+}
+
+/**
+ * @brief log - Zähler des binären Logs
+ */
+static int cmd_log(int argc, char **argv) {
+    binlog_stats_t stats;
+    binlog_get_stats(&stats);
+    printf("[Console] Binary log: %lu records, %lu dropped (%d per core ring)\n",
+           (unsigned long)stats.written, (unsigned long)stats.dropped, BINLOG_RING_SIZE);
+    return 0;
+}
+
+/**
+ * @brief trace [dump|clear|on|off] - Zeitleiste (tools/trace2chrome.py)
+ */
+static int cmd_trace(int argc, char **argv) {
+    const char *sub = argc > 1 ? argv[1] : "";
+
+    if (strcmp(sub, "dump") == 0) {
+        trace_dump();
+    } else if (strcmp(sub, "clear") == 0) {
+        trace_clear();
+        printf("[Console] Trace ring cleared\n");
+    } else if (strcmp(sub, "on") == 0 || strcmp(sub, "off") == 0) {
+        trace_set_enabled(sub[1] == 'n');
+        printf("[Console] Trace recording %s\n", sub);
+    } else {
+        trace_stats_t stats;
+        trace_get_stats(&stats);
+        printf("[Console] Trace: %s, %lu events recorded, ring holds the last %lu\n",
+               stats.enabled ? "recording" : "paused",
+               (unsigned long)stats.recorded, (unsigned long)stats.capacity);
+    }
+    return 0;
+}
+
+/**
+ * @brief deadline [reset] - Frame-Überläufe, Slack und Abwurf-Stufe
+ */
+static int cmd_deadline(int argc, char **argv) {
+    if (argc > 1 && strcmp(argv[1], "reset") == 0) {
+        game_loop_request_deadline_reset();
+        printf("[Console] Deadline statistics reset after the current frame\n");
+        return 0;
+    }
+
+    frame_deadline_t fd;
+    game_loop_get_deadline(&fd);
+    long mean = fd.frames ? (long)(fd.slack_sum_us / fd.frames) : 0;
+    printf("[Console] Frames: %lu, overruns: %lu, budget %ld us\n",
+           (unsigned long)fd.frames, (unsigned long)fd.overruns, (long)fd.budget_us);
+    printf("[Console] Slack: last %ld us, mean %ld us, min %ld us\n",
+           (long)fd.last_slack_us, mean, fd.frames ? (long)fd.min_slack_us : 0L);
+    printf("[Console] Quality: %s (level %d), %lu sheds, %lu restores\n",
+           frame_deadline_level_name(fd.level), (int)fd.level,
+           (unsigned long)fd.shed_count, (unsigned long)fd.restore_count);
+    return 0;
+}
+
+#if CONFIG_TETRIS_POSTPROCESS
+/**
+ * @brief post [brightness <0..255>|dither on|off] - Frame-Nachbearbeitung: Helligkeit, Dithering, Kernel-Zeit
+ */
+static int cmd_post(int argc, char **argv) {
+    if (argc >= 3 && strcmp(argv[1], "brightness") == 0) {
+        char *end = NULL;
+        long value = strtol(argv[2], &end, 10);
+        if (*end != '\0' || value < 0 || value > 255) {
+            printf("[Console] Usage: post brightness <0..255>\n");
+            return 1;
+        }
+        post_request_brightness((uint8_t)value);  // Vom Render-Pfad beim nächsten Frame übernommen
+        printf("[Console] Post brightness %ld requested\n", value);
+        return 0;
+    }
+    if (argc >= 3 && strcmp(argv[1], "dither") == 0) {
+        bool on = strcmp(argv[2], "on") == 0;
+        if (!on && strcmp(argv[2], "off") != 0) {
+            printf("[Console] Usage: post dither on|off\n");
+            return 1;
+        }
+        post_request_dither(on);
+        printf("[Console] Post dither %s requested\n", on ? "on" : "off");
+        return 0;
+    }
+
+    post_stats_t stats;
+    post_get_stats(&stats);
+    printf("[Console] Post: brightness %u, gamma %.1f, dither %s\n",
+           (unsigned)post_get_brightness(), (double)POST_GAMMA, post_get_dither() ? "on" : "off");
+    printf("[Console] Kernel: %lu frames, last %lu us, max %lu us, %lu over %d us budget\n",
+           (unsigned long)stats.frames, (unsigned long)(stats.last_ticks / PROFILE_TICKS_PER_US),
+           (unsigned long)(stats.max_ticks / PROFILE_TICKS_PER_US), (unsigned long)stats.over_budget,
+           POST_BUDGET_US);
+    return 0;
+}
+#endif
+
+#if CONFIG_TETRIS_CURRENT_LIMIT
+/**
+ * @brief power - Geschätzter LED-Strom und wie oft der Limiter skaliert
+ */
+static int cmd_power(int argc, char **argv) {
+    power_stats_t stats;
+    power_limit_get_stats(&stats);
+    printf("[Console] Power: %lu mA now, %lu mA peak, budget %d mA\n",
+           (unsigned long)stats.last_ma, (unsigned long)stats.peak_ma, LED_CURRENT_BUDGET_MA);
+    printf("[Console] Limiter: %lu of %lu frames scaled (%lu events), scale %u%%, min %u%%\n",
+           (unsigned long)stats.limited_frames, (unsigned long)stats.frames,
+           (unsigned long)stats.limit_events, (unsigned)(stats.scale * 100 / POWER_SCALE_ONE),
+           (unsigned)(stats.min_scale * 100 / POWER_SCALE_ONE));
+    return 0;
+}
+#endif
+
+/**
+ * @brief sink [<name> on|off] - Frame-Senken mit Kosten pro Frame, Senke umschalten
+ */
+static int cmd_sink(int argc, char **argv) {
+    if (argc >= 3) {
+        frame_sink_t *sink = frame_sink_find(argv[1]);
+        bool on = strcmp(argv[2], "on") == 0;
+        if (sink == NULL || (!on && strcmp(argv[2], "off") != 0)) {
+            printf("[Console] Usage: sink [<name> on|off]\n");
+            return 1;
+        }
+        frame_sink_request_enable(sink, on);  // Vom GameLoop beim nächsten Frame ausgeführt
+        printf("[Console] Sink '%s' %s requested\n", sink->name, on ? "on" : "off");
+        return 0;
+    }
+
+    frame_sink_print_stats();
+    return 0;
+}
+
+/**
+ * @brief frame - Letzten Frame aus der Shared-Senke ausgeben (rrggbb pro LED, Zeile = y)
+ *
+ * Liest über frame_shared_read() wie jeder andere Leser, der GameLoop wird nicht blockiert.
+ */
+static int cmd_frame(int argc, char **argv) {
+    static pixel_rgb_t s_frame[COMPOSITOR_PIXELS];  // Nicht auf dem Konsolen-Stack
+
+    for (int i = 0; i < frame_sink_count(); i++) {
+        frame_sink_t *sink = frame_sink_get(i);
+        const frame_shared_t *shared = frame_sink_shared_buffer(sink);
+        if (shared == NULL) continue;
+
+        uint32_t seq = frame_shared_read(shared, s_frame);
+        printf("[Console] Frame from sink '%s' (%s): seq %lu, %ux%u\n", sink->name,
+               sink->enabled ? "on" : "off", (unsigned long)seq, shared->width, shared->height);
+        for (int y = 0; y < shared->height; y++) {
+            printf("%2d", y);
+            for (int x = 0; x < shared->width; x++) {
+                const pixel_rgb_t *p = &s_frame[y * shared->width + x];
+                printf(" %02x%02x%02x", p->r, p->g, p->b);
+            }
+            printf("\n");
+        }
+        return 0;
+    }
+
+    printf("[Console] No shared frame sink registered (CONFIG_TETRIS_SINK_SHARED)\n");
+    return 1;
+}
+
+/**
+ * @brief tasks - Task-Topologie (Core, Priorität, Stack)
+ */
+static int cmd_tasks(int argc, char **argv) {
+    task_config_print();
+    return 0;
+}
+
+#if CONFIG_TETRIS_STRESS_BENCH
+/**
+ * @brief bench - Stress-Benchmark erneut starten
+ */
+static int cmd_bench(int argc, char **argv) {
+    stress_bench_start();
+    return 0;
+}
+#endif
+
+static const esp_console_cmd_t s_commands[] = {
+    { .command = "latency", .help = "Input-to-photon latency per button (p50/p95/p99)",
+      .hint = "[reset]", .func = cmd_latency },
+    { .command = "input", .help = "Input ring counters", .hint = NULL, .func = cmd_input },
+    { .command = "prof", .help = "Frame time per stage (min/mean/p99/max)",
+      .hint = "[reset]", .func = cmd_prof },
+    { .command = "sysmon", .help = "CPU per task, stack high-water marks, heap",
+      .hint = NULL, .func = cmd_sysmon },
+    { .command = "log", .help = "Binary log counters", .hint = NULL, .func = cmd_log },
+    { .command = "trace", .help = "Timeline trace ring (dump for tools/trace2chrome.py)",
+      .hint = "[dump|clear|on|off]", .func = cmd_trace },
+    { .command = "deadline", .help = "Frame overruns, slack and shed quality level",
+      .hint = "[reset]", .func = cmd_deadline },
+    { .command = "sink", .help = "Frame sinks (cost per frame), switch one on or off",
+      .hint = "[<name> on|off]", .func = cmd_sink },
+    { .command = "frame", .help = "Dump the last presented frame from the shared sink",
+      .hint = NULL, .func = cmd_frame },
+    { .command = "tasks", .help = "Task topology (core, priority, stack)", .hint = NULL,
+      .func = cmd_tasks },
+#if CONFIG_TETRIS_POSTPROCESS
+    { .command = "post", .help = "Frame post-processing (gamma, brightness, dither cost)",
+      .hint = "[brightness <0..255>|dither on|off]", .func = cmd_post },
+#endif
+#if CONFIG_TETRIS_CURRENT_LIMIT
+    { .command = "power", .help = "Estimated LED current and limiter activity",
+      .hint = NULL, .func = cmd_power },
+#endif
+#if CONFIG_TETRIS_STRESS_BENCH
+    { .command = "bench", .help = "Run the topology stress benchmark", .hint = NULL,
+      .func = cmd_bench },
+#endif
+};
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+void debug_console_start(void) {
+    esp_console_repl_t *repl = NULL;
+    esp_console_repl_config_t repl_config = ESP_CONSOLE_REPL_CONFIG_DEFAULT();
+    repl_config.prompt = "tetris>";
+    const task_config_t *task = task_config(TASK_ROLE_CONSOLE);
+    repl_config.task_priority = task->priority;  // Unter GameLoop und Theme (TaskConfig.c)
+    repl_config.task_stack_size = task->stack_bytes;
+    repl_config.task_core_id = task->core;
+
+    esp_console_dev_uart_config_t uart_config = ESP_CONSOLE_DEV_UART_CONFIG_DEFAULT();
+    if (esp_console_new_repl_uart(&uart_config, &repl_config, &repl) != ESP_OK) {
+        printf("[Console] Failed to create REPL, console disabled\n");
+        return;
+    }
+
+    esp_console_register_help_command();
+    for (size_t i = 0; i < sizeof(s_commands) / sizeof(s_commands[0]); i++) {
+        esp_console_cmd_register(&s_commands[i]);
+    }
+
+    esp_console_start_repl(repl);
+    printf("[Console] Debug console ready (type 'help')\n");
+}
+
+#else
+
+void debug_console_start(void) {
+}
+
+#endif // CONFIG_TETRIS_DEBUG_CONSOLE
@@ -0,0 +1,106 @@
+/**
+ * @file AutoShift.c
+ * @brief Delayed Auto-Shift / Auto-Repeat für LEFT und RIGHT
+ *
+ * Vorher bewegte ein gehaltener Button den Block einmal pro BUTTON_DEBOUNCE_MS
+ * (150ms) über check_button_pressed(). Entprellzeit und Wiederholrate waren
+ * dieselbe Konstante, das Spielfeld zu durchqueren dauerte über 2 Sekunden.
+ *
+ * Jetzt:
+ * - Schritt k ist fällig bei start (k=0) bzw. start + DAS + (k-1)*ARR
+ * - start ist der µs-Zeitstempel der entprellten Press-Flanke
+ * - Verspätete Verarbeitung holt alle fälligen Schritte nach (exaktes Timing)
+ *
+ * Reine Logik ohne FreeRTOS-/ESP-Abhängigkeiten (Host-kompilierbar).
+ */
+
+#include "AutoShift.h"
+#include <stdint.h>
+
+/** @brief Untergrenze für ARR (verhindert Division durch 0 / Endlosschleifen) */
+#define AUTOSHIFT_MIN_ARR_US  1000
+
+// ============================================================================
+// HELPER FUNKTIONEN
+// ============================================================================
+
+/**
+ * @brief Aktiviert eine Richtung ab t_us (erster Schritt sofort fällig)
+ */
+static void autoshift_start(autoshift_t *s, int dir, int64_t t_us) {
+    s->dir = dir;
+    s->start_us = t_us;
+    s->steps_done = 0;
+}
+
+/**
+ * @brief Anzahl der insgesamt bis now_us fälligen Schritte seit start_us
+ */
+static uint64_t autoshift_due_steps(const autoshift_t *s, int64_t now_us) {
+    if (now_us < s->start_us) return 0;
+
+    int64_t charged_at = s->start_us + s->das_us;
+    if (now_us < charged_at) return 1;
+
+    return 2 + (uint64_t)((now_us - charged_at) / s->arr_us);
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+void autoshift_init(autoshift_t *s, int64_t das_us, int64_t arr_us) {
+    s->das_us = (das_us > 0) ? das_us : 0;
+    s->arr_us = (arr_us > AUTOSHIFT_MIN_ARR_US) ? arr_us : AUTOSHIFT_MIN_ARR_US;
+    autoshift_reset(s);
+}
+
+void autoshift_reset(autoshift_t *s) {
+    s->held_left = false;
+    s->held_right = false;
+    s->dir = 0;
+    s->start_us = 0;
+    s->steps_done = 0;
+}
+
+void autoshift_press(autoshift_t *s, int dir, int64_t t_us) {
+    if (dir == AUTOSHIFT_LEFT) s->held_left = true;
+    else if (dir == AUTOSHIFT_RIGHT) s->held_right = true;
+    else return;
+
+    autoshift_start(s, dir, t_us);  // Zuletzt gedrückte Richtung gewinnt
+}
+
+void autoshift_release(autoshift_t *s, int dir, int64_t t_us) {
+    if (dir == AUTOSHIFT_LEFT) s->held_left = false;
+    else if (dir == AUTOSHIFT_RIGHT) s->held_right = false;
+    else return;
+
+    if (s->dir != dir) return;
+
+    // Andere Richtung noch gehalten → ab jetzt neu mit DAS starten
+    if (s->held_left) autoshift_start(s, AUTOSHIFT_LEFT, t_us);
+    else if (s->held_right) autoshift_start(s, AUTOSHIFT_RIGHT, t_us);
+    else s->dir = 0;
+}
+
+int autoshift_take(autoshift_t *s, int64_t now_us, int max_steps) {
+    if (s->dir == 0 || max_steps <= 0) return 0;
+
+    uint64_t due = autoshift_due_steps(s, now_us);
+    if (due <= s->steps_done) return 0;
+
+    uint64_t steps = due - s->steps_done;
+    s->steps_done = (uint32_t)due;  // Überzählige Schritte (Wand) verfallen
+    return (steps > (uint64_t)max_steps) ? max_steps : (int)steps;
+}
+
+int autoshift_direction(const autoshift_t *s) {
+    return s->dir;
+}
+
+int64_t autoshift_next_us(const autoshift_t *s) {
+    if (s->dir == 0) return INT64_MAX;
+    if (s->steps_done == 0) return s->start_us;
+    return s->start_us + s->das_us + (int64_t)(s->steps_done - 1) * s->arr_us;
+}
@@ -0,0 +1,89 @@
+/**
+ * @file Chord.c
+ * @brief Zustandsautomat für Tastenkombinationen (Song-Wechsel, Emergency Reset)
+ *
+ * Vorher: LEFT+RIGHT bzw. ROTATE+FASTER → vTaskDelay(1000) im GameLoop,
+ * danach Busy-Wait auf gpio_get_level() bis zum Loslassen. Das Spiel stand
+ * über eine Sekunde, auch bei versehentlichem Doppel-Druck.
+ *
+ * Jetzt:
+ * - Gehaltene Buttons werden aus dem Event-Stream mitgeführt
+ * - IDLE → HOLDING (exakt eine Kombination gehalten, since = Event-Zeitstempel)
+ * - HOLDING → FIRED nach hold_us (Aktion wird genau einmal geliefert)
+ * - Jede Änderung der gehaltenen Buttons bricht HOLDING ab
+ * - FIRED bleibt, bis die Kombination gelöst wird (keine Wiederholung)
+ *
+ * Reine Logik ohne FreeRTOS-/ESP-Abhängigkeiten (Host-kompilierbar).
+ */
+
+#include "Chord.h"
+
+// ============================================================================
+// HELPER FUNKTIONEN
+// ============================================================================
+
+/**
+ * @brief Index der Kombination, die exakt held_mask entspricht (-1 wenn keine)
+ */
+static int chord_match(const chord_recognizer_t *r, uint8_t held_mask) {
+    for (int i = 0; i < r->num_defs; i++) {
+        if (r->defs[i].mask == held_mask) return i;
+    }
+    return -1;
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+void chord_init(chord_recognizer_t *r, const chord_def_t *defs, int num_defs) {
+    r->defs = defs;
+    r->num_defs = num_defs;
+    chord_reset(r);
+}
+
+void chord_reset(chord_recognizer_t *r) {
+    r->held_mask = 0;
+    r->candidate = -1;
+    r->since_us = 0;
+    r->fired = false;
+}
+
+void chord_feed(chord_recognizer_t *r, const input_event_t *ev) {
+    if (ev->button >= BUTTON_COUNT) return;
+
+    uint8_t prev_mask = r->held_mask;
+    if (ev->edge == INPUT_EDGE_PRESS) r->held_mask |= CHORD_MASK(ev->button);
+    else r->held_mask &= ~CHORD_MASK(ev->button);
+    if (r->held_mask == prev_mask) return;
+
+    // Ausgelöste Kombination bleibt gesperrt, bis einer ihrer Buttons losgelassen wird
+    if (r->fired && r->candidate >= 0) {
+        uint8_t mask = r->defs[r->candidate].mask;
+        if ((r->held_mask & mask) == mask) return;
+    }
+
+    // Jede andere Änderung: neu bewerten (bricht eine laufende Haltezeit ab)
+    r->fired = false;
+    r->candidate = chord_match(r, r->held_mask);
+    r->since_us = ev->timestamp_us;
+}
+
+chord_action_t chord_poll(chord_recognizer_t *r, int64_t now_us) {
+    if (r->candidate < 0 || r->fired) return CHORD_ACTION_NONE;
+
+    const chord_def_t *def = &r->defs[r->candidate];
+    if (now_us - r->since_us < def->hold_us) return CHORD_ACTION_NONE;
+
+    r->fired = true;
+    return def->action;
+}
+
+bool chord_pending(const chord_recognizer_t *r) {
+    return r->candidate >= 0 && !r->fired;
+}
+
+int64_t chord_deadline_us(const chord_recognizer_t *r) {
+    if (!chord_pending(r)) return INT64_MAX;
+    return r->since_us + r->defs[r->candidate].hold_us;
+}
@@ -1,47 +1,81 @@
 /**
  * @file Controls.c
- * @brief Button-Input-System mit ISR und Event-Queue
+ * @brief Button-Input-System mit Timer-Abtastung und Event-Ring
  * 
- * Dieses Modul implementiert ein interrupt-basiertes Button-System:
- * - GPIO-ISR erkennt Button-Presses (negative Flanke)
- * - Events werden in FreeRTOS Queue gepusht
- * - Software-Debouncing verhindert Prellen
- * - Polling-Funktionen für direkten GPIO-Zugriff
+ * Dieses Modul implementiert ein abtastendes Button-System:
+ * - Periodischer esp_timer (BUTTON_SAMPLE_PERIOD_US) liest alle Buttons
+ * - Pro Button entprellt ein Integrator (Debounce.c) die Roh-Pegel
+ * - Saubere Press-/Release-Events mit µs-Zeitstempel landen in EINEM
+ *   lock-freien SPSC Ring (InputRing.c) und wecken den GameLoop
+ * - Alle Consumer (GameLoop, Splash, Restart) lesen über dieselbe API
  */
 
 #include "Controls.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "freertos/semphr.h"
 #include "driver/gpio.h"
 #include <stdint.h>
 #include <stdbool.h>
 #include "Globals.h"
-#include "freertos/queue.h"
+#include "Debounce.h"
+#include "InputRing.h"
+#include "Scheduler.h"
+#include "Clock.h"
+#include "BinLog.h"
+#include "Trace.h"
+#include "esp_timer.h"
 #include <stdio.h>
 
 // ============================================================================
 // PRIVATE VARIABLEN
 // ============================================================================
 
-/** @brief FreeRTOS Queue für Button-Events aus ISR (Kapazität: 8 Events) */
-static QueueHandle_t s_button_queue = NULL;
+/** @brief Ringpuffer für Button-Events (Producer: Abtaster, Consumer: GameLoop) */
+static input_ring_t s_input_ring;
+
+/** @brief Signalisiert neue Events für blockierende Consumer (controls_wait_press) */
+static SemaphoreHandle_t s_input_sem = NULL;
+
+/** @brief Periodischer Abtast-Timer */
+static esp_timer_handle_t s_sample_timer = NULL;
+
+/** @brief GPIO pro Button (Index = button_id_t) */
+static const gpio_num_t s_button_gpio[BUTTON_COUNT] = {
+    [BUTTON_LEFT] = BTN_LEFT,
+    [BUTTON_RIGHT] = BTN_RIGHT,
+    [BUTTON_ROTATE] = BTN_ROTATE,
+    [BUTTON_FASTER] = BTN_FASTER,
+};
+
+/** @brief Integrator-Debouncer pro Button (nur im Timer-Callback verändert) */
+static debounce_t s_debounce[BUTTON_COUNT];
+
+/** @brief Entprellter Zustand pro Button (vom Timer geschrieben, vom Task gelesen) */
+static volatile bool s_held[BUTTON_COUNT] = {0};
+
+/** @brief Zeitpunkt, ab dem der Integrator den Ruhezustand verlassen hat (Latenz-Messung) */
+static int64_t s_raw_since_us[BUTTON_COUNT] = {0};
+
+/** @brief Synthetische Flanken (StressBench): Bit 2*Button + Flanke, vom Abtaster übernommen */
+static uint32_t s_inject_mask = 0;
+
+/** @brief Zuletzt gemeldeter Overflow-Zähler (nur Consumer) */
+static uint32_t s_reported_overflows = 0;
 
 // ============================================================================
 // HELPER FUNKTIONEN (REDUNDANZEN ELIMINATED)
 // ============================================================================
 
 /**
- * @brief Helper-Funktion: Button-Name für Logging ermitteln
- * 
- * REDUNDANZ ELIMINATED: Button-Name Lookup war vorher in mehreren
- * Funktionen wiederholt. Jetzt konsolidiert in EINER Stelle!
+ * @brief Meldet neue Overflows einmalig (Consumer-Kontext, nicht im Abtaster)
  */
-static const char* get_button_name(gpio_num_t gpio) {
-    if (gpio == BTN_LEFT) return "LEFT";
-    else if (gpio == BTN_RIGHT) return "RIGHT";
-    else if (gpio == BTN_ROTATE) return "ROTATE";
-    else if (gpio == BTN_FASTER) return "FASTER";
-    else return "UNKNOWN";
+static void report_overflows(void) {
+    uint32_t overflows = __atomic_load_n(&s_input_ring.overflows, __ATOMIC_RELAXED);
+    if (overflows != s_reported_overflows) {
+        BLOG(LOG_INPUT_OVERFLOW, overflows);
+        s_reported_overflows = overflows;
+    }
 }
 
 // ============================================================================
@@ -49,35 +83,66 @@ static const char* get_button_name(gpio_num_t gpio) {
 // ============================================================================
 
 /**
- * @brief ISR-Handler für Button-Events (läuft im Interrupt-Kontext)
+ * @brief Abtast-Callback (läuft im esp_timer Task, alle BUTTON_SAMPLE_PERIOD_US)
  * 
- * Dieser Handler wird bei jedem Button-Press getriggert und läuft im IRAM
- * für minimale Latenz. Die Verarbeitung ist bewusst minimal:
- * - GPIO-Nummer in Queue pushen
- * - Context Switch triggern falls höher-prioritärer Task wartet
+ * - Liest alle 4 Pegel (aktiv-LOW)
+ * - Speist sie in die Integratoren, merkt sich die erste abweichende Abtastung
+ *   (raw_us: physische Flanke, Basis der Input-to-Photon Messung)
+ * - Schreibt erzeugte Events in den Ring und weckt den GameLoop
  * 
- * WICHTIG: Keine zeitintensiven Operationen oder Blocking-Calls hier!
- * Die eigentliche Debouncing-Logik erfolgt im Task-Kontext.
+ * Einziger Producer des Rings. Bewusst minimal, kein printf.
  * 
- * @param arg GPIO-Nummer (cast von void*)
+ * @param arg Unused (NULL)
  */
-static void IRAM_ATTR gpio_isr_handler(void* arg)
+static void button_sample_cb(void *arg)
 {
-    // Queue-Check (sollte nie NULL sein nach init_controls)
-    if (s_button_queue == NULL) return;
-    
-    // GPIO-Nummer aus Argument extrahieren
-    gpio_num_t g = (gpio_num_t)(intptr_t)arg;
-    
-    // Flag für Context Switch
-    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
-    
-    // Event in Queue pushen (non-blocking ISR-Version)
-    xQueueSendFromISR(s_button_queue, &g, &xHigherPriorityTaskWoken);
-    
-    // Context Switch durchführen falls höher-prioritärer Task geweckt wurde
-    if (xHigherPriorityTaskWoken) {
-        portYIELD_FROM_ISR();
+    int64_t now = clock_now_us();
+    bool any_event = false;
+
+    for (int i = 0; i < BUTTON_COUNT; i++) {
+        debounce_t *d = &s_debounce[i];
+        bool raw_pressed = (gpio_get_level(s_button_gpio[i]) == 0);
+        bool at_rest = (d->integrator == (d->pressed ? d->threshold : 0));
+        debounce_edge_t e = debounce_sample(d, raw_pressed);
+        if (at_rest && d->integrator != (d->pressed ? d->threshold : 0)) {
+            s_raw_since_us[i] = now;  // Erste Abtastung, die vom entprellten Zustand abweicht
+        }
+        if (e == DEBOUNCE_EDGE_NONE) continue;
+        if (at_rest) s_raw_since_us[i] = now;  // threshold 1: Flanke in derselben Abtastung
+
+        input_event_t ev = {
+            .button = (uint8_t)i,
+            .edge = (e == DEBOUNCE_EDGE_PRESS) ? INPUT_EDGE_PRESS : INPUT_EDGE_RELEASE,
+            .timestamp_us = now,
+            .raw_us = s_raw_since_us[i],
+        };
+        s_held[i] = (e == DEBOUNCE_EDGE_PRESS);
+        TRACE_INSTANT(TRACE_BUTTON, i | (ev.edge << 8));  // arg: Button | Flanke << 8
+
+        // Non-blocking: Ring voll → Event verwerfen (wird in overflows gezählt)
+        input_ring_push(&s_input_ring, &ev);
+        any_event = true;
+    }
+
+    // Synthetische Flanken: hier eingefügt, damit der Abtaster einziger Producer bleibt
+    uint32_t injected = __atomic_exchange_n(&s_inject_mask, 0, __ATOMIC_ACQUIRE);
+    for (int bit = 0; injected != 0; bit++, injected >>= 1) {
+        if (!(injected & 1)) continue;
+        input_event_t ev = {
+            .button = (uint8_t)(bit / 2),
+            .edge = (uint8_t)(bit % 2),
+            .timestamp_us = now,
+            .raw_us = now,
+        };
+        TRACE_INSTANT(TRACE_BUTTON, ev.button | (ev.edge << 8));
+        input_ring_push(&s_input_ring, &ev);
+        any_event = true;
+    }
+
+    // GameLoop sofort wecken (blockiert sonst bis zur nächsten Deadline)
+    if (any_event) {
+        xSemaphoreGive(s_input_sem);
+        scheduler_notify_input();
     }
 }
 
@@ -85,13 +150,12 @@ static void IRAM_ATTR gpio_isr_handler(void* arg)
  * @brief Initialisiert das Button-Control-System
  * 
  * Diese Funktion richtet die GPIO-Pins für die 4 Buttons ein:
- * 1. GPIO-Konfiguration (Input, Pull-up, Interrupt bei negativer Flanke)
- * 2. Event-Queue erstellen für ISR-to-Task Kommunikation
- * 3. ISR-Service installieren
- * 4. ISR-Handler für jeden Button registrieren
+ * 1. GPIO-Konfiguration (Input, Pull-up, kein Interrupt)
+ * 2. Debouncer mit aktuellem Pegel initialisieren (keine Phantom-Events beim Start)
+ * 3. Event-Ring und Signal-Semaphore anlegen
+ * 4. Periodischen Abtast-Timer starten
  * 
  * Die Buttons sind aktiv-LOW (gedrückt = 0V, nicht gedrückt = 3.3V via Pull-up)
- * ISR wird bei negativer Flanke (Button-Press) getriggert
  */
 void init_controls(void) {
     // GPIO-Konfiguration für alle 4 Buttons
@@ -101,147 +165,105 @@ void init_controls(void) {
         .mode = GPIO_MODE_INPUT,              // Input-Modus
         .pull_up_en = GPIO_PULLUP_ENABLE,     // Pull-up aktivieren (Button aktiv-LOW)
         .pull_down_en = GPIO_PULLDOWN_DISABLE,
-        .intr_type = GPIO_INTR_NEGEDGE        // Interrupt bei fallender Flanke (3.3V → 0V)
+        .intr_type = GPIO_INTR_DISABLE        // Kein Interrupt, Pegel werden abgetastet
     };
     gpio_config(&io_conf);
 
-    // FreeRTOS Queue für Button-Events erstellen (8 Events Kapazität)
-    if (s_button_queue == NULL) {
-        s_button_queue = xQueueCreate(8, sizeof(gpio_num_t));
+    for (int i = 0; i < BUTTON_COUNT; i++) {
+        bool pressed = (gpio_get_level(s_button_gpio[i]) == 0);
+        debounce_init(&s_debounce[i], BUTTON_DEBOUNCE_SAMPLES, pressed);
+        s_held[i] = pressed;
+    }
+
+    input_ring_init(&s_input_ring);
+    s_reported_overflows = 0;
+    if (s_input_sem == NULL) {
+        s_input_sem = xSemaphoreCreateBinary();
+    }
+
+    // Periodischen Abtast-Timer erstellen und starten
+    if (s_sample_timer == NULL) {
+        const esp_timer_create_args_t timer_args = {
+            .callback = button_sample_cb,
+            .arg = NULL,
+            .dispatch_method = ESP_TIMER_TASK,
+            .name = "btn_sample",
+        };
+        ESP_ERROR_CHECK(esp_timer_create(&timer_args, &s_sample_timer));
     }
+    esp_timer_start_periodic(s_sample_timer, BUTTON_SAMPLE_PERIOD_US);
 
-    // GPIO ISR-Service installieren (globaler Service für alle GPIOs)
-    gpio_install_isr_service(0);
-    
-    // ISR-Handler für jeden Button registrieren
-    // Der Handler läuft im IRAM (schneller Zugriff) und pusht GPIO-Nummer in Queue
-    gpio_isr_handler_add(BTN_LEFT, gpio_isr_handler, (void*)(intptr_t)BTN_LEFT);
-    gpio_isr_handler_add(BTN_RIGHT, gpio_isr_handler, (void*)(intptr_t)BTN_RIGHT);
-    gpio_isr_handler_add(BTN_ROTATE, gpio_isr_handler, (void*)(intptr_t)BTN_ROTATE);
-    gpio_isr_handler_add(BTN_FASTER, gpio_isr_handler, (void*)(intptr_t)BTN_FASTER);
+    printf("[Controls] Sampling buttons every %d us, %d samples to settle\n",
+           BUTTON_SAMPLE_PERIOD_US, BUTTON_DEBOUNCE_SAMPLES);
 }
 
 /**
- * @brief Prüft ob ein Button aktuell gedrückt ist (Polling-Methode)
- * 
- * Diese Funktion liest den GPIO-Pin direkt aus und implementiert
- * Software-Debouncing um Button-Prellen zu verhindern.
- * 
- * Debouncing-Logik:
- * - Letzter Press-Zeitpunkt wird pro GPIO gespeichert
- * - Neuer Press wird nur akzeptiert wenn BUTTON_DEBOUNCE_MS vergangen
- * - Verhindert mehrfache Events durch mechanisches Prellen
- * 
- * @param gpio GPIO-Nummer des zu prüfenden Buttons
- * @return true wenn Button gedrückt und Debounce-Zeit verstrichen
- * @return false wenn Button nicht gedrückt oder innerhalb Debounce-Zeit
+ * @brief Liest das nächste Button-Event aus dem Ring (non-blocking)
+ *
+ * Der Zeitstempel stammt aus dem Abtaster, d.h. er beschreibt den Zeitpunkt
+ * der entprellten Flanke und nicht den Zeitpunkt der Verarbeitung
+ * (Basis für DAS/ARR).
+ *
+ * @param out_event Pointer zum Speichern des Events
+ * @return true wenn ein Event vorhanden ist
  */
-bool check_button_pressed(gpio_num_t gpio) {
-    // Statisches Array für letzten Press-Zeitpunkt pro GPIO
-    // (bleibt zwischen Funktionsaufrufen erhalten)
-    static uint32_t last_pressed_time[GPIO_NUM_MAX] = {0};
-    
-    // Button ist aktiv-LOW (gedrückt = 0V)
-    if (gpio_get_level(gpio) == 0) {
-        // Aktuelle Zeit in Millisekunden
-        uint32_t now = xTaskGetTickCount() * portTICK_PERIOD_MS;
-        
-        // Debounce-Check: Ist genug Zeit seit letztem Press vergangen?
-        if (now - last_pressed_time[gpio] > BUTTON_DEBOUNCE_MS) {
-            // Zeitstempel aktualisieren
-            last_pressed_time[gpio] = now;
-            
-            // Debug-Logging: Button-Namen mit HELPER-FUNKTION ermitteln (REDUNDANZ ELIMINATED)
-            printf("[Button] %s pressed (GPIO %d)\n", get_button_name(gpio), gpio);
-            
-            return true;
-        }
-    }
-    return false;
+bool controls_poll(input_event_t *out_event) {
+    report_overflows();
+    return input_ring_pop(&s_input_ring, out_event);
 }
 
 /**
- * @brief Liest Button-Event aus ISR-Queue (non-blocking)
+ * @brief Wartet auf den nächsten Button-PRESS (blocking mit Timeout)
  * 
- * Diese Funktion ist die primäre Methode um Button-Events zu konsumieren:
- * 1. Event aus Queue lesen (non-blocking, Timeout = 0)
- * 2. Software-Debouncing im Task-Kontext durchführen
- * 3. Event nur akzeptieren wenn Debounce-Zeit verstrichen
+ * Release-Events werden dabei verbraucht.
+ * Nützlich für Warte-Zustände (z.B. Splash-Screen, Restart).
  * 
- * Vorteile gegenüber Polling:
- * - Event-driven (keine CPU-Zeit verschwendet)
- * - ISR-Queue puffert Events während Task beschäftigt
- * - Zuverlässigeres Timing als reines Polling
- * 
- * @param out_gpio Pointer zum Speichern der GPIO-Nummer
- * @return true wenn Event vorhanden und Debounce OK
- * @return false wenn keine Events oder innerhalb Debounce-Zeit
+ * @param out_event Pointer zum Speichern des Events (darf NULL sein)
+ * @param timeout_us Timeout in µs (< 0 = unendlich)
+ * @return true wenn Press empfangen
+ * @return false bei Timeout
  */
-bool controls_get_event(gpio_num_t *out_gpio) {
-    // Queue existiert?
-    if (s_button_queue == NULL) return false;
-    
-    gpio_num_t g;
-    
-    // Versuche Event aus Queue zu lesen (non-blocking, Timeout = 0)
-    if (xQueueReceive(s_button_queue, &g, 0) == pdTRUE) {
-        // Event empfangen → Software-Debouncing im Task-Kontext
-        static uint32_t last_pressed_time[GPIO_NUM_MAX] = {0};
-        uint32_t now = xTaskGetTickCount() * portTICK_PERIOD_MS;
-        
-        // Debounce-Check: Ist genug Zeit seit letztem Event für dieses GPIO vergangen?
-        if (now - last_pressed_time[g] > BUTTON_DEBOUNCE_MS) {
-            // Event akzeptieren
-            last_pressed_time[g] = now;
-            
-            // Debug-Logging
-            const char *btn_name = "UNKNOWN";
-            if (g == BTN_LEFT) btn_name = "LEFT";
-            else if (g == BTN_RIGHT) btn_name = "RIGHT";
-            else if (g == BTN_ROTATE) btn_name = "ROTATE";
-            else if (g == BTN_FASTER) btn_name = "FASTER";
-            printf("[Event] %s event from queue (GPIO %d)\n", btn_name, g);
-            
-            *out_gpio = g;
-            return true;
+bool controls_wait_press(input_event_t *out_event, int64_t timeout_us) {
+    input_event_t ev;
+    int64_t deadline = (timeout_us < 0) ? INT64_MAX : clock_now_us() + timeout_us;
+
+    while (1) {
+        while (controls_poll(&ev)) {
+            if (ev.edge == INPUT_EDGE_PRESS) {
+                if (out_event != NULL) *out_event = ev;
+                BLOG(LOG_INPUT_PRESS, ev.button);
+                return true;
+            }
+        }
+
+        TickType_t ticks = portMAX_DELAY;
+        if (deadline != INT64_MAX) {
+            int64_t remaining = deadline - clock_now_us();
+            if (remaining <= 0) return false;
+            const int64_t tick_us = (int64_t)portTICK_PERIOD_MS * 1000;
+            ticks = (TickType_t)((remaining + tick_us - 1) / tick_us);
         }
-        // Event innerhalb Debounce-Zeit → verwerfen
-        return false;
+        xSemaphoreTake(s_input_sem, ticks);
     }
-    // Keine Events in Queue
-    return false;
 }
 
 /**
- * @brief Wartet auf Button-Event aus Queue (blocking mit Timeout)
- * 
- * Wie controls_get_event(), aber mit Timeout:
- * - Blockiert Task bis Event verfügbar oder Timeout abgelaufen
- * - Nützlich für Warte-Zustände (z.B. Splash-Screen, Pause)
- * - Software-Debouncing wird auch hier angewendet
- * 
- * @param out_gpio Pointer zum Speichern der GPIO-Nummer
- * @param ticks_to_wait Timeout in FreeRTOS Ticks (portMAX_DELAY = unendlich)
- * @return true wenn Event empfangen und Debounce OK
- * @return false bei Timeout oder Debounce-Verwerfung
+ * @brief Verwirft alle ausstehenden Events
  */
-bool controls_wait_event(gpio_num_t *out_gpio, TickType_t ticks_to_wait) {
-    if (s_button_queue == NULL) return false;
-    
-    gpio_num_t g;
-    // Warte auf Event (blocking mit Timeout)
-    if (xQueueReceive(s_button_queue, &g, ticks_to_wait) == pdTRUE) {
-        // Software-Debouncing
-        static uint32_t last_pressed_time[GPIO_NUM_MAX] = {0};
-        uint32_t now = xTaskGetTickCount() * portTICK_PERIOD_MS;
-        
-        if (now - last_pressed_time[g] > BUTTON_DEBOUNCE_MS) {
-            last_pressed_time[g] = now;
-            *out_gpio = g;
-            return true;
-        }
-    }
-    return false;
+void controls_flush(void) {
+    input_ring_flush(&s_input_ring);
+    report_overflows();
+}
+
+/**
+ * @brief Entprellter Zustand eines Buttons
+ *
+ * @param button Button-ID
+ * @return true wenn der Button gehalten wird
+ */
+bool controls_is_held(button_id_t button) {
+    if (button >= BUTTON_COUNT) return false;
+    return s_held[button];
 }
 
 /**
@@ -249,45 +271,58 @@ bool controls_wait_event(gpio_num_t *out_gpio, TickType_t ticks_to_wait) {
  * 
  * Wird für Emergency Reset verwendet:
  * - Alle 4 Buttons gedrückt + 1 Sekunde halten = Hard Reset
- * - Direktes GPIO-Polling ohne Debouncing
- * - Aktiv-LOW: gedrückt = 0V
+ * - Entprellter Zustand des Abtasters
  * 
  * @return true wenn alle 4 Buttons aktuell gedrückt
  * @return false wenn mindestens 1 Button nicht gedrückt
  */
 bool controls_all_buttons_pressed(void) {
-    // Alle 4 GPIOs müssen LOW sein (Buttons sind aktiv-LOW)
-    if (gpio_get_level(BTN_LEFT) == 0 && 
-        gpio_get_level(BTN_RIGHT) == 0 &&
-        gpio_get_level(BTN_ROTATE) == 0 && 
-        gpio_get_level(BTN_FASTER) == 0) {
-        return true;
+    for (int i = 0; i < BUTTON_COUNT; i++) {
+        if (!s_held[i]) return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Prüft ob mindestens ein Button gehalten wird
+ */
+bool controls_any_button_held(void) {
+    for (int i = 0; i < BUTTON_COUNT; i++) {
+        if (s_held[i]) return true;
     }
     return false;
 }
 
-void controls_disable_isr(void) {
-    printf("[Controls] Disabling ISR for all buttons\n");
-    gpio_isr_handler_remove(BTN_LEFT);
-    gpio_isr_handler_remove(BTN_RIGHT);
-    gpio_isr_handler_remove(BTN_ROTATE);
-    gpio_isr_handler_remove(BTN_FASTER);
-    // Disable GPIO interrupts completely
-    gpio_intr_disable(BTN_LEFT);
-    gpio_intr_disable(BTN_RIGHT);
-    gpio_intr_disable(BTN_ROTATE);
-    gpio_intr_disable(BTN_FASTER);
+/**
+ * @brief Synthetische Flanke einspeisen (StressBench, Host-Simulation)
+ *
+ * Wird bei der nächsten Abtastung (≤ BUTTON_SAMPLE_PERIOD_US) als Event ohne
+ * Entprellung in den Ring geschrieben. Ändert den gehaltenen Zustand nicht.
+ */
+void controls_inject(button_id_t button, input_edge_t edge) {
+    if (button >= BUTTON_COUNT) return;
+    __atomic_fetch_or(&s_inject_mask, 1u << (button * 2 + edge), __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Liefert die Zähler des Event-Rings
+ */
+void controls_get_stats(controls_stats_t *out) {
+    out->pushed = __atomic_load_n(&s_input_ring.pushed, __ATOMIC_RELAXED);
+    out->overflows = __atomic_load_n(&s_input_ring.overflows, __ATOMIC_RELAXED);
+    out->high_water = __atomic_load_n(&s_input_ring.high_water, __ATOMIC_RELAXED);
+    out->pending = input_ring_count(&s_input_ring);
 }
 
-void controls_enable_isr(void) {
-    printf("[Controls] Enabling ISR for all buttons\n");
-    // Re-enable GPIO interrupts
-    gpio_intr_enable(BTN_LEFT);
-    gpio_intr_enable(BTN_RIGHT);
-    gpio_intr_enable(BTN_ROTATE);
-    gpio_intr_enable(BTN_FASTER);
-    gpio_isr_handler_add(BTN_LEFT, gpio_isr_handler, (void*)(intptr_t)BTN_LEFT);
-    gpio_isr_handler_add(BTN_RIGHT, gpio_isr_handler, (void*)(intptr_t)BTN_RIGHT);
-    gpio_isr_handler_add(BTN_ROTATE, gpio_isr_handler, (void*)(intptr_t)BTN_ROTATE);
-    gpio_isr_handler_add(BTN_FASTER, gpio_isr_handler, (void*)(intptr_t)BTN_FASTER);
+/**
+ * @brief Helper-Funktion: Button-Name für Logging ermitteln
+ */
+const char *controls_button_name(button_id_t button) {
+    switch (button) {
+        case BUTTON_LEFT:   return "LEFT";
+        case BUTTON_RIGHT:  return "RIGHT";
+        case BUTTON_ROTATE: return "ROTATE";
+        case BUTTON_FASTER: return "FASTER";
+        default:            return "UNKNOWN";
+    }
 }
@@ -0,0 +1,44 @@
+/**
+ * @file Debounce.c
+ * @brief Integrator-Entprellung (eine Instanz pro Button)
+ *
+ * Vorher: Roh-Interrupts bei jeder Flanke, danach 150ms Sperrzeit.
+ * Prellen konnte die Queue füllen und jeder Press machte den Button
+ * für bis zu 150ms blind.
+ *
+ * Jetzt: Abtastung mit fester Periode (BUTTON_SAMPLE_PERIOD_US), der
+ * Integrator erzeugt eine saubere Flanke nach threshold übereinstimmenden
+ * Abtastungen (Netto). Latenz = threshold * Periode, keine Sperrzeit.
+ *
+ * Reine Logik ohne FreeRTOS-/ESP-Abhängigkeiten (Host-kompilierbar).
+ */
+
+#include "Debounce.h"
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+void debounce_init(debounce_t *d, uint8_t threshold, bool pressed) {
+    d->threshold = (threshold > 0) ? threshold : 1;
+    d->pressed = pressed;
+    d->integrator = pressed ? d->threshold : 0;
+}
+
+debounce_edge_t debounce_sample(debounce_t *d, bool raw_pressed) {
+    if (raw_pressed) {
+        if (d->integrator < d->threshold) d->integrator++;
+    } else {
+        if (d->integrator > 0) d->integrator--;
+    }
+
+    if (!d->pressed && d->integrator >= d->threshold) {
+        d->pressed = true;
+        return DEBOUNCE_EDGE_PRESS;
+    }
+    if (d->pressed && d->integrator == 0) {
+        d->pressed = false;
+        return DEBOUNCE_EDGE_RELEASE;
+    }
+    return DEBOUNCE_EDGE_NONE;
+}
@@ -0,0 +1,70 @@
+/**
+ * @file InputRing.c
+ * @brief Lock-freier SPSC Ringpuffer für Button-Events
+ *
+ * Vorher gab es zwei Input-Pfade: Polling über check_button_pressed() und
+ * die ISR-Queue über controls_get_event()/controls_wait_event(), jeweils mit
+ * eigenem Debounce-Array. Beide konnten sich widersprechen oder denselben
+ * Druck doppelt verbrauchen.
+ *
+ * Jetzt gibt es genau einen Ring: der Abtaster schreibt, der GameLoop liest.
+ * - Keine Locks, keine Critical Sections (nur Acquire/Release auf head/tail)
+ * - Indizes laufen frei über, Maskierung mit INPUT_RING_SIZE - 1
+ * - Volle Queue verwirft das NEUE Event und zählt es in overflows
+ *
+ * Reine Logik ohne FreeRTOS-/ESP-Abhängigkeiten (Host-kompilierbar).
+ */
+
+#include "InputRing.h"
+#include <string.h>
+
+#if (INPUT_RING_SIZE & (INPUT_RING_SIZE - 1)) != 0
+#error "INPUT_RING_SIZE must be a power of two"
+#endif
+
+#define RING_MASK (INPUT_RING_SIZE - 1)
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+void input_ring_init(input_ring_t *r) {
+    memset(r, 0, sizeof(*r));
+}
+
+bool input_ring_push(input_ring_t *r, const input_event_t *ev) {
+    uint32_t head = r->head;  // Nur der Producer schreibt head
+    uint32_t tail = __atomic_load_n(&r->tail, __ATOMIC_ACQUIRE);
+    uint32_t used = head - tail;
+
+    if (used >= INPUT_RING_SIZE) {
+        r->overflows++;
+        return false;
+    }
+
+    r->buf[head & RING_MASK] = *ev;
+    __atomic_store_n(&r->head, head + 1, __ATOMIC_RELEASE);  // Event erst danach sichtbar
+
+    r->pushed++;
+    if (used + 1 > r->high_water) r->high_water = used + 1;
+    return true;
+}
+
+bool input_ring_pop(input_ring_t *r, input_event_t *out) {
+    uint32_t tail = r->tail;  // Nur der Consumer schreibt tail
+    uint32_t head = __atomic_load_n(&r->head, __ATOMIC_ACQUIRE);
+
+    if (head == tail) return false;
+
+    *out = r->buf[tail & RING_MASK];
+    __atomic_store_n(&r->tail, tail + 1, __ATOMIC_RELEASE);  // Slot erst danach freigeben
+    return true;
+}
+
+uint32_t input_ring_count(const input_ring_t *r) {
+    return __atomic_load_n(&r->head, __ATOMIC_ACQUIRE) - r->tail;
+}
+
+void input_ring_flush(input_ring_t *r) {
+    __atomic_store_n(&r->tail, __atomic_load_n(&r->head, __ATOMIC_ACQUIRE), __ATOMIC_RELEASE);
+}
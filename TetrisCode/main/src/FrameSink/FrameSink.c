@@ -0,0 +1,172 @@
+/**
+ * @file FrameSink.c
+ * @brief Register der Frame-Senken, Kosten pro Senke, Benchmark
+ *
+ * Ersetzt die direkten led_strip_refresh() Aufrufe in GameLoop, Grid und
+ * Splash: compositor_present() gibt den fertigen Frame hierher, jede aktive
+ * Senke bekommt ihn nacheinander. Die Zeit pro Senke und Frame wird mit dem
+ * Profiler-Zähler gemessen (Konsole "sink").
+ */
+
+#include "FrameSink.h"
+#include "Globals.h"
+#include "Profiler.h"
+#include "sdkconfig.h"
+#include <string.h>
+
+static frame_sink_t *s_sinks[FRAME_SINK_MAX];
+static int s_sink_count = 0;
+
+/** @brief Maske für frisch aktivierte Senken */
+static uint32_t s_full_mask[COMPOSITOR_MASK_WORDS];
+
+// ============================================================================
+// REGISTER
+// ============================================================================
+
+esp_err_t frame_sink_register(frame_sink_t *sink, bool enabled) {
+    if (sink == NULL || sink->present == NULL) return ESP_ERR_INVALID_ARG;
+    if (s_sink_count >= FRAME_SINK_MAX) {
+        printf("[FrameSink] No slot for '%s' (FRAME_SINK_MAX %d)\n", sink->name, FRAME_SINK_MAX);
+        return ESP_ERR_NO_MEM;
+    }
+
+    if (s_sink_count == 0) {
+        memset(s_full_mask, 0xFF, sizeof(s_full_mask));
+    }
+
+    sink->enabled = enabled;
+    sink->request = -1;
+    sink->full = true;
+    sink->frames = 0;
+    sink->errors = 0;
+    sink->last_ticks = 0;
+    sink->max_ticks = 0;
+    sink->sum_ticks = 0;
+    s_sinks[s_sink_count++] = sink;
+
+    printf("[FrameSink] Registered '%s' (%s)\n", sink->name, enabled ? "on" : "off");
+    return ESP_OK;
+}
+
+int frame_sink_count(void) {
+    return s_sink_count;
+}
+
+frame_sink_t *frame_sink_get(int index) {
+    if (index < 0 || index >= s_sink_count) return NULL;
+    return s_sinks[index];
+}
+
+frame_sink_t *frame_sink_find(const char *name) {
+    for (int i = 0; i < s_sink_count; i++) {
+        if (strcmp(s_sinks[i]->name, name) == 0) return s_sinks[i];
+    }
+    return NULL;
+}
+
+void frame_sink_request_enable(frame_sink_t *sink, bool enabled) {
+    sink->request = enabled ? 1 : 0;
+}
+
+// ============================================================================
+// PRESENT
+// ============================================================================
+
+static void sink_present(frame_sink_t *sink, const pixel_rgb_t *frame, const uint32_t *changed) {
+    uint32_t start = profiler_now();
+    esp_err_t err = sink->present(sink, frame, changed);
+    uint32_t ticks = profiler_now() - start;
+
+    if (err != ESP_OK) sink->errors++;
+    sink->frames++;
+    sink->last_ticks = ticks;
+    sink->sum_ticks += ticks;
+    if (ticks > sink->max_ticks) sink->max_ticks = ticks;
+}
+
+void frame_sink_present_all(const pixel_rgb_t *frame, const uint32_t *changed) {
+    for (int i = 0; i < s_sink_count; i++) {
+        frame_sink_t *sink = s_sinks[i];
+
+        // Umschalten aus der Konsole hier im besitzenden Task ausführen
+        int8_t request = sink->request;
+        if (request >= 0) {
+            sink->request = -1;
+            if (request && !sink->enabled) sink->full = true;  // Hat Änderungen verpasst
+            sink->enabled = request;
+        }
+        if (!sink->enabled) continue;
+
+        sink_present(sink, frame, sink->full ? s_full_mask : changed);
+        sink->full = false;
+    }
+}
+
+void frame_sink_print_stats(void) {
+    for (int i = 0; i < s_sink_count; i++) {
+        const frame_sink_t *sink = s_sinks[i];
+        uint32_t mean = sink->frames ? (uint32_t)(sink->sum_ticks / sink->frames) : 0;
+        printf("[FrameSink] %-8s %-3s %7lu frames  last %5lu us  mean %5lu us  max %5lu us  errors %lu\n",
+               sink->name, sink->enabled ? "on" : "off", (unsigned long)sink->frames,
+               (unsigned long)(sink->last_ticks / PROFILE_TICKS_PER_US),
+               (unsigned long)(mean / PROFILE_TICKS_PER_US),
+               (unsigned long)(sink->max_ticks / PROFILE_TICKS_PER_US), (unsigned long)sink->errors);
+    }
+}
+
+// ============================================================================
+// BENCHMARK
+// ============================================================================
+
+#if CONFIG_TETRIS_FRAME_SINK_BENCH
+
+/** @brief Testbild n: Farbverlauf, der jeden Frame jeden Pixel ändert */
+static void bench_pattern(pixel_rgb_t *frame, int n) {
+    for (int y = 0; y < LED_HEIGHT; y++) {
+        for (int x = 0; x < LED_WIDTH; x++) {
+            pixel_rgb_t *p = &frame[y * LED_WIDTH + x];
+            p->r = (uint8_t)((x * 16 + n) & 0x3F);
+            p->g = (uint8_t)((y * 10 + n) & 0x3F);
+            p->b = (uint8_t)(((x + y) * 8 + n * 3) & 0x3F);
+        }
+    }
+}
+
+void frame_sink_bench(int frames) {
+    static pixel_rgb_t frame[COMPOSITOR_PIXELS];
+
+    printf("[FrameSink] Bench: %d full frames per sink (%d pixels)\n", frames, COMPOSITOR_PIXELS);
+    for (int i = 0; i < s_sink_count; i++) {
+        frame_sink_t *sink = s_sinks[i];
+        uint32_t min = UINT32_MAX, max = 0;
+        uint64_t sum = 0;
+
+        for (int n = 0; n < frames; n++) {
+            bench_pattern(frame, n + 1);
+            uint32_t start = profiler_now();
+            sink->present(sink, frame, s_full_mask);
+            uint32_t ticks = profiler_now() - start;
+            sum += ticks;
+            if (ticks < min) min = ticks;
+            if (ticks > max) max = ticks;
+        }
+
+        // Schwarz wie nach compositor_init() erwartet
+        memset(frame, 0, sizeof(frame));
+        sink->present(sink, frame, s_full_mask);
+
+        printf("[FrameSink] Bench %-8s min %6lu us  mean %6lu us  max %6lu us\n", sink->name,
+               (unsigned long)(min / PROFILE_TICKS_PER_US),
+               (unsigned long)(sum / frames / PROFILE_TICKS_PER_US),
+               (unsigned long)(max / PROFILE_TICKS_PER_US));
+    }
+}
+
+#else
+
+void frame_sink_bench(int frames) {
+    (void)frames;
+}
+
+#endif
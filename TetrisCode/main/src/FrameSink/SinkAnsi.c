@@ -0,0 +1,114 @@
+/**
+ * @file SinkAnsi.c
+ * @brief Frame-Senke: Matrix als farbige Blöcke im Terminal (ANSI, 24-Bit)
+ *
+ * Jede LED sind zwei Leerzeichen mit Hintergrundfarbe. Gezeichnet werden nur
+ * Pixel, die sich seit dem letzten Bild geändert haben (eigene Maske, weil
+ * Frames innerhalb von interval_ms ausgelassen werden); Cursor-Sprung und
+ * Farbwechsel nur, wenn nötig. Die LED-Werte sind sehr dunkel (Helligkeit
+ * steckt schon drin), fürs Terminal werden sie mit FRAME_SINK_ANSI_GAIN
+ * verstärkt.
+ */
+
+#include "FrameSink.h"
+#include "Globals.h"
+#include "esp_check.h"
+#include "Clock.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define ANSI_BUF_SIZE   1024
+#define ANSI_CMD_MAX    48          // Längste Sequenz pro Pixel (Cursor + Farbe + Zeichen)
+
+typedef struct {
+    frame_sink_t base;
+    FILE *out;
+    int64_t interval_us;
+    int64_t next_us;
+    uint32_t pending[COMPOSITOR_MASK_WORDS];
+    uint8_t view[256];              // LED-Wert → Terminal-Wert
+    size_t len;
+    char buf[ANSI_BUF_SIZE];
+} sink_ansi_t;
+
+static void ansi_flush(sink_ansi_t *sink) {
+    fwrite(sink->buf, 1, sink->len, sink->out);
+    sink->len = 0;
+}
+
+static void ansi_put(sink_ansi_t *sink, const char *fmt, unsigned a, unsigned b, unsigned c) {
+    if (sink->len + ANSI_CMD_MAX > ANSI_BUF_SIZE) ansi_flush(sink);
+    sink->len += snprintf(&sink->buf[sink->len], ANSI_BUF_SIZE - sink->len, fmt, a, b, c);
+}
+
+static esp_err_t ansi_sink_present(frame_sink_t *base, const pixel_rgb_t *frame, const uint32_t *changed) {
+    sink_ansi_t *sink = __containerof(base, sink_ansi_t, base);
+
+    for (int w = 0; w < COMPOSITOR_MASK_WORDS; w++) {
+        sink->pending[w] |= changed[w];
+    }
+
+    int64_t now = clock_now_us();
+    if (now < sink->next_us) return ESP_OK;
+    sink->next_us = now + sink->interval_us;
+
+    int cur_y = -1, cur_x = -1;     // Cursor nach dem letzten Zeichen
+    int32_t color = -1;
+
+    for (int w = 0; w < COMPOSITOR_MASK_WORDS; w++) {
+        uint32_t bits = sink->pending[w];
+        sink->pending[w] = 0;
+        while (bits) {
+            int i = (w << 5) + __builtin_ctz(bits);
+            bits &= bits - 1;
+            int y = i / LED_WIDTH;
+            int x = i % LED_WIDTH;
+
+            if (y != cur_y || x != cur_x) {
+                ansi_put(sink, "\x1b[%u;%uH", (unsigned)(y + 1), (unsigned)(x * 2 + 1), 0);
+            }
+            const pixel_rgb_t *c = &frame[i];
+            int32_t rgb = (c->r << 16) | (c->g << 8) | c->b;
+            if (rgb != color) {
+                ansi_put(sink, "\x1b[48;2;%u;%u;%um", sink->view[c->r], sink->view[c->g], sink->view[c->b]);
+                color = rgb;
+            }
+            ansi_put(sink, "  ", 0, 0, 0);
+            cur_y = y;
+            cur_x = x + 1;
+        }
+    }
+
+    if (color >= 0) {
+        // Farbe zurück, Cursor unter die Matrix (Konsolen-Ausgabe läuft dort weiter)
+        ansi_put(sink, "\x1b[0m\x1b[%u;1H", LED_HEIGHT + 1, 0, 0);
+        ansi_flush(sink);
+        fflush(sink->out);
+    }
+    return ESP_OK;
+}
+
+static void ansi_sink_del(frame_sink_t *base) {
+    free(__containerof(base, sink_ansi_t, base));
+}
+
+esp_err_t frame_sink_new_ansi(FILE *out, uint32_t interval_ms, frame_sink_t **ret_sink) {
+    if (out == NULL || ret_sink == NULL) return ESP_ERR_INVALID_ARG;
+
+    sink_ansi_t *sink = calloc(1, sizeof(sink_ansi_t));
+    if (sink == NULL) return ESP_ERR_NO_MEM;
+
+    sink->out = out;
+    sink->interval_us = (int64_t)interval_ms * 1000;
+    for (int v = 0; v < 256; v++) {
+        int g = v * FRAME_SINK_ANSI_GAIN;
+        sink->view[v] = (uint8_t)(g > 255 ? 255 : g);
+    }
+
+    sink->base.name = "ansi";
+    sink->base.present = ansi_sink_present;
+    sink->base.del = ansi_sink_del;
+
+    *ret_sink = &sink->base;
+    return ESP_OK;
+}
@@ -0,0 +1,56 @@
+/**
+ * @file SinkLedStrip.c
+ * @brief Frame-Senke auf einem led_strip Gerät (RMT, LUT, Multi-RMT, SPI)
+ *
+ * Welcher Treiber dahinter steckt, entscheidet setup_led_strip() (Kconfig
+ * TETRIS_LED_DRIVER); die Senke kennt nur das led_strip Interface. Es
+ * werden nur die Pixel aus der Änderungsmaske gesetzt (Matrix-Index →
+ * LED-Nummer über ledMatrix), danach ein Refresh. Der Refresh kehrt erst
+ * nach der Übertragung zurück und dominiert die Kosten.
+ */
+
+#include "FrameSink.h"
+#include "Globals.h"
+#include "esp_check.h"
+#include <stdlib.h>
+
+typedef struct {
+    frame_sink_t base;
+    led_strip_handle_t strip;
+} sink_led_strip_t;
+
+static esp_err_t led_strip_sink_present(frame_sink_t *base, const pixel_rgb_t *frame, const uint32_t *changed) {
+    sink_led_strip_t *sink = __containerof(base, sink_led_strip_t, base);
+
+    for (int w = 0; w < COMPOSITOR_MASK_WORDS; w++) {
+        uint32_t bits = changed[w];
+        while (bits) {
+            int i = (w << 5) + __builtin_ctz(bits);
+            bits &= bits - 1;
+            const pixel_rgb_t *c = &frame[i];
+            led_strip_set_pixel(sink->strip, ledMatrix.LED_Number[i / LED_WIDTH][i % LED_WIDTH],
+                                c->r, c->g, c->b);
+        }
+    }
+    return led_strip_refresh(sink->strip);
+}
+
+static void led_strip_sink_del(frame_sink_t *base) {
+    // Das Gerät gehört main.c
+    free(__containerof(base, sink_led_strip_t, base));
+}
+
+esp_err_t frame_sink_new_led_strip(led_strip_handle_t strip, const char *name, frame_sink_t **ret_sink) {
+    if (strip == NULL || ret_sink == NULL) return ESP_ERR_INVALID_ARG;
+
+    sink_led_strip_t *sink = calloc(1, sizeof(sink_led_strip_t));
+    if (sink == NULL) return ESP_ERR_NO_MEM;
+
+    sink->strip = strip;
+    sink->base.name = name;
+    sink->base.present = led_strip_sink_present;
+    sink->base.del = led_strip_sink_del;
+
+    *ret_sink = &sink->base;
+    return ESP_OK;
+}
@@ -0,0 +1,103 @@
+/**
+ * @file SinkPpm.c
+ * @brief Frame-Senke: binäre PPM-Bilder (P6) über stdio
+ *
+ * Für das Linux-Target (Spiel ohne Hardware aufzeichnen, Frames vergleichen);
+ * auf dem Gerät nur sinnvoll mit einem VFS-Dateisystem. PNG bräuchte zlib,
+ * PPM liest jedes Bildprogramm und ffmpeg direkt. Die Zeile wird einmal
+ * hochskaliert und scale-mal geschrieben.
+ */
+
+#include "FrameSink.h"
+#include "Globals.h"
+#include "esp_check.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define PPM_PATH_MAX 128
+
+typedef struct {
+    frame_sink_t base;
+    char path[PPM_PATH_MAX];
+    bool per_frame;                 // path enthält ein Format für die Frame-Nummer
+    FILE *stream;                   // Alle Frames in einer Datei
+    int scale;
+    uint32_t index;
+    uint8_t row[];                  // LED_WIDTH * scale Pixel, RGB
+} sink_ppm_t;
+
+static esp_err_t ppm_write(sink_ppm_t *sink, FILE *f, const pixel_rgb_t *frame) {
+    const int w = LED_WIDTH * sink->scale;
+    const size_t row_bytes = (size_t)w * 3;
+
+    if (fprintf(f, "P6\n%d %d\n255\n", w, LED_HEIGHT * sink->scale) < 0) return ESP_FAIL;
+
+    for (int y = 0; y < LED_HEIGHT; y++) {
+        uint8_t *p = sink->row;
+        for (int x = 0; x < LED_WIDTH; x++) {
+            const pixel_rgb_t *c = &frame[y * LED_WIDTH + x];
+            for (int s = 0; s < sink->scale; s++) {
+                *p++ = c->r;
+                *p++ = c->g;
+                *p++ = c->b;
+            }
+        }
+        for (int s = 0; s < sink->scale; s++) {
+            if (fwrite(sink->row, 1, row_bytes, f) != row_bytes) return ESP_FAIL;
+        }
+    }
+    return ESP_OK;
+}
+
+static esp_err_t ppm_sink_present(frame_sink_t *base, const pixel_rgb_t *frame, const uint32_t *changed) {
+    sink_ppm_t *sink = __containerof(base, sink_ppm_t, base);
+    (void)changed;  // Jede Datei ist ein ganzes Bild
+
+    if (!sink->per_frame) {
+        esp_err_t err = ppm_write(sink, sink->stream, frame);
+        fflush(sink->stream);
+        return err;
+    }
+
+    char name[PPM_PATH_MAX + 16];
+    snprintf(name, sizeof(name), sink->path, (unsigned)sink->index++);
+    FILE *f = fopen(name, "wb");
+    if (f == NULL) return ESP_FAIL;
+    esp_err_t err = ppm_write(sink, f, frame);
+    if (fclose(f) != 0) err = ESP_FAIL;
+    return err;
+}
+
+static void ppm_sink_del(frame_sink_t *base) {
+    sink_ppm_t *sink = __containerof(base, sink_ppm_t, base);
+    if (sink->stream) fclose(sink->stream);
+    free(sink);
+}
+
+esp_err_t frame_sink_new_ppm(const char *path, int scale, frame_sink_t **ret_sink) {
+    if (path == NULL || ret_sink == NULL || scale < 1 || strlen(path) >= PPM_PATH_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    sink_ppm_t *sink = calloc(1, sizeof(sink_ppm_t) + (size_t)LED_WIDTH * scale * 3);
+    if (sink == NULL) return ESP_ERR_NO_MEM;
+
+    strcpy(sink->path, path);
+    sink->scale = scale;
+    sink->per_frame = strchr(path, '%') != NULL;
+    if (!sink->per_frame) {
+        sink->stream = fopen(path, "wb");
+        if (sink->stream == NULL) {
+            printf("[FrameSink] Cannot open %s\n", path);
+            free(sink);
+            return ESP_FAIL;
+        }
+    }
+
+    sink->base.name = "ppm";
+    sink->base.present = ppm_sink_present;
+    sink->base.del = ppm_sink_del;
+
+    *ret_sink = &sink->base;
+    return ESP_OK;
+}
@@ -0,0 +1,119 @@
+/**
+ * @file SinkShared.c
+ * @brief Frame-Senke: letzter Frame in gemeinsamem Speicher (Sequenz-Lock)
+ *
+ * Schreiber ist nur der GameLoop (compositor_present), Leser blockieren ihn
+ * nie: seq ungerade während des Kopierens, Leser wiederholen, bis sie vor
+ * und nach der Kopie dieselbe gerade Nummer sehen. Auf dem Gerät liegt der
+ * Puffer im RAM (Leser: Konsole "frame", später z.B. ein Streaming-Task), auf dem
+ * Linux-Target optional in POSIX Shared Memory für einen Viewer-Prozess.
+ */
+
+#include "FrameSink.h"
+#include "Globals.h"
+#include "esp_check.h"
+#include <stdlib.h>
+#include <string.h>
+
+#if CONFIG_IDF_TARGET_LINUX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+typedef struct {
+    frame_sink_t base;
+    frame_shared_t *shared;
+} sink_shared_t;
+
+static esp_err_t shared_sink_present(frame_sink_t *base, const pixel_rgb_t *frame, const uint32_t *changed) {
+    sink_shared_t *sink = __containerof(base, sink_shared_t, base);
+    frame_shared_t *shared = sink->shared;
+
+    for (int w = 0; w < COMPOSITOR_MASK_WORDS; w++) {
+        uint32_t bits = changed[w];
+        if (bits == 0) continue;
+
+        if ((shared->seq & 1) == 0) {
+            shared->seq++;
+            __atomic_thread_fence(__ATOMIC_RELEASE);
+        }
+        while (bits) {
+            int i = (w << 5) + __builtin_ctz(bits);
+            bits &= bits - 1;
+            shared->px[i] = frame[i];
+        }
+    }
+
+    if (shared->seq & 1) {
+        __atomic_thread_fence(__ATOMIC_RELEASE);
+        shared->seq++;
+    }
+    return ESP_OK;
+}
+
+static void shared_sink_del(frame_sink_t *base) {
+    // Der Puffer gehört dem Aufrufer
+    free(__containerof(base, sink_shared_t, base));
+}
+
+esp_err_t frame_sink_new_shared(frame_shared_t *shared, frame_sink_t **ret_sink) {
+    if (shared == NULL || ret_sink == NULL) return ESP_ERR_INVALID_ARG;
+
+    sink_shared_t *sink = calloc(1, sizeof(sink_shared_t));
+    if (sink == NULL) return ESP_ERR_NO_MEM;
+
+    memset(shared->px, 0, sizeof(shared->px));
+    shared->width = LED_WIDTH;
+    shared->height = LED_HEIGHT;
+    shared->seq = 0;
+    sink->shared = shared;
+
+    sink->base.name = "shared";
+    sink->base.present = shared_sink_present;
+    sink->base.del = shared_sink_del;
+
+    *ret_sink = &sink->base;
+    return ESP_OK;
+}
+
+const frame_shared_t *frame_sink_shared_buffer(const frame_sink_t *sink) {
+    if (sink == NULL || sink->present != shared_sink_present) return NULL;
+    return __containerof(sink, sink_shared_t, base)->shared;
+}
+
+uint32_t frame_shared_read(const frame_shared_t *shared, pixel_rgb_t *out) {
+    uint32_t seq;
+    for (;;) {
+        seq = shared->seq;
+        if (seq & 1) continue;  // Schreiber mitten im Frame
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        memcpy(out, (const void *)shared->px, sizeof(shared->px));
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (shared->seq == seq) return seq;
+    }
+}
+
+#if CONFIG_IDF_TARGET_LINUX
+
+frame_shared_t *frame_shared_open_posix(const char *name) {
+    int fd = shm_open(name, O_CREAT | O_RDWR, 0644);
+    if (fd < 0) {
+        printf("[FrameSink] shm_open %s failed\n", name);
+        return NULL;
+    }
+    if (ftruncate(fd, sizeof(frame_shared_t)) != 0) {
+        close(fd);
+        return NULL;
+    }
+
+    void *mem = mmap(NULL, sizeof(frame_shared_t), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mem == MAP_FAILED) {
+        printf("[FrameSink] mmap %s failed\n", name);
+        return NULL;
+    }
+    return (frame_shared_t *)mem;
+}
+
+#endif
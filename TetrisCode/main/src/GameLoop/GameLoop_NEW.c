@@ -3,36 +3,51 @@
  * @brief Tetris Haupt-Spielschleife mit State Machine
  * 
  * Dieses Modul implementiert die zentrale Spiellogik als FreeRTOS Task:
- * - State Machine: WAIT → RUNNING → GAME_OVER → WAIT
+ * - State Machine (StateMachine.c, nicht-blockierend):
+ *   WAIT → PLAYING{RUNNING ⇄ CLEARING} → GAME_OVER → WAIT, RESET von überall
  * - Input-Verarbeitung (Buttons)
  * - Block-Physics (Bewegung, Rotation, Fall)
  * - Rendering (60 FPS, optimiert)
  * - Emergency Reset (4-Button-Kombination)
  */
 
+#include "GameLoop.h"
 #include "Globals.h"
 #include "Blocks.h"
 #include "Grid.h"
 #include "Controls.h"
 #include "Score.h"
 #include "SpeedManager.h"
+#include "Gravity.h"
+#include "AutoShift.h"
+#include "Chord.h"
+#include "StateMachine.h"
+#include "LatencyTrace.h"
+#include "Profiler.h"
+#include "BinLog.h"
+#include "Trace.h"
 #include "DisplayInit.h"
 #include "Splash.h"
 #include "ThemeSong.h"
-#include "led_strip.h"
+#include "Scheduler.h"
+#include "Clock.h"
+#include "FrameDeadline.h"
+#include "TaskConfig.h"
+#include "StressBench.h"
+#include "Compositor.h"
+#include "Anim.h"
+#include "AnimClips.h"
+#include "SubCell.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/semphr.h"
-#include "esp_random.h"
 
 // ============================================================================
 // EXTERNE VARIABLEN
 // ============================================================================
 
-extern MATRIX ledMatrix;           // LED-Matrix Mapping (aus main.c)
-extern led_strip_handle_t led_strip;  // WS2812B Strip Handle
 extern SemaphoreHandle_t led_strip_semaphore;
 extern SemaphoreHandle_t score_semaphore;
 
@@ -43,37 +58,170 @@ extern SemaphoreHandle_t score_semaphore;
 /** @brief Aktuell fallender Tetromino-Block */
 static TetrisBlock current_block;
 
-/** @brief Flag: Game Over erkannt (wird von handle_game_over() gesetzt) */
-static volatile int game_over_flag = 0;
+/** @brief Gravity-Akkumulator des aktuellen Blocks (Bruchteil-Reihen) */
+static gravity_state_t s_gravity;
 
-/** @brief Anzahl dynamischer Pixel vom letzten Frame (für optimiertes Rendering) */
-static int prev_dynamic_count = 0;
+/** @brief Anzahl Lock-Delay Resets für den aktuellen Block */
+static int s_lock_resets = 0;
 
-/** @brief Positionen der dynamischen Pixel [y,x] für Restore im nächsten Frame */
-static int prev_dynamic_pos[GRID_WIDTH * GRID_HEIGHT][2];
+/** @brief DAS/ARR-Zustand für LEFT/RIGHT */
+static autoshift_t s_autoshift;
+
+/** @brief Tastenkombinationen (nur exakt diese Buttons gehalten) */
+static const chord_def_t s_chord_defs[] = {
+    { CHORD_MASK(BUTTON_LEFT) | CHORD_MASK(BUTTON_RIGHT),
+      (int64_t)CHORD_SONG_HOLD_MS * 1000, CHORD_ACTION_SONG_NEXT },
+    { CHORD_MASK(BUTTON_ROTATE) | CHORD_MASK(BUTTON_FASTER),
+      (int64_t)CHORD_RESET_HOLD_MS * 1000, CHORD_ACTION_RESET },
+};
+
+/** @brief Chord-Erkennung (aus dem Event-Stream gespeist) */
+static chord_recognizer_t s_chords;
+
+/** @brief Soft Drop aktiv (FASTER gehalten) */
+static bool s_soft_drop = false;
+
+/** @brief Gravity während Soft Drop */
+#define SOFT_DROP_GRAVITY  GRAVITY_FROM_INTERVAL_MS(SOFT_DROP_INTERVAL_MS)
+
+/** @brief Zustände des GameLoops (Index in s_states) */
+typedef enum {
+    STATE_WAIT = 0,     // Splash scrollt, wartet auf frischen Button-Press
+    STATE_PLAYING,      // Eltern-Zustand: Spiel läuft (Input-Routing)
+    STATE_RUNNING,      //   Block fällt, Input, Rendering
+    STATE_CLEARING,     //   Line-Clear Animation
+    STATE_GAME_OVER,    // Game Over Animation
+    STATE_RESET,        // Emergency Reset
+    STATE_COUNT
+} game_state_t;
+
+/** @brief Zustandsautomat des GameLoops */
+static state_machine_t s_sm;
+
+/** @brief Input-Events der aktuellen Schleifen-Iteration (für die tick-Handler) */
+static input_event_t s_frame_events[INPUT_RING_SIZE];
+static int s_frame_event_count = 0;
+
+/** @brief Phase in CLEARING (Blinken, Pause nach dem Collapse) */
+static int s_anim_phase = 0;
+
+/** @brief Volle Reihen während CLEARING */
+static int s_clear_rows[GRID_HEIGHT];
+static int s_clear_count = 0;
+
+/** @brief Blink-Animationen: eine pro voller Reihe (höchstens 4, I-Block), Game Over */
+#define CLEAR_ANIM_MAX 4
+static anim_player_t s_clear_anim[CLEAR_ANIM_MAX];
+static int s_clear_anim_count = 0;
+static anim_player_t s_game_over_anim;
+
+/** @brief Ergebnis des letzten Spiels (Lauftext im Splash ohne OLED; Level 0 = noch keins) */
+static uint32_t s_last_score = 0;
+static uint32_t s_last_level = 0;
+static bool s_last_new_high = false;
+
+/** @brief WAIT: Zeitpunkt des Eintritts und ob Input schon angenommen wird */
+static int64_t s_wait_since_us = 0;
+static bool s_wait_armed = false;
+
+/** @brief Frame-Deadline Monitor: Überläufe, Slack und aktuelle Abwurf-Stufe */
+static frame_deadline_t s_deadline;
+static volatile bool s_deadline_reset_requested = false;
+
+/** @brief Render-Frames (jeder zweite Refresh entfällt bei QUALITY_ELIDE_REFRESH) */
+static uint32_t s_render_frames = 0;
+
+/** @brief OLED-Score muss aktualisiert werden (gedrosselt bei QUALITY_SLOW_HUD) */
+static bool s_hud_dirty = false;
+static volatile bool s_hud_update_requested = false;
+static int64_t s_hud_last_us = 0;
 
 // ============================================================================
 // FORWARD DECLARATIONS
 // ============================================================================
 
-static void handle_game_over(void);
 static void render_grid(void);
 static void spawn_block(void);
 static void reset_game_state(void);
-static void wait_for_restart(void);
+static void schedule_next_fall(void);
+static void update_ground_state(bool moved);
+static uint32_t current_gravity_rate(void);
 
 // ============================================================================
 // RENDERING
 // ============================================================================
 
+/**
+ * @brief Zeichnet einen Block (4x4 Shape) in eine Compositor-Ebene
+ */
+static void render_block_layer(layer_id_t layer, const TetrisBlock *block, int y_offset,
+                               const uint8_t *rgb) {
+    for (int by = 0; by < 4; by++) {
+        for (int bx = 0; bx < 4; bx++) {
+            if (!block->shape[by][bx]) continue;
+            // Teile außerhalb des Felds verwirft der Compositor
+            int gy = block->y + by + y_offset;
+            int gx = block->x + bx;
+            if (rgb != NULL) {
+                compositor_set(layer, gy, gx, rgb[0], rgb[1], rgb[2]);
+            } else {
+                compositor_set_block(layer, gy, gx, block->color);
+            }
+        }
+    }
+}
+
+#if CONFIG_TETRIS_SUBCELL_RENDER
+/**
+ * @brief Wie weit der aktive Block schon in Richtung nächster Reihe ist (Q16)
+ *
+ * 0 wenn er aufliegt (Lock Delay) oder Frames überlaufen: die Glättung ist
+ * das Erste, was wegfällt (zusammen mit dem Line-Clear Blinken).
+ */
+static uint16_t subcell_fraction(void) {
+    if (frame_deadline_sheds(&s_deadline, QUALITY_SKIP_BLINK)) return 0;
+    if (grid_drop_distance(&current_block, 1) < 1) return 0;
+    return gravity_fraction_q16(&s_gravity, clock_now_us());
+}
+#endif
+
+/**
+ * @brief Schreibt die geänderten Pixel in den Ausgabe-Frame (ohne Übertragung)
+ *
+ * Aktiver Block (und Ghost) werden in ihren Ebenen neu gezeichnet; der
+ * Compositor schreibt nur Pixel, die sich gegenüber dem letzten Frame ändern.
+ */
+static void render_write_pixels(void) {
+    PROFILE_SCOPE(PROFILE_STAGE_RENDER);
+    TRACE_SCOPE(TRACE_RENDER);
+
+#if GHOST_PIECE_ENABLED
+    // Landeposition: Blockfarbe mit GHOST_BRIGHTNESS_DIV abgedunkelt
+    const pixel_rgb_t *c = compositor_block_color(current_block.color);
+    const uint8_t ghost_rgb[3] = {
+        c->r / GHOST_BRIGHTNESS_DIV, c->g / GHOST_BRIGHTNESS_DIV, c->b / GHOST_BRIGHTNESS_DIV,
+    };
+    compositor_clear_layer(LAYER_GHOST);
+    render_block_layer(LAYER_GHOST, &current_block,
+                       grid_drop_distance(&current_block, GRID_HEIGHT), ghost_rgb);
+#endif
+
+    compositor_clear_layer(LAYER_ACTIVE);
+#if CONFIG_TETRIS_SUBCELL_RENDER
+    subcell_render(LAYER_ACTIVE, &current_block, subcell_fraction());
+#else
+    render_block_layer(LAYER_ACTIVE, &current_block, 0, NULL);
+#endif
+    compositor_commit_frame();  // Fester Render-Takt → Dithering
+}
+
 /**
  * @brief Rendert das Spielfeld auf die LED-Matrix (optimiert)
  * 
  * Optimierungstechnik:
- * 1. Vorherige dynamische Pixel (aktueller Block) werden restauriert
- * 2. Nur statische Farben aus grid[][] werden geschrieben
- * 3. Neuer Block wird an aktueller Position gezeichnet
- * 4. Nur geänderte Pixel werden aktualisiert (kein led_strip_clear!)
+ * 1. Aktiver Block wird in seiner Compositor-Ebene neu gezeichnet
+ * 2. Der Compositor setzt nur Pixel mit gesetztem Dirty-Bit neu zusammen
+ * 3. Nur geänderte Pixel werden in den Ausgabe-Frame geschrieben (kein led_strip_clear!)
  * 
  * SEMAPHOR-SCHUTZ: LED-Strip mit Binary Semaphore vor Race Conditions geschützt
  * Resultat: Flimmerfreies Rendering bei 60 FPS
@@ -84,65 +232,80 @@ static void render_grid(void) {
     // SEMAPHOR-SCHUTZ: LED-Strip Zugriff schützen (50ms Timeout)
     if (xSemaphoreTake(led_strip_semaphore, pdMS_TO_TICKS(50)) != pdTRUE) {
         // Timeout: Render überspring dies Frame, um Deadlock zu vermeiden
-        printf("[Render] Semaphore timeout, skipping frame\n");
+        BLOG(LOG_RENDER_SEM_TIMEOUT);
         return;
     }
     
-    // Schritt 1: Restauriere vorherige dynamische Pixel zurück auf statische Farben
-    for (int i = 0; i < prev_dynamic_count; i++) {
-        int ry = prev_dynamic_pos[i][0];
-        int rx = prev_dynamic_pos[i][1];
-        int led_num = ledMatrix.LED_Number[ry][rx];
-        
-        if (grid[ry][rx] > 0) {
-            // Statischer Block an dieser Position → Farbe setzen
-            uint8_t r, g, b;
-            get_block_rgb(grid[ry][rx] - 1, &r, &g, &b);
-            r = (r * GAME_BRIGHTNESS_SCALE) / 255;
-            g = (g * GAME_BRIGHTNESS_SCALE) / 255;
-            b = (b * GAME_BRIGHTNESS_SCALE) / 255;
-            led_strip_set_pixel(led_strip, led_num, r, g, b);
-        } else {
-            // Leer → Pixel ausschalten
-            led_strip_set_pixel(led_strip, led_num, 0, 0, 0);
-        }
-    }
-    prev_dynamic_count = 0;
+    render_write_pixels();
 
-    // Schritt 2: Zeichne aktuellen Block (dynamisch)
-    for (int by = 0; by < 4; by++) {
-        for (int bx = 0; bx < 4; bx++) {
-            if (current_block.shape[by][bx]) {
-                int gx = current_block.x + bx;
-                int gy = current_block.y + by;
-                
-                // Bounds-Check (Block kann teilweise außerhalb sein)
-                if (gx >= 0 && gx < GRID_WIDTH && gy >= 0 && gy < GRID_HEIGHT) {
-                    // Block-Farbe mit Helligkeit skalieren
-                    uint8_t r, g, b;
-                    get_block_rgb(current_block.color, &r, &g, &b);
-                    r = (r * GAME_BRIGHTNESS_SCALE) / 255;
-                    g = (g * GAME_BRIGHTNESS_SCALE) / 255;
-                    b = (b * GAME_BRIGHTNESS_SCALE) / 255;
-                    
-                    int led_num = ledMatrix.LED_Number[gy][gx];
-                    led_strip_set_pixel(led_strip, led_num, r, g, b);
-                    
-                    // Position merken für nächsten Frame
-                    if (prev_dynamic_count < (GRID_WIDTH * GRID_HEIGHT)) {
-                        prev_dynamic_pos[prev_dynamic_count][0] = gy;
-                        prev_dynamic_pos[prev_dynamic_count][1] = gx;
-                        prev_dynamic_count++;
-                    }
-                }
-            }
-        }
+    // Frame-Überlauf: jeden zweiten Refresh auslassen, die Pixel gehen mit dem nächsten raus
+    s_render_frames++;
+    if (frame_deadline_sheds(&s_deadline, QUALITY_ELIDE_REFRESH) && (s_render_frames & 1)) {
+        xSemaphoreGive(led_strip_semaphore);
+        return;  // Latenz-Marken bleiben offen bis zum nächsten echten Refresh
     }
 
-    // Schritt 3: LED-Matrix aktualisieren (RMT sendet Daten an WS2812B)
-    led_strip_refresh(led_strip);
+    // Schritt 3: Frame an die Senken (Strip: geänderte Pixel setzen, RMT/SPI sendet an WS2812B)
+    // compositor_present() kehrt erst nach abgeschlossener Übertragung zurück
+    {
+        PROFILE_SCOPE(PROFILE_STAGE_REFRESH);
+        TRACE_SCOPE(TRACE_REFRESH);
+        compositor_present();
+    }
+    clock_advance_us(LED_STRIP_FRAME_US);  // Nur VIRTUAL: Übertragungsdauer nachbilden
     
     xSemaphoreGive(led_strip_semaphore);  // Gib Semaphor frei
+
+    // Alle Inputs, die diesen Frame verändert haben, sind jetzt sichtbar
+    latency_trace_latched(clock_now_us());
+}
+
+// ============================================================================
+// FRAME DEADLINE (Abwerfen optionaler Arbeit bei Überlauf)
+// ============================================================================
+
+/**
+ * @brief OLED-Score aktualisieren, falls nötig
+ *
+ * Normal sofort; bei QUALITY_SLOW_HUD höchstens alle FRAME_SHED_HUD_INTERVAL_MS
+ * (der letzte Stand wird nachgeholt, sobald das Intervall abgelaufen ist).
+ */
+static void hud_service(int64_t now) {
+    if (s_hud_update_requested) {
+        s_hud_update_requested = false;
+        s_hud_dirty = true;
+    }
+    if (!s_hud_dirty) return;
+    if (frame_deadline_sheds(&s_deadline, QUALITY_SLOW_HUD) &&
+        now - s_hud_last_us < (int64_t)FRAME_SHED_HUD_INTERVAL_MS * 1000) {
+        return;
+    }
+    {
+        PROFILE_SCOPE(PROFILE_STAGE_HUD);
+        display_update_score(score_get(), score_get_highscore());
+    }
+    s_hud_dirty = false;
+    s_hud_last_us = now;
+}
+
+/**
+ * @brief Ende einer Iteration: Slack messen, Stufe anpassen, Entscheidung loggen
+ */
+static void frame_deadline_check(void) {
+    if (s_deadline_reset_requested) {
+        s_deadline_reset_requested = false;
+        frame_deadline_reset_stats(&s_deadline);
+    }
+
+    int change = frame_deadline_end(&s_deadline, scheduler_frame_start_us(), clock_now_us());
+    if (change > 0) {
+        BLOG(LOG_FRAME_SHED, s_deadline.last_slack_us, s_deadline.level, s_deadline.overruns);
+    } else if (change < 0) {
+        BLOG(LOG_FRAME_RESTORE, s_deadline.last_slack_us, s_deadline.level);
+    }
+    if (change != 0) {
+        TRACE_INSTANT(TRACE_QUALITY, s_deadline.level);
+    }
 }
 
 // ============================================================================
@@ -162,8 +325,11 @@ static void render_grid(void) {
  * und bei Bedarf auch y = -1 (teilweise oberhalb sichtbar)
  */
 static void spawn_block(void) {
-    // Zufälligen Block-Typ wählen (0-6: I, J, L, O, S, T, Z)
-    int block_type = esp_random() % 7;
+    PROFILE_SCOPE(PROFILE_STAGE_SPAWN);
+    TRACE_SCOPE(TRACE_SPAWN);
+
+    // Zufälligen Block-Typ wählen (0-6: I, J, L, O, S, T, Z), VIRTUAL: reproduzierbar per Seed
+    int block_type = clock_random() % 7;
     TetrisBlock candidate = blocks[block_type][0];
 
     // Versuche Spawn-Position zu finden (bevorzugt Mitte)
@@ -231,7 +397,7 @@ static void spawn_block(void) {
 
     // Kein Platz gefunden → Game Over
     if (!found) {
-        handle_game_over();
+        sm_request(&s_sm, STATE_GAME_OVER);
         return;
     }
 
@@ -240,45 +406,118 @@ static void spawn_block(void) {
     current_block.x = best_x;
     current_block.y = (candidate.y < 0) ? -1 : 0;
     assign_block_color(&current_block, block_type);
+
+    // Gravity für den neuen Block mit der Geschwindigkeit des aktuellen Levels starten
+    gravity_reset(&s_gravity, current_gravity_rate(), clock_now_us());
+    s_lock_resets = 0;
+    scheduler_cancel(SCHED_EVT_LOCK);
+    schedule_next_fall();
 }
 
+// ============================================================================
+// GRAVITY & LOCK DELAY
+// ============================================================================
+
 /**
- * @brief Game Over Handler
- * 
- * Wird aufgerufen wenn kein Platz für neuen Block:
- * 1. Highscore aktualisieren und in NVS speichern
- * 2. Game Over auf Display anzeigen
- * 3. Blink-Animation (3× rot, je 300ms on/off)
- * 4. game_over_flag setzen → Hauptschleife startet Neustart-Sequenz
+ * @brief Gravity des aktuellen Levels, bei Soft Drop mindestens SOFT_DROP_GRAVITY
  */
-static void handle_game_over(void) {
-    // Highscore aktualisieren (falls neuer Rekord)
-    score_update_highscore();
-    
-    // Game Over Screen auf OLED anzeigen
-    display_show_game_over(score_get(), score_get_highscore());
-    
-    // Blink-Animation: LED-Matrix rot blinken lassen
-    for (int blink = 0; blink < GAME_OVER_BLINK_COUNT; blink++) {
-        // An: Alle LEDs rot
-        for (int y = 0; y < GRID_HEIGHT; y++) {
-            for (int x = 0; x < GRID_WIDTH; x++) {
-                int led = ledMatrix.LED_Number[y][x];
-                led_strip_set_pixel(led_strip, led, 
-                    GAME_OVER_BLINK_R, GAME_OVER_BLINK_G, GAME_OVER_BLINK_B);
-            }
+static uint32_t current_gravity_rate(void) {
+    uint32_t rate = speed_manager_get_gravity();
+    if (s_soft_drop && rate < SOFT_DROP_GRAVITY) {
+        rate = SOFT_DROP_GRAVITY;
+    }
+    return rate;
+}
+
+/**
+ * @brief Soft Drop ein-/ausschalten (FASTER Press/Release)
+ *
+ * Bei Press fällt der Block sofort eine Reihe, danach mit SOFT_DROP_GRAVITY.
+ * Außerhalb von RUNNING (z.B. CLEARING) wird nur der Zustand gemerkt,
+ * der nächste Spawn übernimmt ihn.
+ *
+ * @return true wenn der Block durch den Press sofort eine Reihe gefallen ist
+ */
+static bool set_soft_drop(bool on) {
+    int64_t now = clock_now_us();
+    bool moved = false;
+    s_soft_drop = on;
+    if (!sm_in_state(&s_sm, STATE_RUNNING)) return false;
+
+    gravity_set_rate(&s_gravity, current_gravity_rate(), now);
+
+    if (on) {
+        TetrisBlock tmp = current_block;
+        tmp.y++;
+        if (!grid_check_collision(&tmp)) {
+            current_block = tmp;
+            gravity_clear_fraction(&s_gravity, now);
+            moved = true;
         }
-        led_strip_refresh(led_strip);
-        vTaskDelay(pdMS_TO_TICKS(GAME_OVER_BLINK_ON_MS));
+    }
 
-        // Aus: Alle LEDs schwarz
-        led_strip_clear(led_strip);
-        led_strip_refresh(led_strip);
-        vTaskDelay(pdMS_TO_TICKS(GAME_OVER_BLINK_OFF_MS));
+    if (scheduler_is_armed(SCHED_EVT_FALL)) {
+        schedule_next_fall();
+    }
+    update_ground_state(false);
+    return moved;
+}
+
+/**
+ * @brief Verschiebt den Block um bis zu steps Zellen (stoppt an Kollision)
+ *
+ * @return Anzahl tatsächlich verschobener Zellen
+ */
+static int shift_block(int dir, int steps) {
+    int moved = 0;
+    for (int i = 0; i < steps; i++) {
+        TetrisBlock tmp = current_block;
+        tmp.x += dir;
+        if (grid_check_collision(&tmp)) break;
+        current_block = tmp;
+        moved++;
+    }
+    if (moved > 0) {
+        update_ground_state(true);
     }
+    return moved;
+}
+
+/**
+ * @brief Plant das nächste Fall-Event auf den Zeitpunkt der nächsten ganzen Reihe
+ */
+static void schedule_next_fall(void) {
+    scheduler_arm_at(SCHED_EVT_FALL, gravity_next_row_us(&s_gravity, clock_now_us()));
+}
 
-    // Flag setzen → Hauptschleife reagiert darauf
-    game_over_flag = 1;
+/**
+ * @brief Aktualisiert Fall-/Lock-Zustand nachdem sich current_block verändert hat
+ *
+ * - Block liegt auf: Gravity pausieren, Lock Delay starten. Bewegung/Rotation
+ *   setzt das Lock Delay zurück (max. LOCK_DELAY_MAX_RESETS mal).
+ * - Block frei: Lock Delay abbrechen, Gravity (wieder) einplanen.
+ *
+ * @param moved true wenn der Spieler den Block bewegt/rotiert hat
+ */
+static void update_ground_state(bool moved) {
+    int64_t lock_delay_us = (int64_t)speed_manager_get_lock_delay_ms() * 1000;
+
+    if (grid_drop_distance(&current_block, 1) == 0) {
+        scheduler_cancel(SCHED_EVT_FALL);
+        if (!scheduler_is_armed(SCHED_EVT_LOCK)) {
+            scheduler_arm_in(SCHED_EVT_LOCK, lock_delay_us);
+        } else if (moved && s_lock_resets < LOCK_DELAY_MAX_RESETS) {
+            s_lock_resets++;
+            scheduler_arm_in(SCHED_EVT_LOCK, lock_delay_us);
+        }
+    } else {
+        scheduler_cancel(SCHED_EVT_LOCK);
+        if (!scheduler_is_armed(SCHED_EVT_FALL)) {
+            // Von einer Kante gerutscht: Fall mit frischem Bruchteil fortsetzen
+            gravity_clear_fraction(&s_gravity, clock_now_us());
+            schedule_next_fall();
+        }
+    }
 }
 
 // ============================================================================
@@ -294,344 +533,521 @@ static void handle_game_over(void) {
  * - Normaler Spielstart nach Splash
  */
 static void reset_game_state(void) {
+    autoshift_reset(&s_autoshift);
+    chord_reset(&s_chords);
+    s_soft_drop = false;
     grid_init();
     score_init();
     speed_manager_reset();
-    display_reset_and_show_hud(score_get_highscore());
+    {
+        PROFILE_SCOPE(PROFILE_STAGE_HUD);
+        display_reset_and_show_hud(score_get_highscore());
+    }
+    s_hud_dirty = false;
 }
 
+// ============================================================================
+// STATE: WAIT (Splash, wartet auf frischen Button-Press)
+// ============================================================================
+
 /**
- * @brief Wartet auf Neustart nach Reset oder Game Over
- * 
- * FIX: Wartet EXPLICIT auf neuen Button-Press, nicht nur auf Release!
- * Dies verhindert, dass das Spiel automatisch startet wenn Buttons noch gedrückt sind.
- * 
- * Sequenz:
- * 1. Queue drainieren (alte Events entfernen)
- * 2. Splash 2 Sekunden anzeigen (Inputs ignoriert)
- * 3. Kontinuierliches Queue-Drain während 500ms
- * 4. Warten bis ALLE Buttons released
- * 5. Warten auf NEUEN Button-Press (EXPLIZIT!)
- * 6. Warten auf Button-Release
+ * @brief WAIT betreten: Splash starten, Musik an, HUD mit Highscore
+ *
+ * Ersetzt wait_for_restart(): statt 2s Splash + 500ms Drain + Release-Wait
+ * läuft der Splash über ANIMATION-Deadlines, Input wird ab
+ * WAIT_INPUT_GUARD_MS und losgelassenen Buttons angenommen.
  */
-static void wait_for_restart(void) {
-    gpio_num_t ev;
+static void wait_enter(void) {
+    theme_resume();
+    {
+        PROFILE_SCOPE(PROFILE_STAGE_HUD);
+        display_reset_and_show_hud(score_get_highscore());
+    }
+    controls_flush();
+
+    s_wait_since_us = clock_now_us();
+    s_wait_armed = false;
+
+    splash_begin();
+    if (!display_available() || SPLASH_SCORES_WITH_OLED) {
+        // Kein OLED: Ergebnis und Highscore laufen über die Matrix
+        splash_show_scores(s_last_score, s_last_level, score_get_highscore(), s_last_new_high);
+    }
+    scheduler_arm_in(SCHED_EVT_ANIMATION, 0);
+}
+
+static void wait_exit(void) {
+    scheduler_cancel(SCHED_EVT_ANIMATION);
+    splash_clear();
+}
+
+static void wait_tick(uint32_t events) {
+    if (events & SCHED_EVT_BIT(SCHED_EVT_ANIMATION)) {
+        splash_tick();
+        scheduler_arm_at(SCHED_EVT_ANIMATION, splash_next_us());
+    }
+
+    // Erst nach der Guard-Zeit UND wenn alle Buttons losgelassen sind scharf schalten
+    // (verhindert Auto-Start durch noch gehaltene Buttons aus dem letzten Spiel)
+    if (!s_wait_armed) {
+        s_wait_armed = (clock_now_us() - s_wait_since_us >= (int64_t)WAIT_INPUT_GUARD_MS * 1000) &&
+                       !controls_any_button_held();
+        return;
+    }
+
+    for (int i = 0; i < s_frame_event_count; i++) {
+        if (s_frame_events[i].edge == INPUT_EDGE_PRESS) {
+            BLOG(LOG_GAME_START, s_frame_events[i].button);
+            sm_request(&s_sm, STATE_RUNNING);
+            return;
+        }
+    }
+}
+
+// ============================================================================
+// STATE: PLAYING (Eltern-Zustand von RUNNING und CLEARING)
+// ============================================================================
+
+/**
+ * @brief Spiel starten: Zustand zurücksetzen, ersten Block spawnen
+ */
+static void playing_enter(void) {
+    reset_game_state();
+    theme_resume();  // Musik bleibt laufen im Spiel
+    spawn_block();
+}
+
+/**
+ * @brief Spiel verlassen: alle Spiel-Deadlines abbrechen
+ */
+static void playing_exit(void) {
+    scheduler_cancel(SCHED_EVT_FALL);
+    scheduler_cancel(SCHED_EVT_LOCK);
+    scheduler_cancel(SCHED_EVT_AUTOREPEAT);
+    scheduler_cancel(SCHED_EVT_RENDER);
+    s_soft_drop = false;
+}
+
+/**
+ * @brief Input-Routing für RUNNING und CLEARING
+ *
+ * LEFT/RIGHT gehen mit Flanken-Zeitstempel an DAS/ARR, FASTER schaltet Soft Drop.
+ * Läuft auch während CLEARING, damit gehaltene Buttons nicht verloren gehen.
+ */
+static void playing_tick(uint32_t events) {
+    for (int i = 0; i < s_frame_event_count; i++) {
+        const input_event_t *ev = &s_frame_events[i];
+        bool pressed = (ev->edge == INPUT_EDGE_PRESS);
+        if (ev->button == BUTTON_LEFT || ev->button == BUTTON_RIGHT) {
+            int dir = (ev->button == BUTTON_LEFT) ? AUTOSHIFT_LEFT : AUTOSHIFT_RIGHT;
+            if (pressed) autoshift_press(&s_autoshift, dir, ev->timestamp_us);
+            else autoshift_release(&s_autoshift, dir, ev->timestamp_us);
+        } else if (ev->button == BUTTON_FASTER) {
+            if (set_soft_drop(pressed)) {
+                latency_trace_mark(ev, clock_now_us());
+            }
+        }
+    }
+}
+
+// ============================================================================
+// STATE: RUNNING (Block fällt, Input, Rendering)
+// ============================================================================
+
+static void running_enter(void) {
+    // Während CLEARING fällige DAS/ARR-Schritte verwerfen (DAS bleibt geladen)
+    autoshift_take(&s_autoshift, clock_now_us(), GRID_WIDTH);
+    scheduler_arm_in(SCHED_EVT_RENDER, 0);  // Sofort ein Frame
+}
+
+static void running_exit(void) {
+    scheduler_cancel(SCHED_EVT_AUTOREPEAT);
+    scheduler_cancel(SCHED_EVT_RENDER);
+    latency_trace_discard_pending();  // Frame wird nicht mehr gerendert
+}
+
+/**
+ * @brief Fixiert den aufliegenden Block: Line-Clear oder nächster Block
+ */
+static void lock_current_block(void) {
+    stress_bench_prepare_lock();  // Nur im Benchmark: Line-Clear erzwingen
+    // Block wechselt von der aktiven in die fixierte Ebene
+    compositor_clear_layer(LAYER_ACTIVE);
+    compositor_clear_layer(LAYER_GHOST);
+    grid_fix_block(&current_block);
+    s_clear_count = grid_find_full_rows(s_clear_rows);
+    if (s_clear_count > 0) {
+        sm_request(&s_sm, STATE_CLEARING);
+    } else {
+        spawn_block();
+    }
+}
+
+static void running_tick(uint32_t events) {
+    TetrisBlock tmp;
+    
+    // Links-/Rechts-Bewegung (DAS/ARR: alle bis jetzt fälligen Schritte)
+    // Während LEFT + RIGHT als Kombination gehalten werden, nicht verschieben
+    int shift_steps = autoshift_take(&s_autoshift, clock_now_us(), GRID_WIDTH);
+    if (shift_steps > 0 && !chord_pending(&s_chords)) {
+        int dir = autoshift_direction(&s_autoshift);
+        if (shift_block(dir, shift_steps) > 0) {
+            // Latenz nur für den Press messen, der den ersten Schritt ausgelöst hat
+            button_id_t shift_button = (dir == AUTOSHIFT_LEFT) ? BUTTON_LEFT : BUTTON_RIGHT;
+            for (int i = 0; i < s_frame_event_count; i++) {
+                if (s_frame_events[i].button == shift_button && s_frame_events[i].edge == INPUT_EDGE_PRESS) {
+                    latency_trace_mark(&s_frame_events[i], clock_now_us());
+                }
+            }
+        }
+    }
     
-    // 1. Queue drainieren
-    while (controls_get_event(&ev)) {}
+    // Rotation (O-Block rotiert nicht)
+    for (int i = 0; i < s_frame_event_count; i++) {
+        if (s_frame_events[i].button != BUTTON_ROTATE || s_frame_events[i].edge != INPUT_EDGE_PRESS) continue;
+        if (current_block.color == 3) break;
+        tmp = current_block;
+        rotate_block_90(&tmp);
+        if (!grid_check_collision(&tmp)) {
+            current_block = tmp;
+            update_ground_state(true);
+            latency_trace_mark(&s_frame_events[i], clock_now_us());
+        }
+    }
     
-    // 2. Splash 2s anzeigen (Inputs ignoriert)
-    splash_show_duration(2000);
+    // ====================================================================
+    // AUTOMATIC FALL (Gravity-Akkumulator, mehrere Reihen pro Event möglich)
+    // ====================================================================
     
-    // 3. Queue drainieren + 500ms kontinuierlich
-    printf("[GameLoop] Draining queue after 2s splash...\n");
-    int drained = 0;
-    while (controls_get_event(&ev)) {
-        drained++;
+    if (events & SCHED_EVT_BIT(SCHED_EVT_FALL)) {
+        // Alle fälligen Reihen in EINER Swept-Collision Abfrage auflösen
+        int rows = gravity_take_rows(&s_gravity, clock_now_us(), GRID_HEIGHT);
+        current_block.y += grid_drop_distance(&current_block, rows);
+        
+        if (grid_drop_distance(&current_block, 1) == 0) {
+            // Aufgelegt → Lock Delay starten
+            update_ground_state(false);
+        } else {
+            schedule_next_fall();
+        }
     }
-    printf("[GameLoop] Drained %d events from queue\n", drained);
     
-    printf("[GameLoop] Waiting 500ms while continuously draining queue...\n");
-    uint32_t drain_start = xTaskGetTickCount() * portTICK_PERIOD_MS;
-    while ((xTaskGetTickCount() * portTICK_PERIOD_MS - drain_start) < 500) {
-        while (controls_get_event(&ev)) {
-            printf("[GameLoop] Caught straggler event during drain: GPIO %d\n", ev);
+    // ====================================================================
+    // LOCK DELAY abgelaufen → Block fixieren (Line-Clear oder neuer Block)
+    // ====================================================================
+    
+    if (events & SCHED_EVT_BIT(SCHED_EVT_LOCK)) {
+        if (grid_drop_distance(&current_block, 1) == 0) {
+            lock_current_block();
+            if (s_sm.pending != SM_NO_STATE) return;  // CLEARING oder GAME_OVER
+        } else {
+            update_ground_state(false);
         }
-        vTaskDelay(pdMS_TO_TICKS(10));
     }
     
-    // 4. Warten bis ALLE Buttons released sind
-    printf("[GameLoop] Waiting for ALL buttons to be released...\n");
-    vTaskDelay(pdMS_TO_TICKS(100));
-    int release_count = 0;
-    while (check_button_pressed(BTN_LEFT) || check_button_pressed(BTN_RIGHT) ||
-           check_button_pressed(BTN_ROTATE) || check_button_pressed(BTN_FASTER)) {
-        release_count++;
-        vTaskDelay(pdMS_TO_TICKS(20));
-        if (release_count > 100) {  // Timeout nach 2 Sekunden
-            printf("[GameLoop] WARNING: Button release timeout, continuing...\n");
-            break;
+    // ====================================================================
+    // RENDERING (60 FPS)
+    // ====================================================================
+    
+    if (events & SCHED_EVT_BIT(SCHED_EVT_RENDER)) {
+        render_grid();
+        scheduler_arm_periodic(SCHED_EVT_RENDER, (int64_t)RENDER_INTERVAL_MS * 1000);
+    }
+    
+    // ====================================================================
+    // AUTO-REPEAT (nächster DAS/ARR-Schritt als exakte Deadline)
+    // ====================================================================
+    // Press/Release wecken den Task über den Abtaster; gehaltenes LEFT/RIGHT
+    // braucht nur die Deadline des nächsten fälligen Schritts.
+    
+    int64_t next_shift_us = autoshift_next_us(&s_autoshift);
+    if (next_shift_us != INT64_MAX) {
+        scheduler_arm_at(SCHED_EVT_AUTOREPEAT, next_shift_us);
+    } else {
+        scheduler_cancel(SCHED_EVT_AUTOREPEAT);
+    }
+}
+
+// ============================================================================
+// ANIMATIONEN (AnimClips.c)
+// ============================================================================
+
+/**
+ * @brief Animationen auf jetzt vorspulen, Änderungen übertragen und die
+ * ANIMATION-Deadline auf die nächste sichtbare Änderung setzen
+ *
+ * @return true solange eine der Animationen läuft
+ */
+static bool anim_service(anim_player_t *players, int count) {
+    int64_t now_us = clock_now_us();
+
+    if (xSemaphoreTake(led_strip_semaphore, pdMS_TO_TICKS(50)) == pdTRUE) {
+        bool changed = false;
+        for (int i = 0; i < count; i++) {
+            changed |= anim_advance(&players[i], now_us);
+        }
+        if (changed) {
+            compositor_commit();
+            compositor_present();
         }
+        xSemaphoreGive(led_strip_semaphore);
     }
-    printf("[GameLoop] All buttons released\n");
+
+    // Bei Semaphor-Timeout liegt die Deadline in der Vergangenheit → sofort neuer Versuch
+    int64_t next_us = INT64_MAX;
+    for (int i = 0; i < count; i++) {
+        int64_t t = anim_next_us(&players[i]);
+        if (t < next_us) next_us = t;
+    }
+    if (next_us == INT64_MAX) return false;
+
+    scheduler_arm_at(SCHED_EVT_ANIMATION, next_us);
+    return true;
+}
+
+// ============================================================================
+// STATE: CLEARING (Line-Clear Animation über ANIMATION-Deadlines)
+// ============================================================================
+
+/**
+ * @brief Phasen: Blink-Clip pro voller Reihe, dann Collapse + kurze Pause,
+ * dann nächster Block
+ */
+static void clearing_enter(void) {
+    TRACE_BEGIN(TRACE_LINE_CLEAR);
+    int64_t now_us = clock_now_us();
+
+    s_clear_anim_count = s_clear_count < CLEAR_ANIM_MAX ? s_clear_count : CLEAR_ANIM_MAX;
+    for (int i = 0; i < s_clear_anim_count; i++) {
+        anim_start(&s_clear_anim[i], &anim_clip_line_clear, LAYER_OVERLAY, s_clear_rows[i], 0, now_us);
+    }
+    s_anim_phase = 0;
+    scheduler_arm_in(SCHED_EVT_ANIMATION, 0);
+}
+
+static void clearing_exit(void) {
+    scheduler_cancel(SCHED_EVT_ANIMATION);
+    for (int i = 0; i < s_clear_anim_count; i++) {
+        anim_stop(&s_clear_anim[i]);
+    }
+    TRACE_END(TRACE_LINE_CLEAR);
+}
+
+static void clearing_tick(uint32_t events) {
+    if (!(events & SCHED_EVT_BIT(SCHED_EVT_ANIMATION))) return;
+
+    if (s_anim_phase == 0) {
+        // Frame-Überlauf: Blinken überspringen, direkt zusammenfallen lassen
+        if (frame_deadline_sheds(&s_deadline, QUALITY_SKIP_BLINK)) {
+            for (int i = 0; i < s_clear_anim_count; i++) {
+                anim_stop(&s_clear_anim[i]);
+            }
+        }
+        if (anim_service(s_clear_anim, s_clear_anim_count)) return;
+
+        grid_collapse_rows(s_clear_rows, s_clear_count);
+        s_hud_dirty = true;      // Score geändert → OLED (hud_service)
+        scheduler_arm_in(SCHED_EVT_ANIMATION, (int64_t)LINE_CLEAR_SETTLE_MS * 1000);
+        s_anim_phase = 1;
+        return;
+    }
+
+    sm_request(&s_sm, STATE_RUNNING);
+    spawn_block();  // Fordert ggf. GAME_OVER an (überschreibt RUNNING)
+}
+
+// ============================================================================
+// STATE: GAME_OVER (Blink-Animation über ANIMATION-Deadlines)
+// ============================================================================
+
+/**
+ * @brief Game Over betreten
+ * 
+ * 1. Highscore aktualisieren und in NVS speichern
+ * 2. Game Over auf Display anzeigen
+ * 3. Blink-Animation starten (anim_clip_game_over: GAME_OVER_BLINK_COUNT× rot)
+ */
+static void game_over_enter(void) {
+    s_last_score = (uint32_t)score_get();
+    s_last_level = speed_manager_get_level();
+    s_last_new_high = s_last_score > score_get_highscore();
+
+    // Highscore aktualisieren (falls neuer Rekord)
+    score_update_highscore();
+    
+    // Game Over Screen auf OLED anzeigen
+    {
+        PROFILE_SCOPE(PROFILE_STAGE_HUD);
+        display_show_game_over(score_get(), score_get_highscore());
+    }
+    
+    controls_stats_t input_stats;
+    controls_get_stats(&input_stats);
+    printf("[GameLoop] Input ring: %lu events, %lu dropped, high water %lu/%d\n",
+           (unsigned long)input_stats.pushed, (unsigned long)input_stats.overflows,
+           (unsigned long)input_stats.high_water, INPUT_RING_SIZE);
+    latency_trace_print();
+    
+    anim_start(&s_game_over_anim, &anim_clip_game_over, LAYER_OVERLAY, 0, 0, clock_now_us());
+    scheduler_arm_in(SCHED_EVT_ANIMATION, 0);
+}
+
+static void game_over_exit(void) {
+    scheduler_cancel(SCHED_EVT_ANIMATION);
+}
+
+static void game_over_tick(uint32_t events) {
+    if (!(events & SCHED_EVT_BIT(SCHED_EVT_ANIMATION))) return;
+
+    // Clip endet schwarz (hold_last), WAIT zeichnet darüber den Splash
+    if (!anim_service(&s_game_over_anim, 1)) {
+        sm_request(&s_sm, STATE_WAIT);
+    }
+}
+
+// ============================================================================
+// STATE: RESET (Emergency Reset, sofort zurück nach WAIT)
+// ============================================================================
+
+static void reset_enter(void) {
+    printf("[GameLoop] Emergency reset\n");
     
-    // 5. EXPLIZIT auf NEUEN Button-Press warten (FIX für Auto-Start Problem)
-    printf("[GameLoop] Waiting for NEW button press to start game...\n");
-    while (!controls_get_event(&ev)) {
-        vTaskDelay(pdMS_TO_TICKS(50));
+    // Hard Reset durchführen
+    reset_game_state();
+    if (xSemaphoreTake(led_strip_semaphore, pdMS_TO_TICKS(50)) == pdTRUE) {
+        compositor_reset();
+        compositor_commit();
+        compositor_present();
+        xSemaphoreGive(led_strip_semaphore);
     }
-    printf("[GameLoop] Button pressed (GPIO %d), starting game!\n", ev);
     
-    // 6. Queue drainieren + kurz warten
-    vTaskDelay(pdMS_TO_TICKS(50));
-    while (controls_get_event(&ev)) {}
+    // Zurück zum WAIT STATE (Splash-Menü)
+    sm_request(&s_sm, STATE_WAIT);
 }
 
+// ============================================================================
+// STATE TABLE
+// ============================================================================
+
+static const sm_state_t s_states[STATE_COUNT] = {
+    [STATE_WAIT]      = { "WAIT",      SM_NO_PARENT,  wait_enter,      wait_exit,      wait_tick },
+    [STATE_PLAYING]   = { "PLAYING",   SM_NO_PARENT,  playing_enter,   playing_exit,   playing_tick },
+    [STATE_RUNNING]   = { "RUNNING",   STATE_PLAYING, running_enter,   running_exit,   running_tick },
+    [STATE_CLEARING]  = { "CLEARING",  STATE_PLAYING, clearing_enter,  clearing_exit,  clearing_tick },
+    [STATE_GAME_OVER] = { "GAME_OVER", SM_NO_PARENT,  game_over_enter, game_over_exit, game_over_tick },
+    [STATE_RESET]     = { "RESET",     SM_NO_PARENT,  reset_enter,     NULL,           NULL },
+};
+
 // ============================================================================
 // MAIN GAME LOOP TASK
 // ============================================================================
 
+/**
+ * @brief Initialisiert Spielzustand, Scheduler und State Machine
+ *
+ * Vom GameLoop Task einmal vor der Schleife aufgerufen; die Host-Simulation
+ * ruft game_loop_init()/game_loop_step() direkt ohne Task auf.
+ */
+void game_loop_init(void) {
+    speed_manager_init();
+    autoshift_init(&s_autoshift, (int64_t)AUTOSHIFT_DAS_MS * 1000, (int64_t)AUTOSHIFT_ARR_MS * 1000);
+    chord_init(&s_chords, s_chord_defs, sizeof(s_chord_defs) / sizeof(s_chord_defs[0]));
+    scheduler_init();
+    frame_deadline_init(&s_deadline, FRAME_BUDGET_US);
+    latency_trace_reset();
+    reset_game_state();
+    sm_init(&s_sm, s_states, STATE_COUNT, STATE_WAIT);
+}
+
+/**
+ * @brief Eine Iteration der Spielschleife
+ * 
+ * 1. Warten auf Deadline/Input
+ * 2. Alle Input-Events lesen (Chord-Erkennung + Frame-Puffer für die States)
+ * 3. Tastenkombinationen auswerten (Song-Wechsel, Emergency Reset)
+ * 4. sm_tick(): tick-Handler des aktiven Zustands, danach Übergänge
+ */
+void game_loop_step(void) {
+    // Schlafen bis eine Deadline fällig ist oder eine Button-Flanke weckt
+    uint32_t events = scheduler_wait();
+    TRACE_BEGIN(TRACE_FRAME);
+#if CONFIG_TETRIS_PROFILER
+    uint32_t frame_start = profiler_now();
+#endif
+    
+    // Alle Button-Events einmal pro Schleife lesen: Chord-Erkennung und
+    // Frame-Puffer für die tick-Handler
+    {
+        PROFILE_SCOPE(PROFILE_STAGE_INPUT);
+        TRACE_SCOPE(TRACE_INPUT);
+        s_frame_event_count = 0;
+        input_event_t ev;
+        while (s_frame_event_count < INPUT_RING_SIZE && controls_poll(&ev)) {
+            chord_feed(&s_chords, &ev);
+            s_frame_events[s_frame_event_count++] = ev;
+        }
+    }
+    
+    // ========================================================================
+    // TASTENKOMBINATIONEN (nicht-blockierend, Haltezeit über Scheduler)
+    // ========================================================================
+    // LEFT + RIGHT = nächster Song, ROTATE + FASTER = Emergency Reset.
+    // Wird die Kombination vor Ablauf der Haltezeit gebrochen, passiert nichts.
+    
+    chord_action_t chord = chord_poll(&s_chords, clock_now_us());
+    
+    if (chord == CHORD_ACTION_SONG_NEXT) {
+        theme_next_song();
+        BLOG(LOG_CHORD_SONG, theme_get_current_song());
+    } else if (chord == CHORD_ACTION_RESET) {
+        BLOG(LOG_CHORD_RESET);
+        sm_request(&s_sm, STATE_RESET);
+    }
+    
+    // ========================================================================
+    // STATE MACHINE
+    // ========================================================================
+    
+    sm_tick(&s_sm, events);
+    
+    int64_t chord_deadline = chord_deadline_us(&s_chords);
+    if (chord_deadline != INT64_MAX) {
+        scheduler_arm_at(SCHED_EVT_CHORD, chord_deadline);
+    } else {
+        scheduler_cancel(SCHED_EVT_CHORD);
+    }
+    
+    hud_service(clock_now_us());
+    
+#if CONFIG_TETRIS_PROFILER
+    profiler_record(PROFILE_STAGE_FRAME, profiler_now() - frame_start);
+#endif
+    profiler_frame_end();  // Snapshot für die Konsole (falls angefordert)
+    frame_deadline_check();
+    TRACE_END(TRACE_FRAME);
+}
+
 /**
  * @brief Haupt-Spielschleife als FreeRTOS Task
  * 
  * Task-Parameter:
  * - Priorität: 5 (hoch)
  * - Stack: 4096 Bytes
- * - Polling-Intervall: 5ms (responsive Input)
+ * - Event-getrieben: blockiert in scheduler_wait() bis zur nächsten Deadline
+ *   oder bis der Button-Abtaster den Task weckt (keine feste Polling-Schleife)
+ * - Input: Press-/Release-Flanken mit Zeitstempel, DAS/ARR über Auto-Repeat Event
  * - Render-Intervall: 16ms (60 FPS)
- * - Fall-Intervall: dynamisch (400ms initial, bis 50ms bei Level 10)
+ * - Gravity: dynamisch (400ms pro Reihe initial, bis 20G), Lock Delay pro Level
  * 
- * State Machine:
- * - WAIT: Warte auf Button zum Starten (Splash scrollt)
- * - RUNNING: Spiel läuft (Input, Physics, Rendering)
- * - GAME_OVER: Übergang zu WAIT nach Animation
- * - EMERGENCY_RESET: Hard-Reset via 4-Button-Combo
+ * Kein Handler blockiert → Neustart-Latenz max. ein Frame, Musik/HUD/Input bleiben aktiv.
  * 
  * @param pvParameters Unused (NULL)
  */
 void game_loop_task(void *pvParameters) {
-    // ========================================================================
-    // INITIALISIERUNG
-    // ========================================================================
-    
-    speed_manager_init();
-    reset_game_state();
-    
-    bool game_running = false;
-    uint32_t last_fall_time = 0;
-    uint32_t last_render_time = 0;
-    
-    // ========================================================================
-    // HAUPTSCHLEIFE
-    // ========================================================================
+    game_loop_init();
     
     while (1) {
-        uint32_t current_time = xTaskGetTickCount() * portTICK_PERIOD_MS;
-        
-        // Lesen der aktuellen Button-Presses einmal pro Schleife.
-        // Vermeidet, dass ein einzelner Druck in mehreren Abfragen verbraucht wird.
-        bool left_pressed = check_button_pressed(BTN_LEFT);
-        bool right_pressed = check_button_pressed(BTN_RIGHT);
-        bool rotate_pressed = check_button_pressed(BTN_ROTATE);
-        bool faster_pressed = check_button_pressed(BTN_FASTER);
-        
-        // ====================================================================
-        // SONG WECHSEL: LEFT + RIGHT BUTTONS für 1 Sekunde
-        // ====================================================================
-        
-        if (left_pressed && right_pressed) {
-            // 1 Sekunde halten erforderlich (versehentliche Trigger vermeiden)
-            vTaskDelay(pdMS_TO_TICKS(1000));
-            
-            // GPIO direkt auslesen statt check_button_pressed() (verbraucht keinen Zustand)
-            // Buttons sind active-LOW: 0 = gedrückt, 1 = released
-            if ((gpio_get_level(BTN_LEFT) == 0 && gpio_get_level(BTN_RIGHT) == 0)) {
-                // ========================================================
-                // LEFT + RIGHT Song wechseln (funktioniert ÜBERALL: im Spiel UND im Splash)
-                // ========================================================
-                printf("[GameLoop] Song change triggered (LEFT + RIGHT buttons)\n");
-                theme_next_song();
-                printf("[GameLoop] Switched to song #%d\n", theme_get_current_song());
-                
-                // Kurz pausieren für visuelles Feedback
-                theme_pause();
-                vTaskDelay(pdMS_TO_TICKS(200));
-                theme_resume();
-                
-                // Warten bis Buttons released
-                vTaskDelay(pdMS_TO_TICKS(50));
-                while (gpio_get_level(BTN_LEFT) == 0 && gpio_get_level(BTN_RIGHT) == 0) {
-                    vTaskDelay(pdMS_TO_TICKS(20));
-                }
-            }
-        }
-        
-        // ====================================================================
-        // EMERGENCY RESET: ROTATE + FASTER Buttons (funktioniert ÜBERALL)
-        // ====================================================================
-        
-        if (rotate_pressed && faster_pressed) {
-            // 1 Sekunde halten erforderlich (versehentliche Trigger vermeiden)
-            vTaskDelay(pdMS_TO_TICKS(1000));
-            
-            // GPIO direkt auslesen statt check_button_pressed() (verbraucht keinen Zustand)
-            // Buttons sind active-LOW: 0 = gedrückt, 1 = released
-            if (gpio_get_level(BTN_ROTATE) == 0 && gpio_get_level(BTN_FASTER) == 0) {
-                // ========================================================
-                // ROTATE + FASTER = Emergency Reset (im Spiel UND im Splash)
-                // ========================================================
-                printf("[GameLoop] Emergency reset triggered (ROTATE + FASTER buttons)\n");
-                
-                // Musik kurz pausieren für Feedback
-                theme_pause();
-                
-                // Hard Reset durchführen
-                reset_game_state();
-                led_strip_clear(led_strip);
-                led_strip_refresh(led_strip);
-                
-                // Musik fortsetzen
-                theme_resume();
-                
-                // Zurück zum WAIT STATE (Splash-Menü)
-                game_running = false;
-                
-                // Neustart-Sequenz
-                wait_for_restart();
-                
-                // Warten bis Buttons released
-                vTaskDelay(pdMS_TO_TICKS(50));
-                while (gpio_get_level(BTN_ROTATE) == 0 || gpio_get_level(BTN_FASTER) == 0) {
-                    vTaskDelay(pdMS_TO_TICKS(20));
-                }
-                
-                continue;
-            }
-        }
-        
-        // ====================================================================
-        // GAME OVER CHECK
-        // ====================================================================
-        
-        if (game_over_flag) {
-            game_over_flag = 0;
-            game_running = false;
-            display_reset_and_show_hud(score_get_highscore());
-            
-            // Neustart-Sequenz
-            wait_for_restart();
-            
-            // Spiel starten
-            splash_clear();
-            reset_game_state();
-            spawn_block();
-            game_running = true;
-            last_fall_time = xTaskGetTickCount() * portTICK_PERIOD_MS;
-            last_render_time = last_fall_time;
-            continue;
-        }
-        
-        // ====================================================================
-        // WAIT STATE (Spiel noch nicht gestartet)
-        // ====================================================================
-        
-        if (!game_running) {
-            // ✅ Musik abspielen während Splash-Menü
-            theme_resume();
-            
-            // Splash-Animation (scrollt endlos bis Button gedrückt)
-            splash_show(SPLASH_DURATION_MS);
-            
-            // Queue drainieren
-            gpio_num_t ev;
-            while (controls_get_event(&ev)) {}
-            
-            // Warten auf Button-Release
-            vTaskDelay(pdMS_TO_TICKS(50));
-            while (check_button_pressed(BTN_LEFT) || check_button_pressed(BTN_RIGHT) ||
-                   check_button_pressed(BTN_ROTATE) || check_button_pressed(BTN_FASTER)) {
-                vTaskDelay(pdMS_TO_TICKS(20));
-            }
-            
-            // Warte auf frischen Button-Press
-            controls_wait_event(&ev, portMAX_DELAY);
-            vTaskDelay(pdMS_TO_TICKS(50));
-            
-            printf("[GameLoop] Button pressed, starting game! GPIO: %d\n", ev);
-            
-            // Spiel starten
-            splash_clear();
-            reset_game_state();
-            spawn_block();
-            game_running = true;
-            theme_resume();  // ✅ Musik bleibt laufen im Spiel
-            last_fall_time = xTaskGetTickCount() * portTICK_PERIOD_MS;
-            last_render_time = last_fall_time;
-            printf("[GameLoop] Game started, game_running = %d\n", game_running);
-            continue;
-        }
-        
-        // ====================================================================
-        // RUNNING STATE - INPUT HANDLING
-        // ====================================================================
-        
-        TetrisBlock tmp;
-        
-        // Links-Bewegung
-        if (left_pressed) {
-            printf("[GameLoop] LEFT button detected in RUNNING state\n");
-            tmp = current_block;
-            tmp.x--;
-            if (!grid_check_collision(&tmp)) {
-                current_block = tmp;
-                printf("[GameLoop] Block moved LEFT\n");
-            } else {
-                printf("[GameLoop] LEFT movement blocked by collision\n");
-            }
-        }
-        
-        // Rechts-Bewegung
-        if (right_pressed) {
-            tmp = current_block;
-            tmp.x++;
-            if (!grid_check_collision(&tmp)) {
-                current_block = tmp;
-            }
-        }
-        
-        // Rotation (O-Block rotiert nicht)
-        if (rotate_pressed && current_block.color != 3) {
-            tmp = current_block;
-            rotate_block_90(&tmp);
-            if (!grid_check_collision(&tmp)) {
-                current_block = tmp;
-            }
-        }
-        
-        // Manuelles Fallenlassen (Schneller-Taste)
-        if (faster_pressed) {
-            tmp = current_block;
-            tmp.y++;
-            if (!grid_check_collision(&tmp)) {
-                current_block = tmp;
-            }
-        }
-        
-        // ====================================================================
-        // AUTOMATIC FALL (Zeit-basiert)
-        // ====================================================================
-        
-        uint32_t fall_interval = speed_manager_get_fall_interval();
-        if (current_time - last_fall_time >= fall_interval) {
-            last_fall_time = current_time;
-            
-            tmp = current_block;
-            tmp.y++;
-            
-            if (!grid_check_collision(&tmp)) {
-                // Block kann weiter fallen
-                current_block = tmp;
-            } else {
-                // Kollision → Block fixieren und neuen spawnen
-                grid_fix_block(&current_block);
-                spawn_block();
-            }
-        }
-        
-        // ====================================================================
-        // RENDERING (60 FPS)
-        // ====================================================================
-        
-        if (current_time - last_render_time >= RENDER_INTERVAL_MS) {
-            last_render_time = current_time;
-            render_grid();
-        }
-        
-        // ====================================================================
-        // TASK DELAY (5ms Polling-Intervall)
-        // ====================================================================
-        
-        vTaskDelay(pdMS_TO_TICKS(LOOP_INTERVAL_MS));
+        game_loop_step();
     }
 }
 
@@ -642,5 +1058,17 @@ void game_loop_task(void *pvParameters) {
  * für die Spielschleife.
  */
 void start_game_loop(void) {
-    xTaskCreate(game_loop_task, "GameLoopTask", 4096, NULL, 5, NULL);
+    task_config_create(TASK_ROLE_GAMELOOP, game_loop_task, NULL, NULL);
+}
+
+void game_loop_get_deadline(frame_deadline_t *out) {
+    *out = s_deadline;  // Diagnose: ein zerrissener Wert ist unkritisch
+}
+
+void game_loop_request_deadline_reset(void) {
+    s_deadline_reset_requested = true;
+}
+
+void game_loop_request_hud_update(void) {
+    s_hud_update_requested = true;
 }
@@ -0,0 +1,130 @@
+/**
+ * @file StateMachine.c
+ * @brief Tabellengesteuerter hierarchischer Zustandsautomat
+ *
+ * Ersetzt die blockierenden Sequenzen im GameLoop (wait_for_restart,
+ * Splash vor dem Warten auf Input, Blink-Animationen mit Sleeps).
+ * Jeder Zustand reagiert nur auf Scheduler-Events und kehrt sofort
+ * zurück, dadurch bleiben Musik, HUD und Input immer aktiv.
+ *
+ * Reine Logik ohne FreeRTOS-/ESP-Abhängigkeiten (Host-kompilierbar).
+ */
+
+#include "StateMachine.h"
+#include "Trace.h"
+#include <stdio.h>
+
+/** @brief Obergrenze für Übergänge pro Tick (Schutz vor Ping-Pong zwischen enter-Handlern) */
+#define SM_MAX_TRANSITIONS_PER_TICK  8
+
+// ============================================================================
+// HELPER FUNKTIONEN
+// ============================================================================
+
+/**
+ * @brief Pfad vom Wurzel-Zustand bis state (path[0] = Wurzel)
+ * @return Länge des Pfads
+ */
+static int sm_path(const state_machine_t *sm, int state, int path[SM_MAX_DEPTH]) {
+    int rev[SM_MAX_DEPTH];
+    int depth = 0;
+    while (state != SM_NO_PARENT && depth < SM_MAX_DEPTH) {
+        rev[depth++] = state;
+        state = sm->states[state].parent;
+    }
+    for (int i = 0; i < depth; i++) {
+        path[i] = rev[depth - 1 - i];
+    }
+    return depth;
+}
+
+/**
+ * @brief Führt einen Übergang current → next aus
+ */
+static void sm_transition(state_machine_t *sm, int next) {
+    int from[SM_MAX_DEPTH], to[SM_MAX_DEPTH];
+    int from_len = sm_path(sm, sm->current, from);
+    int to_len = sm_path(sm, next, to);
+
+    // Gemeinsamen Vorfahren bestimmen (Self-Transition verlässt/betritt das Blatt)
+    int common = 0;
+    while (common < from_len && common < to_len && from[common] == to[common]) {
+        common++;
+    }
+    if (common == from_len && common == to_len && common > 0) {
+        common--;
+    }
+
+    for (int i = from_len - 1; i >= common; i--) {
+        if (sm->states[from[i]].exit) sm->states[from[i]].exit();
+    }
+
+    printf("[State] %s -> %s\n",
+           sm->current >= 0 ? sm->states[sm->current].name : "-", sm->states[next].name);
+    sm->current = next;
+    TRACE_INSTANT(TRACE_STATE, next);
+
+    for (int i = common; i < to_len; i++) {
+        if (sm->states[to[i]].enter) sm->states[to[i]].enter();
+    }
+}
+
+/**
+ * @brief Führt alle angeforderten Übergänge aus
+ */
+static void sm_run_pending(state_machine_t *sm) {
+    for (int n = 0; n < SM_MAX_TRANSITIONS_PER_TICK && sm->pending != SM_NO_STATE; n++) {
+        int next = sm->pending;
+        sm->pending = SM_NO_STATE;
+        sm_transition(sm, next);
+    }
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+void sm_init(state_machine_t *sm, const sm_state_t *states, int num_states, int initial) {
+    sm->states = states;
+    sm->num_states = num_states;
+    sm->current = SM_NO_STATE;
+    sm->pending = SM_NO_STATE;
+
+    int path[SM_MAX_DEPTH];
+    int len = sm_path(sm, initial, path);
+    printf("[State] init -> %s\n", states[initial].name);
+    sm->current = initial;
+    for (int i = 0; i < len; i++) {
+        if (states[path[i]].enter) states[path[i]].enter();
+    }
+    sm_run_pending(sm);
+}
+
+void sm_request(state_machine_t *sm, int next) {
+    if (next < 0 || next >= sm->num_states) return;
+    sm->pending = next;
+}
+
+void sm_tick(state_machine_t *sm, uint32_t events) {
+    int path[SM_MAX_DEPTH];
+    int len = sm_path(sm, sm->current, path);
+
+    for (int i = 0; i < len; i++) {
+        if (sm->pending != SM_NO_STATE) break;  // Übergang angefordert → Rest überspringen
+        if (sm->states[path[i]].tick) sm->states[path[i]].tick(events);
+    }
+    sm_run_pending(sm);
+}
+
+bool sm_in_state(const state_machine_t *sm, int state) {
+    int s = sm->current;
+    while (s != SM_NO_PARENT) {
+        if (s == state) return true;
+        s = sm->states[s].parent;
+    }
+    return false;
+}
+
+int sm_current(const state_machine_t *sm) {
+    return sm->current;
+}
@@ -0,0 +1,189 @@
+/**
+ * @file LedStripBench.c
+ * @brief ISR-Zeit pro Frame: Bytes-Encoder (led_strip) gegen LUT-Encoder,
+ *        Encode-Durchsatz der SPI-Expansion
+ *
+ * Messmethode "gestohlene Zeit": der aufrufende Task dreht mit niedriger
+ * Priorität eine Schleife über den Zyklenzähler. Ein Hilfs-Task auf demselben
+ * Core (höhere Priorität) sendet die Frames und blockiert bis zum Ende der
+ * Übertragung. Jede Lücke im Zyklenzähler ist Zeit, die der Core woanders
+ * verbracht hat: RMT-ISR (Encoder füllt den 64-Symbol Speicher nach) plus
+ * das kurze Starten jeder Übertragung. Eine Leerlauf-Messung gleicher Dauer
+ * (Tick-Interrupt etc.) wird abgezogen.
+ *
+ * Beide Geräte werden nacheinander auf dem GPIO angelegt, gemessen und
+ * wieder gelöscht. Nur mit CONFIG_TETRIS_LED_ENCODER_BENCH.
+ *
+ * Der SPI-Teil misst nur CPU: Bit-Schleife (wie led_strip_spi_dev.c) gegen
+ * Tabelle für LED_SPI_BENCH_SMALL/LARGE LEDs, ohne Bus und GPIO.
+ */
+
+#include "LedStripLut.h"
+#include "LedStripSpi.h"
+#include "sdkconfig.h"
+#include <stdio.h>
+
+#if CONFIG_TETRIS_LED_ENCODER_BENCH
+
+#include "Profiler.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_cpu.h"
+#include "Ws2812Spi.h"
+#include "Globals.h"
+#include <stdlib.h>
+
+/** @brief Lücken im Zyklenzähler ab dieser Länge zählen als gestohlen */
+#define BENCH_GAP_CYCLES  64
+
+static led_strip_handle_t s_bench_strip = NULL;
+static int s_bench_frames = 0;
+static volatile bool s_bench_done = false;
+
+/**
+ * @brief Hilfs-Task: Frames senden (blockiert jeweils bis zur Übertragung)
+ */
+static void bench_refresh_task(void *pvParameters) {
+    for (int i = 0; i < s_bench_frames; i++) {
+        led_strip_refresh(s_bench_strip);
+    }
+    s_bench_done = true;
+    vTaskDelete(NULL);
+}
+
+/**
+ * @brief Zyklen zählen, die dem Task gestohlen werden
+ *
+ * @param strip Gerät oder NULL (Leerlauf-Messung über duration_cycles)
+ * @param duration_cycles Nur Leerlauf: Messdauer
+ * @param elapsed_out Gesamtdauer der Messung (Zyklen)
+ */
+static uint64_t bench_stolen_cycles(led_strip_handle_t strip, uint64_t duration_cycles, uint64_t *elapsed_out) {
+    uint64_t stolen = 0;
+    uint64_t elapsed = 0;
+    uint32_t prev = esp_cpu_get_cycle_count();
+
+    if (strip != NULL) {
+        s_bench_strip = strip;
+        s_bench_done = false;
+        xTaskCreatePinnedToCore(bench_refresh_task, "LedBench", 3072, NULL,
+                                uxTaskPriorityGet(NULL) + 1, NULL, xPortGetCoreID());
+    }
+
+    while (strip != NULL ? !s_bench_done : elapsed < duration_cycles) {
+        uint32_t now = esp_cpu_get_cycle_count();
+        uint32_t gap = now - prev;
+        if (gap > BENCH_GAP_CYCLES) stolen += gap;
+        elapsed += gap;
+        prev = now;
+    }
+
+    *elapsed_out = elapsed;
+    return stolen;
+}
+
+/**
+ * @brief Ein Gerät messen und ausgeben
+ * @return ISR-Zeit pro Frame in µs (ohne Leerlauf-Anteil)
+ */
+static uint32_t bench_device(const char *name, led_strip_handle_t strip, uint32_t num_leds, int frames) {
+    // Buffer mit wechselnden Bits, damit beide Encoder alle Symbolarten erzeugen
+    for (uint32_t i = 0; i < num_leds; i++) {
+        led_strip_set_pixel(strip, i, i & 0xFF, 0x5A, 0xA5);
+    }
+
+    uint64_t elapsed = 0, idle_elapsed = 0;
+    uint64_t stolen = bench_stolen_cycles(strip, 0, &elapsed);
+    uint64_t idle = bench_stolen_cycles(NULL, elapsed, &idle_elapsed);
+    uint64_t isr = stolen > idle ? stolen - idle : 0;
+
+    uint32_t per_frame_us = (uint32_t)(isr / frames / PROFILE_TICKS_PER_US);
+    uint32_t frame_us = (uint32_t)(elapsed / frames / PROFILE_TICKS_PER_US);
+    printf("[LedBench] %-13s %5lu us ISR per frame (%lu us frame, %lu.%lu%% CPU)\n",
+           name, (unsigned long)per_frame_us, (unsigned long)frame_us,
+           (unsigned long)(per_frame_us * 1000 / frame_us / 10),
+           (unsigned long)(per_frame_us * 1000 / frame_us % 10));
+    return per_frame_us;
+}
+
+void led_strip_encoder_bench(const led_strip_config_t *strip_config, int frames) {
+    led_strip_handle_t strip = NULL;
+    s_bench_frames = frames;
+    printf("[LedBench] %d frames, %lu LEDs, CPU time stolen on core %d\n",
+           frames, (unsigned long)strip_config->max_leds, (int)xPortGetCoreID());
+
+    led_strip_rmt_config_t rmt_config = {
+        .resolution_hz = 10 * 1000 * 1000,
+        .flags.with_dma = false,
+    };
+    if (led_strip_new_rmt_device(strip_config, &rmt_config, &strip) == ESP_OK) {
+        bench_device("bytes encoder", strip, strip_config->max_leds, frames);
+        led_strip_del(strip);
+    }
+
+    led_strip_lut_config_t lut_config = { .mem_block_symbols = 0, .with_dma = false };
+    if (led_strip_new_lut_rmt_device(strip_config, &lut_config, &strip) == ESP_OK) {
+        bench_device("LUT encoder", strip, strip_config->max_leds, frames);
+
+        led_strip_lut_stats_t stats;
+        led_strip_lut_get_stats(strip, &stats);
+        if (stats.frames > 0) {
+            printf("[LedBench] LUT callback: %lu calls, %lu us per frame inside the encoder\n",
+                   (unsigned long)stats.callbacks,
+                   (unsigned long)(stats.cycles / stats.frames / PROFILE_TICKS_PER_US));
+        }
+        led_strip_del(strip);
+    }
+}
+
+/**
+ * @brief Zyklen pro Frame für einen SPI-Encoder (Mittel über LED_SPI_BENCH_ROUNDS)
+ */
+static uint32_t spi_bench_cycles(void (*encode)(const uint8_t *, size_t, uint8_t *),
+                                 const uint8_t *in, size_t n, uint8_t *out) {
+    uint32_t start = esp_cpu_get_cycle_count();
+    for (int r = 0; r < LED_SPI_BENCH_ROUNDS; r++) {
+        encode(in, n, out);
+    }
+    return (esp_cpu_get_cycle_count() - start) / LED_SPI_BENCH_ROUNDS;
+}
+
+void led_strip_spi_encode_bench(void) {
+    const uint32_t sizes[] = { LED_SPI_BENCH_SMALL, LED_SPI_BENCH_LARGE };
+    size_t max_bytes = LED_SPI_BENCH_LARGE * 3;
+
+    uint8_t *in = malloc(max_bytes);
+    uint8_t *out = malloc(max_bytes * WS2812_SPI_BYTES_PER_COLOR);
+    if (in == NULL || out == NULL) {
+        printf("[LedBench] SPI encode: no memory\n");
+        free(in);
+        free(out);
+        return;
+    }
+    for (size_t i = 0; i < max_bytes; i++) in[i] = (uint8_t)(i * 37);
+
+    for (int s = 0; s < 2; s++) {
+        size_t n = sizes[s] * 3;
+        uint32_t bits = spi_bench_cycles(ws2812_spi_encode_bits, in, n, out);
+        uint32_t lut = spi_bench_cycles(ws2812_spi_encode, in, n, out);
+        printf("[LedBench] SPI encode %4lu LEDs: bits %6lu us, LUT %6lu us (%lu MB/s), x%lu.%lu\n",
+               (unsigned long)sizes[s],
+               (unsigned long)(bits / PROFILE_TICKS_PER_US), (unsigned long)(lut / PROFILE_TICKS_PER_US),
+               (unsigned long)(lut ? (uint64_t)n * PROFILE_TICKS_PER_US / lut : 0),
+               (unsigned long)(lut ? bits / lut : 0), (unsigned long)(lut ? bits * 10 / lut % 10 : 0));
+    }
+    free(in);
+    free(out);
+}
+
+#else
+
+void led_strip_encoder_bench(const led_strip_config_t *strip_config, int frames) {
+    printf("[LedBench] Disabled (CONFIG_TETRIS_LED_ENCODER_BENCH)\n");
+}
+
+void led_strip_spi_encode_bench(void) {
+    printf("[LedBench] Disabled (CONFIG_TETRIS_LED_ENCODER_BENCH)\n");
+}
+
+#endif // CONFIG_TETRIS_LED_ENCODER_BENCH
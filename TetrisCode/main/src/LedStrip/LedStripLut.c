@@ -0,0 +1,158 @@
+/**
+ * @file LedStripLut.c
+ * @brief led_strip Gerät auf RMT mit Lookup-Tabellen-Encoder
+ *
+ * Implementiert das led_strip_t Interface (set_pixel/refresh/clear/del),
+ * damit Grid, GameLoop und Splash unverändert led_strip_* aufrufen. Die
+ * Pixel liegen als GRB-Bytes im Gerät; refresh() übergibt sie an einen
+ * Simple-Encoder, dessen Callback (ISR) Ws2812Lut.c ist.
+ */
+
+#include "LedStripLut.h"
+#include "Ws2812Lut.h"
+#include "Globals.h"
+#include "led_strip_interface.h"
+#include "driver/rmt_tx.h"
+#include "esp_check.h"
+#include "esp_attr.h"
+#include "sdkconfig.h"
+#include <stdlib.h>
+#include <string.h>
+
+#if CONFIG_TETRIS_LED_ENCODER_BENCH
+#include "esp_cpu.h"
+#endif
+
+static const char *TAG = "led_strip_lut";
+
+typedef struct {
+    led_strip_t base;
+    rmt_channel_handle_t channel;
+    rmt_encoder_handle_t encoder;
+    uint32_t num_leds;
+    led_strip_lut_stats_t stats;
+    uint8_t pixels[];               // GRB, 3 Byte pro LED
+} led_strip_lut_t;
+
+// ============================================================================
+// ENCODER CALLBACK (ISR)
+// ============================================================================
+
+IRAM_ATTR
+static size_t lut_strip_encode_cb(const void *data, size_t data_size, size_t symbols_written,
+                                  size_t symbols_free, rmt_symbol_word_t *symbols, bool *done, void *arg) {
+#if CONFIG_TETRIS_LED_ENCODER_BENCH
+    led_strip_lut_t *strip = (led_strip_lut_t *)arg;
+    uint32_t start = esp_cpu_get_cycle_count();
+    size_t n = ws2812_lut_encode(data, data_size, symbols_written, symbols_free, symbols, done, NULL);
+    strip->stats.cycles += esp_cpu_get_cycle_count() - start;
+    strip->stats.callbacks++;
+    return n;
+#else
+    return ws2812_lut_encode(data, data_size, symbols_written, symbols_free, symbols, done, NULL);
+#endif
+}
+
+// ============================================================================
+// led_strip_t INTERFACE
+// ============================================================================
+
+static esp_err_t lut_strip_set_pixel(led_strip_t *base, uint32_t index, uint32_t red, uint32_t green, uint32_t blue) {
+    led_strip_lut_t *strip = __containerof(base, led_strip_lut_t, base);
+    ESP_RETURN_ON_FALSE(index < strip->num_leds, ESP_ERR_INVALID_ARG, TAG, "index out of range");
+
+    uint8_t *p = &strip->pixels[index * 3];
+    p[0] = (uint8_t)green;
+    p[1] = (uint8_t)red;
+    p[2] = (uint8_t)blue;
+    return ESP_OK;
+}
+
+static esp_err_t lut_strip_set_pixel_rgbw(led_strip_t *base, uint32_t index, uint32_t red, uint32_t green,
+                                          uint32_t blue, uint32_t white) {
+    return ESP_ERR_NOT_SUPPORTED;  // Nur WS2812 (GRB)
+}
+
+static esp_err_t lut_strip_refresh(led_strip_t *base) {
+    led_strip_lut_t *strip = __containerof(base, led_strip_lut_t, base);
+    rmt_transmit_config_t tx_conf = { .loop_count = 0 };
+
+    ESP_RETURN_ON_ERROR(rmt_transmit(strip->channel, strip->encoder, strip->pixels,
+                                     strip->num_leds * 3, &tx_conf), TAG, "transmit failed");
+    ESP_RETURN_ON_ERROR(rmt_tx_wait_all_done(strip->channel, -1), TAG, "wait for done failed");
+    strip->stats.frames++;
+    return ESP_OK;
+}
+
+static esp_err_t lut_strip_clear(led_strip_t *base) {
+    led_strip_lut_t *strip = __containerof(base, led_strip_lut_t, base);
+    memset(strip->pixels, 0, strip->num_leds * 3);
+    return lut_strip_refresh(base);
+}
+
+static esp_err_t lut_strip_del(led_strip_t *base) {
+    led_strip_lut_t *strip = __containerof(base, led_strip_lut_t, base);
+    rmt_disable(strip->channel);
+    rmt_del_channel(strip->channel);
+    rmt_del_encoder(strip->encoder);
+    free(strip);
+    return ESP_OK;
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+esp_err_t led_strip_new_lut_rmt_device(const led_strip_config_t *strip_config,
+                                       const led_strip_lut_config_t *lut_config,
+                                       led_strip_handle_t *ret_strip) {
+    esp_err_t ret = ESP_OK;
+    led_strip_lut_t *strip = NULL;
+    ESP_GOTO_ON_FALSE(strip_config && lut_config && ret_strip && strip_config->max_leds > 0,
+                      ESP_ERR_INVALID_ARG, err, TAG, "invalid argument");
+
+    strip = calloc(1, sizeof(led_strip_lut_t) + strip_config->max_leds * 3);
+    ESP_GOTO_ON_FALSE(strip, ESP_ERR_NO_MEM, err, TAG, "no mem for led strip");
+    strip->num_leds = strip_config->max_leds;
+
+    rmt_tx_channel_config_t tx_chan_config = {
+        .clk_src = RMT_CLK_SRC_DEFAULT,
+        .gpio_num = strip_config->strip_gpio_num,
+        .mem_block_symbols = lut_config->mem_block_symbols ? lut_config->mem_block_symbols : RMT_MEM_BLOCK_SYMBOLS,
+        .resolution_hz = WS2812_RMT_RESOLUTION_HZ,
+        .trans_queue_depth = 4,
+        .flags.with_dma = lut_config->with_dma,
+        .flags.invert_out = strip_config->flags.invert_out,
+    };
+    ESP_GOTO_ON_ERROR(rmt_new_tx_channel(&tx_chan_config, &strip->channel), err, TAG, "create RMT channel failed");
+
+    rmt_simple_encoder_config_t enc_config = {
+        .callback = lut_strip_encode_cb,
+        .arg = strip,
+        .min_chunk_size = WS2812_SYMBOLS_PER_BYTE,
+    };
+    ESP_GOTO_ON_ERROR(rmt_new_simple_encoder(&enc_config, &strip->encoder), err, TAG, "create LUT encoder failed");
+    ESP_GOTO_ON_ERROR(rmt_enable(strip->channel), err, TAG, "enable RMT channel failed");
+
+    strip->base.set_pixel = lut_strip_set_pixel;
+    strip->base.set_pixel_rgbw = lut_strip_set_pixel_rgbw;
+    strip->base.refresh = lut_strip_refresh;
+    strip->base.clear = lut_strip_clear;
+    strip->base.del = lut_strip_del;
+
+    *ret_strip = &strip->base;
+    return ESP_OK;
+
+err:
+    if (strip) {
+        if (strip->encoder) rmt_del_encoder(strip->encoder);
+        if (strip->channel) rmt_del_channel(strip->channel);
+        free(strip);
+    }
+    return ret;
+}
+
+void led_strip_lut_get_stats(led_strip_handle_t handle, led_strip_lut_stats_t *out) {
+    led_strip_lut_t *strip = __containerof(handle, led_strip_lut_t, base);
+    *out = strip->stats;
+}
@@ -0,0 +1,164 @@
+/**
+ * @file LedStripMulti.c
+ * @brief led_strip Gerät, das Panelgruppen parallel auf mehreren RMT-Kanälen sendet
+ *
+ * Jeder Kanal hat einen eigenen Simple-Encoder mit dem Nibble-Tabellen-
+ * Callback aus Ws2812Lut.c (Encoder halten Zustand und können nicht geteilt
+ * werden). Die Kanäle lesen direkt aus ihrem Ausschnitt des gemeinsamen
+ * Frames, es wird nichts umkopiert.
+ */
+
+#include "LedStripMulti.h"
+#include "Ws2812Lut.h"
+#include "Globals.h"
+#include "led_strip_interface.h"
+#include "driver/rmt_tx.h"
+#include "esp_check.h"
+#include <stdlib.h>
+#include <string.h>
+
+static const char *TAG = "led_strip_multi";
+
+typedef struct {
+    led_strip_t base;
+    uint8_t num_channels;
+    rmt_channel_handle_t channel[LED_MULTI_MAX_CHANNELS];
+    rmt_encoder_handle_t encoder[LED_MULTI_MAX_CHANNELS];
+    led_channel_span_t span[LED_MULTI_MAX_CHANNELS];
+    uint32_t num_leds;
+    uint8_t pixels[];               // GRB, 3 Byte pro LED, Index = Position in der Kette
+} led_strip_multi_t;
+
+// ============================================================================
+// KANAL-AUFTEILUNG
+// ============================================================================
+
+bool led_channel_map_build(uint32_t num_leds, uint32_t panel_leds, uint8_t channels,
+                           led_channel_span_t *spans) {
+    if (channels == 0 || channels > LED_MULTI_MAX_CHANNELS || panel_leds == 0 || num_leds % panel_leds != 0) {
+        return false;
+    }
+    uint32_t panels = num_leds / panel_leds;
+    if (channels > panels) return false;
+
+    uint32_t first = 0;
+    for (uint8_t c = 0; c < channels; c++) {
+        uint32_t count = panels / channels + (c < panels % channels ? 1 : 0);
+        spans[c].first_led = (uint16_t)first;
+        spans[c].num_leds = (uint16_t)(count * panel_leds);
+        first += spans[c].num_leds;
+    }
+    return true;
+}
+
+// ============================================================================
+// led_strip_t INTERFACE
+// ============================================================================
+
+static esp_err_t multi_set_pixel(led_strip_t *base, uint32_t index, uint32_t red, uint32_t green, uint32_t blue) {
+    led_strip_multi_t *strip = __containerof(base, led_strip_multi_t, base);
+    ESP_RETURN_ON_FALSE(index < strip->num_leds, ESP_ERR_INVALID_ARG, TAG, "index out of range");
+
+    uint8_t *p = &strip->pixels[index * 3];
+    p[0] = (uint8_t)green;
+    p[1] = (uint8_t)red;
+    p[2] = (uint8_t)blue;
+    return ESP_OK;
+}
+
+static esp_err_t multi_set_pixel_rgbw(led_strip_t *base, uint32_t index, uint32_t red, uint32_t green,
+                                      uint32_t blue, uint32_t white) {
+    return ESP_ERR_NOT_SUPPORTED;  // Nur WS2812 (GRB)
+}
+
+static esp_err_t multi_refresh(led_strip_t *base) {
+    led_strip_multi_t *strip = __containerof(base, led_strip_multi_t, base);
+    rmt_transmit_config_t tx_conf = { .loop_count = 0 };
+
+    // Erst alle starten, dann warten: die Übertragungen laufen gleichzeitig
+    for (uint8_t c = 0; c < strip->num_channels; c++) {
+        ESP_RETURN_ON_ERROR(rmt_transmit(strip->channel[c], strip->encoder[c],
+                                         &strip->pixels[strip->span[c].first_led * 3],
+                                         strip->span[c].num_leds * 3, &tx_conf), TAG, "transmit failed");
+    }
+    for (uint8_t c = 0; c < strip->num_channels; c++) {
+        ESP_RETURN_ON_ERROR(rmt_tx_wait_all_done(strip->channel[c], -1), TAG, "wait for done failed");
+    }
+    return ESP_OK;
+}
+
+static esp_err_t multi_clear(led_strip_t *base) {
+    led_strip_multi_t *strip = __containerof(base, led_strip_multi_t, base);
+    memset(strip->pixels, 0, strip->num_leds * 3);
+    return multi_refresh(base);
+}
+
+static void multi_free(led_strip_multi_t *strip) {
+    for (uint8_t c = 0; c < LED_MULTI_MAX_CHANNELS; c++) {
+        if (strip->channel[c]) {
+            rmt_disable(strip->channel[c]);
+            rmt_del_channel(strip->channel[c]);
+        }
+        if (strip->encoder[c]) rmt_del_encoder(strip->encoder[c]);
+    }
+    free(strip);
+}
+
+static esp_err_t multi_del(led_strip_t *base) {
+    multi_free(__containerof(base, led_strip_multi_t, base));
+    return ESP_OK;
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+esp_err_t led_strip_new_multi_rmt_device(const led_strip_config_t *strip_config,
+                                         const led_strip_multi_config_t *multi_config,
+                                         led_strip_handle_t *ret_strip) {
+    esp_err_t ret = ESP_OK;
+    led_strip_multi_t *strip = NULL;
+    ESP_GOTO_ON_FALSE(strip_config && multi_config && multi_config->gpio_nums && ret_strip,
+                      ESP_ERR_INVALID_ARG, err, TAG, "invalid argument");
+
+    strip = calloc(1, sizeof(led_strip_multi_t) + strip_config->max_leds * 3);
+    ESP_GOTO_ON_FALSE(strip, ESP_ERR_NO_MEM, err, TAG, "no mem for led strip");
+    strip->num_leds = strip_config->max_leds;
+    strip->num_channels = multi_config->num_channels;
+    ESP_GOTO_ON_FALSE(led_channel_map_build(strip->num_leds, multi_config->panel_leds,
+                                            strip->num_channels, strip->span),
+                      ESP_ERR_INVALID_ARG, err, TAG, "invalid channel split");
+
+    for (uint8_t c = 0; c < strip->num_channels; c++) {
+        rmt_tx_channel_config_t tx_chan_config = {
+            .clk_src = RMT_CLK_SRC_DEFAULT,
+            .gpio_num = multi_config->gpio_nums[c],
+            .mem_block_symbols = RMT_MEM_BLOCK_SYMBOLS,
+            .resolution_hz = WS2812_RMT_RESOLUTION_HZ,
+            .trans_queue_depth = 4,
+            .flags.invert_out = strip_config->flags.invert_out,
+        };
+        ESP_GOTO_ON_ERROR(rmt_new_tx_channel(&tx_chan_config, &strip->channel[c]), err, TAG, "create RMT channel failed");
+
+        rmt_simple_encoder_config_t enc_config = {
+            .callback = ws2812_lut_encode,
+            .arg = NULL,
+            .min_chunk_size = WS2812_SYMBOLS_PER_BYTE,
+        };
+        ESP_GOTO_ON_ERROR(rmt_new_simple_encoder(&enc_config, &strip->encoder[c]), err, TAG, "create encoder failed");
+        ESP_GOTO_ON_ERROR(rmt_enable(strip->channel[c]), err, TAG, "enable RMT channel failed");
+    }
+
+    strip->base.set_pixel = multi_set_pixel;
+    strip->base.set_pixel_rgbw = multi_set_pixel_rgbw;
+    strip->base.refresh = multi_refresh;
+    strip->base.clear = multi_clear;
+    strip->base.del = multi_del;
+
+    *ret_strip = &strip->base;
+    return ESP_OK;
+
+err:
+    if (strip) multi_free(strip);
+    return ret;
+}
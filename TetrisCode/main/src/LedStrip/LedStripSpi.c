@@ -0,0 +1,150 @@
+/**
+ * @file LedStripSpi.c
+ * @brief led_strip Gerät auf SPI mit Tabellen-Expansion und DMA-Puffer
+ *
+ * Gleiche Signalform wie led_strip_spi_dev.c (2.5 MHz, 3 SPI-Bits pro
+ * WS2812-Bit), aber set_pixel() kopiert drei fertige Tabelleneinträge statt
+ * 24 Bits einzeln zu setzen. Der Puffer liegt im internen DMA-fähigen RAM und
+ * endet mit WS2812_SPI_RESET_BYTES Nullbytes, damit auch direkt aufeinander
+ * folgende Frames sauber latchen.
+ */
+
+#include "LedStripSpi.h"
+#include "Ws2812Spi.h"
+#include "led_strip_interface.h"
+#include "esp_check.h"
+#include "esp_heap_caps.h"
+#include <stdlib.h>
+#include <string.h>
+
+static const char *TAG = "led_strip_spi_lut";
+
+typedef struct {
+    led_strip_t base;
+    spi_host_device_t spi_bus;
+    spi_device_handle_t spi_device;
+    uint32_t num_leds;
+    size_t buf_size;
+    uint8_t *tx_buf;                // DMA-fähig, WS2812_SPI_BUFFER_SIZE(num_leds)
+} led_strip_spi_lut_t;
+
+// ============================================================================
+// led_strip_t INTERFACE
+// ============================================================================
+
+static esp_err_t spi_lut_set_pixel(led_strip_t *base, uint32_t index, uint32_t red, uint32_t green, uint32_t blue) {
+    led_strip_spi_lut_t *strip = __containerof(base, led_strip_spi_lut_t, base);
+    ESP_RETURN_ON_FALSE(index < strip->num_leds, ESP_ERR_INVALID_ARG, TAG, "index out of range");
+
+    uint8_t *p = &strip->tx_buf[index * WS2812_SPI_BYTES_PER_LED];
+    memcpy(p,     ws2812_spi_lut((uint8_t)green), WS2812_SPI_BYTES_PER_COLOR);
+    memcpy(p + 3, ws2812_spi_lut((uint8_t)red),   WS2812_SPI_BYTES_PER_COLOR);
+    memcpy(p + 6, ws2812_spi_lut((uint8_t)blue),  WS2812_SPI_BYTES_PER_COLOR);
+    return ESP_OK;
+}
+
+static esp_err_t spi_lut_set_pixel_rgbw(led_strip_t *base, uint32_t index, uint32_t red, uint32_t green,
+                                        uint32_t blue, uint32_t white) {
+    return ESP_ERR_NOT_SUPPORTED;  // Nur WS2812 (GRB)
+}
+
+static esp_err_t spi_lut_refresh(led_strip_t *base) {
+    led_strip_spi_lut_t *strip = __containerof(base, led_strip_spi_lut_t, base);
+    spi_transaction_t t = {
+        .length = strip->buf_size * 8,
+        .tx_buffer = strip->tx_buf,
+        .rx_buffer = NULL,
+    };
+    ESP_RETURN_ON_ERROR(spi_device_transmit(strip->spi_device, &t), TAG, "transmit failed");
+    return ESP_OK;
+}
+
+static esp_err_t spi_lut_clear(led_strip_t *base) {
+    led_strip_spi_lut_t *strip = __containerof(base, led_strip_spi_lut_t, base);
+    const uint8_t *off = ws2812_spi_lut(0);
+    for (uint32_t i = 0; i < strip->num_leds * 3; i++) {
+        memcpy(&strip->tx_buf[i * WS2812_SPI_BYTES_PER_COLOR], off, WS2812_SPI_BYTES_PER_COLOR);
+    }
+    return spi_lut_refresh(base);
+}
+
+static esp_err_t spi_lut_del(led_strip_t *base) {
+    led_strip_spi_lut_t *strip = __containerof(base, led_strip_spi_lut_t, base);
+    ESP_RETURN_ON_ERROR(spi_bus_remove_device(strip->spi_device), TAG, "remove device failed");
+    ESP_RETURN_ON_ERROR(spi_bus_free(strip->spi_bus), TAG, "free bus failed");
+    heap_caps_free(strip->tx_buf);
+    free(strip);
+    return ESP_OK;
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+esp_err_t led_strip_new_spi_lut_device(const led_strip_config_t *strip_config,
+                                       const led_strip_spi_lut_config_t *spi_config,
+                                       led_strip_handle_t *ret_strip) {
+    esp_err_t ret = ESP_OK;
+    led_strip_spi_lut_t *strip = NULL;
+    bool bus_ready = false;
+    ESP_GOTO_ON_FALSE(strip_config && spi_config && ret_strip && strip_config->max_leds > 0,
+                      ESP_ERR_INVALID_ARG, err, TAG, "invalid argument");
+
+    strip = calloc(1, sizeof(led_strip_spi_lut_t));
+    ESP_GOTO_ON_FALSE(strip, ESP_ERR_NO_MEM, err, TAG, "no mem for led strip");
+    strip->num_leds = strip_config->max_leds;
+    strip->spi_bus = spi_config->spi_bus;
+    strip->buf_size = WS2812_SPI_BUFFER_SIZE(strip->num_leds);
+
+    // DMA liest direkt aus diesem Puffer → intern und DMA-fähig; calloc-Nullen = Reset am Ende
+    uint32_t caps = spi_config->with_dma ? (MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL) : MALLOC_CAP_8BIT;
+    strip->tx_buf = heap_caps_calloc(1, strip->buf_size, caps);
+    ESP_GOTO_ON_FALSE(strip->tx_buf, ESP_ERR_NO_MEM, err, TAG, "no mem for tx buffer");
+
+    spi_bus_config_t bus_config = {
+        .mosi_io_num = strip_config->strip_gpio_num,
+        .miso_io_num = -1,
+        .sclk_io_num = -1,
+        .quadwp_io_num = -1,
+        .quadhd_io_num = -1,
+        .max_transfer_sz = strip->buf_size,
+    };
+    ESP_GOTO_ON_ERROR(spi_bus_initialize(strip->spi_bus, &bus_config,
+                                         spi_config->with_dma ? SPI_DMA_CH_AUTO : SPI_DMA_DISABLED),
+                      err, TAG, "create SPI bus failed");
+    bus_ready = true;
+
+    spi_device_interface_config_t dev_config = {
+        .clock_source = SPI_CLK_SRC_DEFAULT,
+        .mode = 0,
+        .clock_speed_hz = WS2812_SPI_CLOCK_HZ,
+        .spics_io_num = -1,
+        .queue_size = 4,
+    };
+    ESP_GOTO_ON_ERROR(spi_bus_add_device(strip->spi_bus, &dev_config, &strip->spi_device),
+                      err, TAG, "add SPI device failed");
+
+    // Die Tabelle setzt genau 2.5 MHz voraus (led_strip erlaubt ±300 kHz)
+    int freq_khz = 0;
+    spi_device_get_actual_freq(strip->spi_device, &freq_khz);
+    ESP_GOTO_ON_FALSE(freq_khz > WS2812_SPI_CLOCK_HZ / 1000 - 300 && freq_khz < WS2812_SPI_CLOCK_HZ / 1000 + 300,
+                      ESP_ERR_NOT_SUPPORTED, err, TAG, "unsupported SPI clock");
+
+    strip->base.set_pixel = spi_lut_set_pixel;
+    strip->base.set_pixel_rgbw = spi_lut_set_pixel_rgbw;
+    strip->base.refresh = spi_lut_refresh;
+    strip->base.clear = spi_lut_clear;
+    strip->base.del = spi_lut_del;
+
+    *ret_strip = &strip->base;
+    return ESP_OK;
+
+err:
+    if (strip) {
+        if (strip->spi_device) spi_bus_remove_device(strip->spi_device);
+        if (bus_ready) spi_bus_free(strip->spi_bus);
+        if (strip->tx_buf) heap_caps_free(strip->tx_buf);
+        free(strip);
+    }
+    return ret;
+}
@@ -0,0 +1,68 @@
+/**
+ * @file Ws2812Lut.c
+ * @brief WS2812 Symbol-Encoder über eine konstante Nibble-Tabelle
+ *
+ * Pro Byte zwei Tabellenzugriffe und 8 Wort-Kopien statt 8 Bit-Tests mit
+ * Verzweigung. Die Tabelle liegt im DRAM (kein Flash-Cache-Miss im ISR),
+ * der Callback im IRAM wie die Encoder des RMT-Treibers.
+ */
+
+#include "Ws2812Lut.h"
+#include "esp_attr.h"
+#include <string.h>
+
+// Ein Bit als Symbol: high zuerst, dann low
+#define WS2812_SYMBOL(one) { \
+    .duration0 = (one) ? WS2812_T1H_TICKS : WS2812_T0H_TICKS, .level0 = 1, \
+    .duration1 = (one) ? WS2812_T1L_TICKS : WS2812_T0L_TICKS, .level1 = 0 }
+
+// 4 Bits eines Nibbles, MSB zuerst
+#define WS2812_NIBBLE(n) { \
+    WS2812_SYMBOL((n) & 8), WS2812_SYMBOL((n) & 4), WS2812_SYMBOL((n) & 2), WS2812_SYMBOL((n) & 1) }
+
+static DRAM_ATTR const rmt_symbol_word_t s_nibble_lut[16][4] = {
+    WS2812_NIBBLE(0x0), WS2812_NIBBLE(0x1), WS2812_NIBBLE(0x2), WS2812_NIBBLE(0x3),
+    WS2812_NIBBLE(0x4), WS2812_NIBBLE(0x5), WS2812_NIBBLE(0x6), WS2812_NIBBLE(0x7),
+    WS2812_NIBBLE(0x8), WS2812_NIBBLE(0x9), WS2812_NIBBLE(0xA), WS2812_NIBBLE(0xB),
+    WS2812_NIBBLE(0xC), WS2812_NIBBLE(0xD), WS2812_NIBBLE(0xE), WS2812_NIBBLE(0xF),
+};
+
+static DRAM_ATTR const rmt_symbol_word_t s_reset_symbol = {
+    .duration0 = WS2812_RESET_TICKS, .level0 = 0,
+    .duration1 = WS2812_RESET_TICKS, .level1 = 0,
+};
+
+IRAM_ATTR
+size_t ws2812_lut_encode(const void *data, size_t data_size, size_t symbols_written,
+                         size_t symbols_free, rmt_symbol_word_t *symbols, bool *done, void *arg) {
+    const uint8_t *bytes = (const uint8_t *)data;
+    size_t pos = symbols_written / WS2812_SYMBOLS_PER_BYTE;  // Nächstes Byte
+    size_t written = 0;
+
+    // Ganze Bytes, solange Platz ist
+    size_t count = symbols_free / WS2812_SYMBOLS_PER_BYTE;
+    if (count > data_size - pos) count = data_size - pos;
+
+    for (size_t i = 0; i < count; i++) {
+        uint8_t b = bytes[pos + i];
+        memcpy(&symbols[written], s_nibble_lut[b >> 4], sizeof(s_nibble_lut[0]));
+        memcpy(&symbols[written + 4], s_nibble_lut[b & 0x0F], sizeof(s_nibble_lut[0]));
+        written += WS2812_SYMBOLS_PER_BYTE;
+    }
+
+    // Alle Bytes geschrieben → Reset-Symbol anhängen (ggf. im nächsten Aufruf)
+    if (pos + count == data_size && written < symbols_free) {
+        symbols[written++] = s_reset_symbol;
+        *done = true;
+    }
+    return written;
+}
+
+rmt_symbol_word_t ws2812_bit_symbol(bool one) {
+    rmt_symbol_word_t s = WS2812_SYMBOL(one);
+    return s;
+}
+
+rmt_symbol_word_t ws2812_reset_symbol(void) {
+    return s_reset_symbol;
+}
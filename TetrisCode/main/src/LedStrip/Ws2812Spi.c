@@ -0,0 +1,55 @@
+/**
+ * @file Ws2812Spi.c
+ * @brief WS2812 SPI-Bitstrom über eine konstante Byte-Tabelle
+ *
+ * Die Tabelle wird vom Präprozessor erzeugt (kein Init zur Laufzeit):
+ * Bit k des Farbbytes landet als 1x0 an SPI-Bitposition 3k+2..3k, das
+ * feste Muster 100100...100 ist 0x924924.
+ */
+
+#include "Ws2812Spi.h"
+#include "esp_attr.h"
+#include <string.h>
+
+// 24 SPI-Bits eines Farbbytes (Bit 23 wird zuerst gesendet)
+#define WS2812_SPI_BITS(b) (0x924924UL | \
+    (((b) & 0x01UL) << 1)  | (((b) & 0x02UL) << 3)  | (((b) & 0x04UL) << 5)  | (((b) & 0x08UL) << 7) | \
+    (((b) & 0x10UL) << 9)  | (((b) & 0x20UL) << 11) | (((b) & 0x40UL) << 13) | (((b) & 0x80UL) << 15))
+
+#define WS2812_SPI_ENTRY(b) { \
+    (uint8_t)(WS2812_SPI_BITS(b) >> 16), (uint8_t)(WS2812_SPI_BITS(b) >> 8), (uint8_t)WS2812_SPI_BITS(b) }
+
+#define WS2812_SPI_ROW4(b)   WS2812_SPI_ENTRY(b), WS2812_SPI_ENTRY((b) + 1), \
+                             WS2812_SPI_ENTRY((b) + 2), WS2812_SPI_ENTRY((b) + 3)
+#define WS2812_SPI_ROW16(b)  WS2812_SPI_ROW4(b), WS2812_SPI_ROW4((b) + 4), \
+                             WS2812_SPI_ROW4((b) + 8), WS2812_SPI_ROW4((b) + 12)
+#define WS2812_SPI_ROW64(b)  WS2812_SPI_ROW16(b), WS2812_SPI_ROW16((b) + 16), \
+                             WS2812_SPI_ROW16((b) + 32), WS2812_SPI_ROW16((b) + 48)
+
+static DRAM_ATTR const uint8_t s_spi_lut[256][WS2812_SPI_BYTES_PER_COLOR] = {
+    WS2812_SPI_ROW64(0), WS2812_SPI_ROW64(64), WS2812_SPI_ROW64(128), WS2812_SPI_ROW64(192),
+};
+
+void ws2812_spi_encode(const uint8_t *bytes, size_t n, uint8_t *out) {
+    for (size_t i = 0; i < n; i++) {
+        memcpy(out, s_spi_lut[bytes[i]], WS2812_SPI_BYTES_PER_COLOR);
+        out += WS2812_SPI_BYTES_PER_COLOR;
+    }
+}
+
+void ws2812_spi_encode_bits(const uint8_t *bytes, size_t n, uint8_t *out) {
+    for (size_t i = 0; i < n; i++) {
+        uint32_t bits = 0;
+        for (int k = 7; k >= 0; k--) {
+            bits = (bits << 3) | ((bytes[i] >> k) & 1 ? 0x6 : 0x4);
+        }
+        out[0] = (uint8_t)(bits >> 16);
+        out[1] = (uint8_t)(bits >> 8);
+        out[2] = (uint8_t)bits;
+        out += WS2812_SPI_BYTES_PER_COLOR;
+    }
+}
+
+const uint8_t *ws2812_spi_lut(uint8_t value) {
+    return s_spi_lut[value];
+}
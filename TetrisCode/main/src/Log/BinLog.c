@@ -0,0 +1,218 @@
+/**
+ * @file BinLog.c
+ * @brief Verzögertes binäres Logging: lock-freie Core-Ringe + Drain-Task
+ *
+ * Vorher riefen Render-Timeouts, SpeedManager-Updates, Line-Clears und
+ * Input-Overflows printf() synchron im Frame auf. Bei 115200 Baud kostet eine
+ * Zeile über 5ms. Jetzt schreibt der Hot Path nur einen 24-Byte Record:
+ *
+ * - Ring pro Core, Slot-Reservierung per CAS auf head (Multi-Producer,
+ *   Sequenz pro Slot nach Vyukov), ein Consumer (Drain-Task)
+ * - Kein Lock, kein Warten: Ring voll → Record verwerfen und zählen
+ * - Drain-Task (Priorität 1) holt alle BINLOG_DRAIN_MS die Records beider
+ *   Ringe in Zeitstempel-Reihenfolge und formatiert sie über LogCatalog.h,
+ *   oder gibt sie als Hex aus (CONFIG_TETRIS_BINLOG_HEX, Host-Dekodierung)
+ *
+ * Die Ring-Funktionen sind reine Logik (Host-kompilierbar).
+ */
+
+#include "BinLog.h"
+#include "Globals.h"
+#include "Clock.h"
+#include "TaskConfig.h"
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <stdio.h>
+#include <string.h>
+
+#define BINLOG_RING_MASK  (BINLOG_RING_SIZE - 1)
+
+// ============================================================================
+// PRIVATE VARIABLEN
+// ============================================================================
+
+/** @brief Ein Ring pro Core (Index = xPortGetCoreID()) */
+static binlog_ring_t s_rings[portNUM_PROCESSORS];
+
+/** @brief Formate aus LogCatalog.h (Index = log_id_t) */
+#define BINLOG_CATALOG_FORMAT(id, fmt) fmt,
+static const char *const s_formats[LOG_ID_COUNT] = {
+    BINLOG_CATALOG(BINLOG_CATALOG_FORMAT)
+};
+
+/** @brief Zuletzt gemeldete Anzahl verworfener Records (nur Drain-Task) */
+static uint32_t s_reported_dropped = 0;
+
+static TaskHandle_t s_drain_task = NULL;
+
+// ============================================================================
+// RING (Multi-Producer, Single-Consumer)
+// ============================================================================
+
+void binlog_ring_init(binlog_ring_t *r) {
+    memset(r, 0, sizeof(*r));
+    for (uint32_t i = 0; i < BINLOG_RING_SIZE; i++) {
+        r->slots[i].seq = i;  // Slot i ist frei für Schreibposition i
+    }
+}
+
+/**
+ * @brief Record schreiben (Task/ISR, lock-frei)
+ *
+ * Slot an Position pos ist frei wenn seq == pos, belegt wenn seq == pos + 1.
+ * Der Consumer gibt ihn mit seq = pos + BINLOG_RING_SIZE für die nächste Runde frei.
+ */
+bool binlog_ring_push(binlog_ring_t *r, uint16_t id, uint8_t core, uint32_t timestamp_us,
+                      int32_t a0, int32_t a1, int32_t a2) {
+    binlog_record_t *rec;
+    uint32_t pos = __atomic_load_n(&r->head, __ATOMIC_RELAXED);
+
+    while (1) {
+        rec = &r->slots[pos & BINLOG_RING_MASK];
+        uint32_t seq = __atomic_load_n(&rec->seq, __ATOMIC_ACQUIRE);
+        int32_t diff = (int32_t)(seq - pos);
+
+        if (diff == 0) {
+            // Slot frei → reservieren (schlägt fehl, wenn ein anderer Producer schneller war)
+            if (__atomic_compare_exchange_n(&r->head, &pos, pos + 1, true,
+                                            __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                break;
+            }
+        } else if (diff < 0) {
+            // Consumer ist eine volle Runde zurück → Ring voll
+            __atomic_fetch_add(&r->dropped, 1, __ATOMIC_RELAXED);
+            return false;
+        } else {
+            pos = __atomic_load_n(&r->head, __ATOMIC_RELAXED);
+        }
+    }
+
+    rec->id = id;
+    rec->core = core;
+    rec->reserved = 0;
+    rec->timestamp_us = timestamp_us;
+    rec->args[0] = a0;
+    rec->args[1] = a1;
+    rec->args[2] = a2;
+    __atomic_store_n(&rec->seq, pos + 1, __ATOMIC_RELEASE);  // Veröffentlichen
+    __atomic_fetch_add(&r->written, 1, __ATOMIC_RELAXED);
+    return true;
+}
+
+bool binlog_ring_peek(const binlog_ring_t *r, binlog_record_t *out) {
+    const binlog_record_t *rec = &r->slots[r->tail & BINLOG_RING_MASK];
+    uint32_t seq = __atomic_load_n(&rec->seq, __ATOMIC_ACQUIRE);
+    if (seq != r->tail + 1) return false;  // Leer oder noch nicht fertig geschrieben
+
+    *out = *rec;
+    return true;
+}
+
+bool binlog_ring_pop(binlog_ring_t *r, binlog_record_t *out) {
+    if (!binlog_ring_peek(r, out)) return false;
+
+    binlog_record_t *rec = &r->slots[r->tail & BINLOG_RING_MASK];
+    __atomic_store_n(&rec->seq, r->tail + BINLOG_RING_SIZE, __ATOMIC_RELEASE);  // Freigeben
+    r->tail++;
+    return true;
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+void binlog_write(uint16_t id, int32_t a0, int32_t a1, int32_t a2) {
+    uint8_t core = (uint8_t)xPortGetCoreID();
+    binlog_ring_push(&s_rings[core], id, core, (uint32_t)clock_now_us(), a0, a1, a2);
+}
+
+int binlog_format(const binlog_record_t *rec, char *buf, int size) {
+    if (rec->id >= LOG_ID_COUNT) {
+        return snprintf(buf, size, "[BinLog] unknown id %u", rec->id);
+    }
+    return snprintf(buf, size, s_formats[rec->id],
+                    (long)rec->args[0], (long)rec->args[1], (long)rec->args[2]);
+}
+
+void binlog_get_stats(binlog_stats_t *out) {
+    out->written = 0;
+    out->dropped = 0;
+    for (int c = 0; c < portNUM_PROCESSORS; c++) {
+        out->written += __atomic_load_n(&s_rings[c].written, __ATOMIC_RELAXED);
+        out->dropped += __atomic_load_n(&s_rings[c].dropped, __ATOMIC_RELAXED);
+    }
+}
+
+// ============================================================================
+// DRAIN TASK
+// ============================================================================
+
+/**
+ * @brief Einen Record ausgeben (Text oder Hex für tools/binlog_decode.py)
+ */
+static void binlog_emit(const binlog_record_t *rec) {
+#if CONFIG_TETRIS_BINLOG_HEX
+    const uint8_t *bytes = (const uint8_t *)rec;
+    printf("BL ");
+    for (size_t i = 0; i < sizeof(*rec); i++) {
+        printf("%02x", bytes[i]);
+    }
+    printf("\n");
+#else
+    char line[160];
+    binlog_format(rec, line, sizeof(line));
+    printf("%s\n", line);
+#endif
+}
+
+/**
+ * @brief Leert alle Core-Ringe, ältester Zeitstempel zuerst
+ */
+static void binlog_drain(void) {
+    while (1) {
+        int oldest = -1;
+        binlog_record_t rec, best;
+
+        for (int c = 0; c < portNUM_PROCESSORS; c++) {
+            if (!binlog_ring_peek(&s_rings[c], &rec)) continue;
+            if (oldest < 0 || (int32_t)(rec.timestamp_us - best.timestamp_us) < 0) {
+                oldest = c;
+                best = rec;
+            }
+        }
+        if (oldest < 0) break;
+
+        binlog_ring_pop(&s_rings[oldest], &rec);
+        binlog_emit(&rec);
+    }
+
+    binlog_stats_t stats;
+    binlog_get_stats(&stats);
+    if (stats.dropped != s_reported_dropped) {
+        printf("[BinLog] WARNING: %lu records dropped in total (ring full)\n",
+               (unsigned long)stats.dropped);
+        s_reported_dropped = stats.dropped;
+    }
+}
+
+/**
+ * @brief Drain-Task: formatiert die Records außerhalb des Frames
+ *
+ * @param pvParameters Unused (NULL)
+ */
+static void binlog_drain_task(void *pvParameters) {
+    while (1) {
+        vTaskDelay(pdMS_TO_TICKS(BINLOG_DRAIN_MS));
+        binlog_drain();
+    }
+}
+
+void binlog_start(void) {
+    if (s_drain_task != NULL) return;
+
+    for (int c = 0; c < portNUM_PROCESSORS; c++) {
+        binlog_ring_init(&s_rings[c]);
+    }
+    task_config_create(TASK_ROLE_BINLOG, binlog_drain_task, NULL, &s_drain_task);
+}
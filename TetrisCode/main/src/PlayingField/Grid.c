@@ -1,17 +1,16 @@
 #include "Grid.h"
 #include "Score.h"
 #include "SpeedManager.h"
-#include "DisplayInit.h"
 #include "Globals.h"
-#include "led_strip.h"
+#include "Profiler.h"
+#include "BinLog.h"
+#include "Compositor.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/semphr.h"
 #include <string.h>
 #include <stdio.h>
 
-extern MATRIX ledMatrix;
-extern led_strip_handle_t led_strip;
 extern SemaphoreHandle_t led_strip_semaphore;
 extern SemaphoreHandle_t score_semaphore;
 
@@ -19,9 +18,12 @@ uint8_t grid[GRID_HEIGHT][GRID_WIDTH] = {0};
 
 void grid_init(void) {
     memset(grid, 0, sizeof(grid));
+    compositor_clear_layer(LAYER_LOCKED);
 }
 
 bool grid_check_collision(const TetrisBlock *block) {
+    PROFILE_SCOPE(PROFILE_STAGE_COLLISION);
+
     // Corner Detection: only check active (lit) pixels of the block
     for (int by = 0; by < 4; by++) {
         for (int bx = 0; bx < 4; bx++) {
@@ -42,10 +44,36 @@ bool grid_check_collision(const TetrisBlock *block) {
     return false;
 }
 
+int grid_drop_distance(const TetrisBlock *block, int max_rows) {
+    // Swept query: per block column, scan down from its lowest active cell to the
+    // first obstacle. The minimum over all columns is the free fall distance.
+    int distance = max_rows;
+    for (int bx = 0; bx < 4; bx++) {
+        int lowest = -1;
+        for (int by = 3; by >= 0; by--) {
+            if (block->shape[by][bx]) { lowest = by; break; }
+        }
+        if (lowest < 0) continue;  // Empty column of the shape
+
+        int gx = block->x + bx;
+        if (gx < 0 || gx >= GRID_WIDTH) return 0;  // Outside walls: cannot move at all
+
+        int free_rows = 0;
+        for (int gy = block->y + lowest + 1; free_rows < distance; gy++) {
+            if (gy >= GRID_HEIGHT) break;  // Bottom
+            if (gy >= 0 && grid[gy][gx] != 0) break;  // Placed block
+            free_rows++;
+        }
+        if (free_rows < distance) distance = free_rows;
+        if (distance == 0) break;
+    }
+    return distance;
+}
+
 void grid_fix_block(const TetrisBlock *block) {
     // SEMAPHOR-SCHUTZ: LED-Strip vor gleichzeitigem Zugriff schützen
     if (xSemaphoreTake(led_strip_semaphore, pdMS_TO_TICKS(50)) != pdTRUE) {
-        printf("[Grid] ERROR: LED semaphore timeout in grid_fix_block\n");
+        BLOG(LOG_GRID_SEM_TIMEOUT);
         return;  // Timeout - vermeide Deadlock
     }
     
@@ -56,84 +84,45 @@ void grid_fix_block(const TetrisBlock *block) {
                 int gy = block->y + by;
                 if (gx >= 0 && gx < GRID_WIDTH && gy >= 0 && gy < GRID_HEIGHT) {
                     grid[gy][gx] = block->color + 1;  // Farbe speichern
-                    // Write static pixel immediately so it remains lit
-                    uint8_t r,g,b;
-                    get_block_rgb(block->color, &r, &g, &b);
-                    r = (r * GAME_BRIGHTNESS_SCALE) / 255;
-                    g = (g * GAME_BRIGHTNESS_SCALE) / 255;
-                    b = (b * GAME_BRIGHTNESS_SCALE) / 255;
-                    int led_num = ledMatrix.LED_Number[gy][gx];
-                    led_strip_set_pixel(led_strip, led_num, r, g, b);
+                    compositor_set_block(LAYER_LOCKED, gy, gx, block->color);
                 }
             }
         }
     }
     // Commit static pixels now
-    led_strip_refresh(led_strip);
+    compositor_commit();
+    compositor_present();
     
     xSemaphoreGive(led_strip_semaphore);  // Gib Semaphor frei
-    
-    // Score-Update separat schützen
-    grid_clear_full_rows();
 }
 
-void grid_clear_full_rows(void) {
-    // Collect all full rows first
-    int remove_rows[GRID_HEIGHT];
-    int remove_count = 0;
+int grid_find_full_rows(int rows_out[GRID_HEIGHT]) {
+    int count = 0;
     for (int y = 0; y < GRID_HEIGHT; y++) {
         bool full = true;
         for (int x = 0; x < GRID_WIDTH; x++) {
             if (grid[y][x] == 0) { full = false; break; }
         }
         if (full) {
-            remove_rows[remove_count++] = y;
+            rows_out[count++] = y;
         }
     }
+    return count;
+}
 
-    if (remove_count == 0) return;
+void grid_collapse_rows(const int *rows, int count) {
+    if (count == 0) return;
 
     // SEMAPHOR-SCHUTZ: LED-Strip für alle Operationen schützen
     if (xSemaphoreTake(led_strip_semaphore, pdMS_TO_TICKS(50)) != pdTRUE) {
-        printf("[Grid] ERROR: LED semaphore timeout in grid_clear_full_rows\n");
+        BLOG(LOG_GRID_COLLAPSE_SEM_TIMEOUT);
         return;  // Timeout - vermeide Deadlock
     }
 
-    // Blink all to-be-removed rows simultaneously
-    for (int blink = 0; blink < LINE_CLEAR_BLINK_TIMES; blink++) {
-        // On: set all removed-row pixels to configured color
-        for (int r = 0; r < remove_count; r++) {
-            int y = remove_rows[r];
-            for (int x = 0; x < GRID_WIDTH; x++) {
-                int led = ledMatrix.LED_Number[y][x];
-                led_strip_set_pixel(led_strip, led, LINE_CLEAR_BLINK_R, LINE_CLEAR_BLINK_G, LINE_CLEAR_BLINK_B);
-            }
-        }
-        led_strip_refresh(led_strip);
-        vTaskDelay(pdMS_TO_TICKS(LINE_CLEAR_BLINK_ON_MS));
-
-        // Off: restore static pixels for those positions based on grid
-        for (int r = 0; r < remove_count; r++) {
-            int y = remove_rows[r];
-            for (int x = 0; x < GRID_WIDTH; x++) {
-                int led = ledMatrix.LED_Number[y][x];
-                // currently still grid[y][x] is non-zero, but we will clear after animation
-                uint8_t rr,gg,bb;
-                get_block_rgb(grid[y][x]-1, &rr, &gg, &bb);
-                rr = (rr * GAME_BRIGHTNESS_SCALE) / 255;
-                gg = (gg * GAME_BRIGHTNESS_SCALE) / 255;
-                bb = (bb * GAME_BRIGHTNESS_SCALE) / 255;
-                led_strip_set_pixel(led_strip, led, rr, gg, bb);
-            }
-        }
-        led_strip_refresh(led_strip);
-        vTaskDelay(pdMS_TO_TICKS(LINE_CLEAR_BLINK_OFF_MS));
-    }
-
     // Now remove rows: clear those rows and apply gravity so that all blocks above fall down
     // Step 1: clear removed rows
-    for (int r = 0; r < remove_count; r++) {
-        int y = remove_rows[r];
+    for (int r = 0; r < count; r++) {
+        int y = rows[r];
         for (int x = 0; x < GRID_WIDTH; x++) grid[y][x] = 0;
     }
 
@@ -152,39 +141,35 @@ void grid_clear_full_rows(void) {
         for (int y = write_y; y >= 0; y--) grid[y][x] = 0;
     }
 
-    // Render final grid after gravity so user sees blocks settled (no holes)
-    led_strip_clear(led_strip);
+    // Render final grid after gravity so user sees blocks settled (no holes).
+    // Only cells whose content changed end up dirty in the locked layer.
     for (int yy = 0; yy < GRID_HEIGHT; yy++) {
         for (int x = 0; x < GRID_WIDTH; x++) {
             if (grid[yy][x] > 0) {
-                uint8_t rr,gg,bb;
-                get_block_rgb(grid[yy][x]-1, &rr, &gg, &bb);
-                rr = (rr * GAME_BRIGHTNESS_SCALE) / 255;
-                gg = (gg * GAME_BRIGHTNESS_SCALE) / 255;
-                bb = (bb * GAME_BRIGHTNESS_SCALE) / 255;
-                int led = ledMatrix.LED_Number[yy][x];
-                led_strip_set_pixel(led_strip, led, rr, gg, bb);
+                compositor_set_block(LAYER_LOCKED, yy, x, grid[yy][x] - 1);
+            } else {
+                compositor_clear(LAYER_LOCKED, yy, x);
             }
         }
     }
-    led_strip_refresh(led_strip);
+    compositor_clear_layer(LAYER_OVERLAY);  // Blink may have been skipped in the "on" phase
+    compositor_commit();
+    compositor_present();
     
     xSemaphoreGive(led_strip_semaphore);  // Gib LED-Semaphor frei
-    
-    vTaskDelay(pdMS_TO_TICKS(100));
 
     // Score and speed update: add points based on number of lines cleared simultaneously
     // SEMAPHOR-SCHUTZ: Score und Speed mit Semaphoren schützen
     if (xSemaphoreTake(score_semaphore, pdMS_TO_TICKS(100)) == pdTRUE) {
-        printf("[Grid] Cleared %d lines!\n", remove_count);
-        score_add_lines(remove_count);
+        BLOG(LOG_GRID_LINES_CLEARED, count);
+        score_add_lines(count);
         xSemaphoreGive(score_semaphore);
     } else {
-        printf("[Grid] ERROR: Score semaphore timeout\n");
+        BLOG(LOG_GRID_SCORE_TIMEOUT);
     }
     
     speed_manager_update_score(score_get_total_lines_cleared());
-    display_update_score(score_get(), score_get_highscore());
+    // OLED-Score aktualisiert der GameLoop (kann bei Frame-Überläufen gedrosselt werden)
 }
 
 void grid_print(void) {
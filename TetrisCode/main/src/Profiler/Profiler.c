@@ -0,0 +1,170 @@
+/**
+ * @file Profiler.c
+ * @brief Laufzeit-Histogramme pro Stufe der GameLoop-Iteration
+ *
+ * Bisher war nicht sichtbar, wofür eine Iteration von game_loop_task ihre
+ * Zeit braucht. PROFILE_SCOPE(stage) misst mit dem Zyklenzähler bis zum
+ * Blockende und trägt die Dauer in ein festes Histogramm ein:
+ *
+ * - Bucket-Index aus der höchsten gesetzten Bitposition + 2 Folgebits
+ *   (4 Buckets pro Zweierpotenz, deckt 1 Tick bis 2^32 Ticks ab)
+ * - min/max/Summe exakt, Perzentile auf die Bucket-Obergrenze gerundet
+ * - Keine Allokation, kein Lock: nur der GameLoop-Task schreibt
+ *
+ * Auswertung: Die Konsole fordert einen Snapshot an, der GameLoop kopiert
+ * die Histogramme am Ende der laufenden Iteration (ein memcpy), gedruckt
+ * wird im Konsolen-Task → die Frame-Kadenz bleibt unberührt.
+ */
+
+#include "Profiler.h"
+#include <stdio.h>
+#include <string.h>
+
+// ============================================================================
+// PRIVATE VARIABLEN
+// ============================================================================
+
+/** @brief Laufende Histogramme (nur GameLoop-Task) */
+static profile_hist_t s_hist[PROFILE_STAGE_COUNT];
+
+/** @brief Kopie für die Ausgabe (wird bei Anforderung am Iterationsende geschrieben) */
+static profile_hist_t s_snapshot[PROFILE_STAGE_COUNT];
+
+static volatile bool s_snapshot_requested = false;
+static volatile bool s_snapshot_ready = false;
+static volatile bool s_reset_requested = false;
+
+static const char *const s_stage_names[PROFILE_STAGE_COUNT] = {
+    [PROFILE_STAGE_FRAME] = "frame",
+    [PROFILE_STAGE_INPUT] = "input",
+    [PROFILE_STAGE_COLLISION] = "collision",
+    [PROFILE_STAGE_SPAWN] = "spawn",
+    [PROFILE_STAGE_RENDER] = "render",
+    [PROFILE_STAGE_REFRESH] = "refresh",
+    [PROFILE_STAGE_HUD] = "hud",
+};
+
+// ============================================================================
+// HISTOGRAMM
+// ============================================================================
+
+/**
+ * @brief Bucket-Index: 0..3 direkt, darüber 4 Buckets pro Zweierpotenz
+ */
+static int profile_bucket(uint32_t ticks) {
+    if (ticks < 4) return (int)ticks;
+    int msb = 31 - __builtin_clz(ticks);
+    int sub = (int)((ticks >> (msb - 2)) & 3);
+    return (msb - 1) * 4 + sub;
+}
+
+/**
+ * @brief Größter Wert, der noch in Bucket b fällt
+ */
+static uint32_t profile_bucket_upper(int b) {
+    if (b < 4) return (uint32_t)b;
+    int msb = b / 4 + 1;
+    uint32_t width = 1u << (msb - 2);
+    uint32_t lower = (uint32_t)(4 + b % 4) << (msb - 2);
+    return lower + (width - 1);
+}
+
+void profile_hist_reset(profile_hist_t *h) {
+    memset(h, 0, sizeof(*h));
+    h->min_ticks = UINT32_MAX;
+}
+
+void profile_hist_add(profile_hist_t *h, uint32_t ticks) {
+    h->buckets[profile_bucket(ticks)]++;
+    h->count++;
+    h->sum_ticks += ticks;
+    if (h->count == 1 || ticks < h->min_ticks) h->min_ticks = ticks;
+    if (ticks > h->max_ticks) h->max_ticks = ticks;
+}
+
+uint32_t profile_hist_percentile(const profile_hist_t *h, uint32_t permille) {
+    if (h->count == 0) return 0;
+    if (permille > 1000) permille = 1000;
+
+    uint64_t rank = ((uint64_t)h->count * permille + 999) / 1000;
+    if (rank == 0) rank = 1;
+
+    uint64_t seen = 0;
+    for (int b = 0; b < PROFILE_BUCKET_COUNT; b++) {
+        seen += h->buckets[b];
+        if (seen >= rank) {
+            uint32_t upper = profile_bucket_upper(b);
+            return (upper < h->max_ticks) ? upper : h->max_ticks;
+        }
+    }
+    return h->max_ticks;
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+void profiler_record(profile_stage_t stage, uint32_t ticks) {
+    if ((unsigned)stage >= PROFILE_STAGE_COUNT) return;
+    profile_hist_add(&s_hist[stage], ticks);
+}
+
+void profiler_frame_end(void) {
+    if (s_reset_requested) {
+        for (int i = 0; i < PROFILE_STAGE_COUNT; i++) {
+            profile_hist_reset(&s_hist[i]);
+        }
+        s_reset_requested = false;
+    }
+
+    if (s_snapshot_requested && !s_snapshot_ready) {
+        memcpy(s_snapshot, s_hist, sizeof(s_snapshot));
+        s_snapshot_requested = false;
+        s_snapshot_ready = true;
+    }
+}
+
+void profiler_request_snapshot(void) {
+    s_snapshot_ready = false;
+    s_snapshot_requested = true;
+}
+
+bool profiler_snapshot_ready(void) {
+    return s_snapshot_ready;
+}
+
+void profiler_request_reset(void) {
+    s_reset_requested = true;
+}
+
+/**
+ * @brief Gibt den Snapshot aus (µs mit zwei Nachkommastellen)
+ */
+void profiler_print_snapshot(void) {
+    if (!s_snapshot_ready) {
+        printf("[Profiler] No snapshot available\n");
+        return;
+    }
+
+    printf("[Profiler] stage times in us (%d ticks/us)\n", PROFILE_TICKS_PER_US);
+    printf("[Profiler] %-9s %8s %9s %9s %9s %9s\n", "stage", "n", "min", "mean", "p99", "max");
+
+    for (int i = 0; i < PROFILE_STAGE_COUNT; i++) {
+        const profile_hist_t *h = &s_snapshot[i];
+        if (h->count == 0) {
+            printf("[Profiler] %-9s %8s\n", s_stage_names[i], "-");
+            continue;
+        }
+
+        // Hundertstel-µs, damit auch kurze Stufen (Kollision) lesbar bleiben
+        uint64_t min_cus = (uint64_t)h->min_ticks * 100 / PROFILE_TICKS_PER_US;
+        uint64_t mean_cus = h->sum_ticks * 100 / h->count / PROFILE_TICKS_PER_US;
+        uint64_t p99_cus = (uint64_t)profile_hist_percentile(h, 990) * 100 / PROFILE_TICKS_PER_US;
+        uint64_t max_cus = (uint64_t)h->max_ticks * 100 / PROFILE_TICKS_PER_US;
+
+        printf("[Profiler] %-9s %8lu %6llu.%02llu %6llu.%02llu %6llu.%02llu %6llu.%02llu\n",
+               s_stage_names[i], (unsigned long)h->count,
+               min_cus / 100, min_cus % 100, mean_cus / 100, mean_cus % 100,
+               p99_cus / 100, p99_cus % 100, max_cus / 100, max_cus % 100);
+    }
+}
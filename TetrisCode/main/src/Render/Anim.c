@@ -0,0 +1,292 @@
+/**
+ * @file Anim.c
+ * @brief Nicht-blockierende Sprite/Keyframe-Animationen über den Compositor
+ *
+ * Pro Zeichenschritt wird der aktuelle (beim Überblenden auch der
+ * vorherige) Keyframe in einen Matrix-großen Indexpuffer dekodiert. Eine
+ * Schleife über die Vereinigung mit der zuletzt belegten Fläche setzt oder
+ * löscht die Pixel der Ebene; unveränderte Werte verwirft der Compositor.
+ * Ein Player besitzt seine Fläche in der Ebene: Player in derselben Ebene
+ * dürfen sich nicht überlappen.
+ */
+
+#include "Anim.h"
+#include "Globals.h"
+#include <string.h>
+
+/** @brief Palettenindex je Matrix-Pixel: aktueller bzw. vorheriger Keyframe */
+static uint8_t s_cur[COMPOSITOR_PIXELS];
+static uint8_t s_prev[COMPOSITOR_PIXELS];
+
+#define ANIM_WEIGHT_ONE     256
+#define ANIM_BLEND_STEP_US  ((int64_t)RENDER_INTERVAL_MS * 1000)
+
+/** @brief Rechteck [y0,y1) x [x0,x1), leer wenn y0 >= y1 oder x0 >= x1 */
+typedef struct {
+    int y0, x0, y1, x1;
+} anim_rect_t;
+
+// ============================================================================
+// HELFER
+// ============================================================================
+
+static inline int64_t key_hold_us(const anim_key_t *k) {
+    return (int64_t)(k->hold_ms ? k->hold_ms : 1) * 1000;
+}
+
+static inline int tween(int a, int b, int64_t e, int64_t d) {
+    return a + (int)((b - a) * e / d);
+}
+
+static inline bool rect_empty(const anim_rect_t *r) {
+    return r->y0 >= r->y1 || r->x0 >= r->x1;
+}
+
+static void rect_union(anim_rect_t *r, const anim_rect_t *o) {
+    if (rect_empty(o)) return;
+    if (rect_empty(r)) {
+        *r = *o;
+        return;
+    }
+    if (o->y0 < r->y0) r->y0 = o->y0;
+    if (o->x0 < r->x0) r->x0 = o->x0;
+    if (o->y1 > r->y1) r->y1 = o->y1;
+    if (o->x1 > r->x1) r->x1 = o->x1;
+}
+
+/**
+ * @brief Sprite an (oy, ox) in einen Indexpuffer dekodieren (am Matrix-Rand abgeschnitten)
+ * @return Belegtes Rechteck in der Matrix
+ */
+static anim_rect_t decode(const anim_sprite_t *s, int oy, int ox, uint8_t *idx) {
+    anim_rect_t box = { 0, 0, 0, 0 };
+    memset(idx, 0, COMPOSITOR_PIXELS);
+    if (s == NULL || s->w == 0) return box;
+
+    box.y0 = oy < 0 ? 0 : oy;
+    box.x0 = ox < 0 ? 0 : ox;
+    box.y1 = oy + s->h < LED_HEIGHT ? oy + s->h : LED_HEIGHT;
+    box.x1 = ox + s->w < LED_WIDTH ? ox + s->w : LED_WIDTH;
+    if (rect_empty(&box)) return (anim_rect_t){ 0, 0, 0, 0 };
+
+    int sy = 0, sx = 0;
+    for (uint16_t r = 0; r < s->rle_len && sy < s->h; r++) {
+        int n = (s->rle[r] >> 3) + 1;
+        uint8_t c = s->rle[r] & 7;
+
+        if (c == 0) {
+            // Transparente Läufe nur überspringen
+            int p = sx + n;
+            sy += p / s->w;
+            sx = p % s->w;
+            continue;
+        }
+        while (n-- > 0 && sy < s->h) {
+            int y = oy + sy;
+            int x = ox + sx;
+            if (y >= 0 && y < LED_HEIGHT && x >= 0 && x < LED_WIDTH) {
+                idx[y * LED_WIDTH + x] = c;
+            }
+            if (++sx == s->w) {
+                sx = 0;
+                sy++;
+            }
+        }
+    }
+    return box;
+}
+
+static inline pixel_rgb_t palette_color(const anim_key_t *k, uint8_t c) {
+    if (c == 0 || k == NULL || k->sprite == NULL) return (pixel_rgb_t){ 0, 0, 0 };
+    return k->sprite->palette[c - 1];
+}
+
+static inline uint8_t lerp8(uint8_t a, uint8_t b, uint16_t w) {
+    return (uint8_t)((a * (ANIM_WEIGHT_ONE - w) + b * w) >> 8);
+}
+
+// ============================================================================
+// ZEICHNEN
+// ============================================================================
+
+static bool anim_erase(anim_player_t *p) {
+    if (!p->drawn) return false;
+
+    for (int y = p->fy0; y < p->fy1; y++) {
+        for (int x = p->fx0; x < p->fx1; x++) {
+            compositor_clear(p->layer, y, x);
+        }
+    }
+    p->drawn = false;
+    p->fy0 = p->fx0 = p->fy1 = p->fx1 = 0;
+    return true;
+}
+
+/**
+ * @brief Keyframe key nach e µs zeichnen (nur wenn sich der sichtbare Zustand ändert)
+ */
+static bool anim_draw(anim_player_t *p, uint8_t key, int64_t e) {
+    const anim_clip_t *clip = p->clip;
+    const anim_key_t *k = &clip->keys[key];
+    int64_t hold = key_hold_us(k);
+    if (e < 0) e = 0;
+    if (e > hold) e = hold;
+
+    int y = p->oy + tween(k->y0, k->y1, e, hold);
+    int x = p->ox + tween(k->x0, k->x1, e, hold);
+    uint16_t weight = ANIM_WEIGHT_ONE;
+    int64_t blend = (int64_t)k->blend_ms * 1000;
+    if (e < blend) {
+        // Gewicht nur im Render-Takt ab Keyframe-Start ändern, passend zu anim_next_us()
+        int64_t eq = e - e % ANIM_BLEND_STEP_US;
+        weight = (uint16_t)(eq * ANIM_WEIGHT_ONE / blend);
+    }
+
+    if (p->drawn && p->last_key == key && p->last_y == y && p->last_x == x &&
+        p->last_weight == weight) {
+        return false;
+    }
+
+    anim_rect_t footprint = decode(k->sprite, y, x, s_cur);
+
+    // Vorheriger Keyframe (im ersten Durchlauf vor Keyframe 0: keiner → von schwarz)
+    const anim_key_t *pk = NULL;
+    if (weight < ANIM_WEIGHT_ONE) {
+        if (key > 0) {
+            pk = &clip->keys[key - 1];
+        } else if (p->loop > 0) {
+            pk = &clip->keys[clip->key_count - 1];
+        }
+        anim_rect_t prev = decode(pk ? pk->sprite : NULL, p->oy + (pk ? pk->y1 : 0),
+                                  p->ox + (pk ? pk->x1 : 0), s_prev);
+        rect_union(&footprint, &prev);
+    }
+
+    // Alte Fläche mitnehmen: dort nicht mehr belegte Pixel freigeben
+    anim_rect_t area = { p->fy0, p->fx0, p->fy1, p->fx1 };
+    if (!p->drawn) area = (anim_rect_t){ 0, 0, 0, 0 };
+    rect_union(&area, &footprint);
+
+    for (int yy = area.y0; yy < area.y1; yy++) {
+        for (int xx = area.x0; xx < area.x1; xx++) {
+            int i = yy * LED_WIDTH + xx;
+            uint8_t ci = s_cur[i];
+
+            if (weight == ANIM_WEIGHT_ONE) {
+                if (ci) {
+                    pixel_rgb_t c = palette_color(k, ci);
+                    compositor_set(p->layer, yy, xx, c.r, c.g, c.b);
+                } else {
+                    compositor_clear(p->layer, yy, xx);
+                }
+                continue;
+            }
+
+            uint8_t pi = s_prev[i];
+            if (!ci && !pi) {
+                compositor_clear(p->layer, yy, xx);
+                continue;
+            }
+            pixel_rgb_t a = palette_color(pk, pi);
+            pixel_rgb_t b = palette_color(k, ci);
+            compositor_set(p->layer, yy, xx, lerp8(a.r, b.r, weight), lerp8(a.g, b.g, weight),
+                           lerp8(a.b, b.b, weight));
+        }
+    }
+
+    p->drawn = true;
+    p->last_key = key;
+    p->last_y = (int16_t)y;
+    p->last_x = (int16_t)x;
+    p->last_weight = weight;
+    p->fy0 = (int8_t)footprint.y0;
+    p->fx0 = (int8_t)footprint.x0;
+    p->fy1 = (int8_t)footprint.y1;
+    p->fx1 = (int8_t)footprint.x1;
+    return true;
+}
+
+// ============================================================================
+// PLAYER
+// ============================================================================
+
+void anim_start(anim_player_t *p, const anim_clip_t *clip, layer_id_t layer, int y, int x,
+                int64_t now_us) {
+    anim_erase(p);  // Reste eines vorherigen Clips
+    memset(p, 0, sizeof(*p));
+    p->clip = clip;
+    p->layer = layer;
+    p->oy = (int16_t)y;
+    p->ox = (int16_t)x;
+    p->key_start_us = now_us;
+    p->now_us = now_us;
+    p->running = clip != NULL && clip->key_count > 0;
+}
+
+void anim_stop(anim_player_t *p) {
+    p->running = false;
+    anim_erase(p);
+}
+
+bool anim_running(const anim_player_t *p) {
+    return p->running;
+}
+
+bool anim_advance(anim_player_t *p, int64_t now_us) {
+    if (!p->running) return false;
+    const anim_clip_t *clip = p->clip;
+    p->now_us = now_us;
+
+    // Abgelaufene Keyframes überspringen (auch mehrere nach einer Verzögerung)
+    while (now_us - p->key_start_us >= key_hold_us(&clip->keys[p->key])) {
+        int64_t hold = key_hold_us(&clip->keys[p->key]);
+        if (p->key + 1 < clip->key_count) {
+            p->key_start_us += hold;
+            p->key++;
+            continue;
+        }
+        if (clip->loops && p->loop + 1 >= clip->loops) {
+            p->running = false;
+            // Endzustand des letzten Keyframes stehen lassen oder Fläche freigeben
+            return clip->hold_last ? anim_draw(p, p->key, hold) : anim_erase(p);
+        }
+        p->key_start_us += hold;
+        p->key = 0;
+        p->loop++;
+    }
+
+    return anim_draw(p, p->key, now_us - p->key_start_us);
+}
+
+/**
+ * @brief Relativer Zeitpunkt, an dem eine Bewegung um d Zellen die nächste Zelle erreicht
+ */
+static int64_t next_cell_us(int d, int64_t e, int64_t hold) {
+    if (d == 0) return INT64_MAX;
+    if (d < 0) d = -d;
+    int64_t step = d * e / hold;
+    return ((step + 1) * hold + d - 1) / d;
+}
+
+int64_t anim_next_us(const anim_player_t *p) {
+    if (!p->running) return INT64_MAX;
+
+    const anim_key_t *k = &p->clip->keys[p->key];
+    int64_t hold = key_hold_us(k);
+    int64_t e = p->now_us - p->key_start_us;
+    if (e < 0) e = 0;
+
+    int64_t next = hold;  // Keyframe-Ende
+    int64_t blend = (int64_t)k->blend_ms * 1000;
+    if (e < blend) {
+        int64_t step = (e / ANIM_BLEND_STEP_US + 1) * ANIM_BLEND_STEP_US;
+        if (step > blend) step = blend;
+        if (step < next) next = step;
+    }
+    int64_t cell = next_cell_us(k->y1 - k->y0, e, hold);
+    if (cell < next) next = cell;
+    cell = next_cell_us(k->x1 - k->x0, e, hold);
+    if (cell < next) next = cell;
+
+    return p->key_start_us + next;
+}
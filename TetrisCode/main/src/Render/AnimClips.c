@@ -0,0 +1,71 @@
+/**
+ * @file AnimClips.c
+ * @brief Line-Clear Blinken und Game Over Blinken als Animationsdaten
+ *
+ * Ersetzt die handgeschriebenen Blink-Schritte (Grid.c, GameLoop). Farben
+ * und Zeiten kommen weiter aus Globals.h. Lauftext: TextScroll.c.
+ */
+
+#include "AnimClips.h"
+#include "Globals.h"
+
+// ============================================================================
+// LINE CLEAR
+// ============================================================================
+
+_Static_assert(LED_WIDTH <= ANIM_RUN_MAX, "one run per row");
+
+static const pixel_rgb_t s_line_clear_palette[] = {
+    { LINE_CLEAR_BLINK_R, LINE_CLEAR_BLINK_G, LINE_CLEAR_BLINK_B },
+};
+
+static const uint8_t s_row_rle[] = { ANIM_RUN(LED_WIDTH, 1) };
+
+static const anim_sprite_t s_line_clear_row = {
+    LED_WIDTH, 1, s_row_rle, sizeof(s_row_rle), s_line_clear_palette,
+};
+
+static const anim_key_t s_line_clear_keys[] = {
+    { .sprite = &s_line_clear_row, .hold_ms = LINE_CLEAR_BLINK_ON_MS },
+    // Aus: die (noch nicht entfernten) fixierten Blöcke scheinen durch
+    { .sprite = NULL,              .hold_ms = LINE_CLEAR_BLINK_OFF_MS },
+};
+
+const anim_clip_t anim_clip_line_clear = {
+    s_line_clear_keys, 2, LINE_CLEAR_BLINK_TIMES, false,
+};
+
+// ============================================================================
+// GAME OVER
+// ============================================================================
+
+#define FULL_RUN ANIM_RUN(ANIM_RUN_MAX, 1)
+
+static const uint8_t s_full_rle[] = {
+    FULL_RUN, FULL_RUN, FULL_RUN, FULL_RUN, FULL_RUN, FULL_RUN,
+    FULL_RUN, FULL_RUN, FULL_RUN, FULL_RUN, FULL_RUN, FULL_RUN,
+};
+_Static_assert(sizeof(s_full_rle) * ANIM_RUN_MAX == COMPOSITOR_PIXELS, "whole matrix");
+
+static const pixel_rgb_t s_game_over_palette[] = {
+    { GAME_OVER_BLINK_R, GAME_OVER_BLINK_G, GAME_OVER_BLINK_B },
+};
+static const pixel_rgb_t s_black_palette[] = { { 0, 0, 0 } };
+
+static const anim_sprite_t s_game_over_on = {
+    LED_WIDTH, LED_HEIGHT, s_full_rle, sizeof(s_full_rle), s_game_over_palette,
+};
+// Schwarz deckt das Spielfeld ab (nicht transparent)
+static const anim_sprite_t s_game_over_off = {
+    LED_WIDTH, LED_HEIGHT, s_full_rle, sizeof(s_full_rle), s_black_palette,
+};
+
+static const anim_key_t s_game_over_keys[] = {
+    { .sprite = &s_game_over_on,  .hold_ms = GAME_OVER_BLINK_ON_MS,  .blend_ms = GAME_OVER_BLINK_FADE_MS },
+    { .sprite = &s_game_over_off, .hold_ms = GAME_OVER_BLINK_OFF_MS, .blend_ms = GAME_OVER_BLINK_FADE_MS },
+};
+
+// Schwarz bleibt stehen, bis WAIT den Splash zeichnet
+const anim_clip_t anim_clip_game_over = {
+    s_game_over_keys, 2, GAME_OVER_BLINK_COUNT, true,
+};
@@ -0,0 +1,301 @@
+/**
+ * @file Compositor.c
+ * @brief Ebenen-Compositor mit 384-Bit Dirty-Masken pro Ebene
+ *
+ * Ersetzt das verstreute Neuzeichnen (Splash-Design, Lauftext, Restore der
+ * dynamischen Pixel, direktes Schreiben fixierter Blöcke): alle Stellen
+ * ändern nur noch ihre Ebene. Pixel-Index = y * LED_WIDTH + x, Bit i liegt
+ * in Wort i / 32.
+ *
+ * Mit CONFIG_TETRIS_POSTPROCESS sind Ebenen-Farben Design-Werte (0..255);
+ * der zusammengesetzte Frame läuft komplett durch PostProcess.c (Gamma,
+ * Helligkeit, Dithering) und erst dessen Ausgabe wird mit dem Cache
+ * verglichen. Ohne: Blockfarben wie bisher über BRIGHTNESSDIV und
+ * GAME_BRIGHTNESS_SCALE, die Ebenen-Farbe geht direkt an den Strip.
+ *
+ * Mit CONFIG_TETRIS_CURRENT_LIMIT ist s_out der ungeskalierte Wunschwert:
+ * geänderte Pixel korrigieren die Kanalsumme in PowerLimit.c und werden
+ * vorgemerkt; erst am Frame-Ende steht der Faktor fest. Bleibt er gleich,
+ * gehen nur die vorgemerkten Pixel an den Strip, sonst alle.
+ *
+ * Der Strip ist nicht mehr direkt angebunden: geschriebene Pixel landen in
+ * s_present mit Bit in s_changed; compositor_present() reicht beides an die
+ * Frame-Senken (FrameSink.c) und löscht die Maske. Ein ausgelassener Refresh
+ * sammelt so seine Änderungen für den nächsten.
+ */
+
+#include "Compositor.h"
+#include "Blocks.h"
+#include "PostProcess.h"
+#include "PowerLimit.h"
+#include "SubCell.h"
+#include "FrameSink.h"
+#include "sdkconfig.h"
+#include <string.h>
+
+typedef struct {
+    pixel_rgb_t px[COMPOSITOR_PIXELS];
+    uint32_t opaque[COMPOSITOR_MASK_WORDS];
+    uint32_t dirty[COMPOSITOR_MASK_WORDS];
+} layer_t;
+
+static layer_t s_layers[LAYER_COUNT];
+
+/** @brief Zuletzt geschriebene Farben (mit CONFIG_TETRIS_CURRENT_LIMIT ungeskaliert) */
+static pixel_rgb_t s_out[COMPOSITOR_PIXELS];
+
+/** @brief Frame für die Senken und seit dem letzten present geänderte Pixel */
+static pixel_rgb_t s_present[COMPOSITOR_PIXELS];
+static uint32_t s_changed[COMPOSITOR_MASK_WORDS];
+
+/** @brief Blockfarben (Design-Werte bzw. mit GAME_BRIGHTNESS_SCALE) */
+static pixel_rgb_t s_block_palette[NUM_BLOCKS];
+
+_Static_assert(sizeof(pixel_rgb_t) == 3, "frame is passed to the post kernel / limiter as bytes");
+
+#if CONFIG_TETRIS_CURRENT_LIMIT
+/** @brief Pixel, deren s_out sich in diesem Commit geändert hat */
+static uint32_t s_pending[COMPOSITOR_MASK_WORDS];
+/** @brief Faktor, mit dem der Ausgabe-Frame aktuell geschrieben ist */
+static uint16_t s_power_scale = POWER_SCALE_ONE;
+#endif
+
+#if CONFIG_TETRIS_POSTPROCESS
+
+/** @brief Zusammengesetzter Frame (Design-Werte) und Ausgabe der Nachbearbeitung */
+static pixel_rgb_t s_frame[COMPOSITOR_PIXELS];
+static pixel_rgb_t s_post[COMPOSITOR_PIXELS];
+#endif
+
+// ============================================================================
+// HELFER
+// ============================================================================
+
+static inline bool pixel_index(int y, int x, int *idx) {
+    if (y < 0 || y >= LED_HEIGHT || x < 0 || x >= LED_WIDTH) return false;
+    *idx = y * LED_WIDTH + x;
+    return true;
+}
+
+static inline bool mask_test(const uint32_t *mask, int i) {
+    return (mask[i >> 5] >> (i & 31)) & 1;
+}
+
+static inline void mask_set(uint32_t *mask, int i) {
+    mask[i >> 5] |= 1UL << (i & 31);
+}
+
+static inline void mask_clear(uint32_t *mask, int i) {
+    mask[i >> 5] &= ~(1UL << (i & 31));
+}
+
+// ============================================================================
+// EBENEN
+// ============================================================================
+
+void compositor_init(void) {
+    memset(s_layers, 0, sizeof(s_layers));
+    memset(s_out, 0, sizeof(s_out));
+    memset(s_present, 0, sizeof(s_present));
+    memset(s_changed, 0, sizeof(s_changed));
+#if CONFIG_TETRIS_CURRENT_LIMIT
+    memset(s_pending, 0, sizeof(s_pending));
+    s_power_scale = POWER_SCALE_ONE;
+    power_limit_reset();
+#endif
+
+    for (int i = 0; i < NUM_BLOCKS; i++) {
+        uint8_t r, g, b;
+        get_block_rgb(i, &r, &g, &b);
+#if CONFIG_TETRIS_POSTPROCESS
+        // Helligkeit macht die Nachbearbeitung
+        s_block_palette[i] = (pixel_rgb_t){ r, g, b };
+#else
+        s_block_palette[i].r = (r / BRIGHTNESSDIV * GAME_BRIGHTNESS_SCALE) / 255;
+        s_block_palette[i].g = (g / BRIGHTNESSDIV * GAME_BRIGHTNESS_SCALE) / 255;
+        s_block_palette[i].b = (b / BRIGHTNESSDIV * GAME_BRIGHTNESS_SCALE) / 255;
+#endif
+    }
+
+#if CONFIG_TETRIS_POSTPROCESS
+    memset(s_frame, 0, sizeof(s_frame));
+    post_init(POST_BRIGHTNESS);
+#endif
+#if CONFIG_TETRIS_SUBCELL_RENDER
+    subcell_init();  // Stufenfarben aus der Palette oben
+#endif
+}
+
+void compositor_reset(void) {
+    for (int l = 0; l < LAYER_COUNT; l++) {
+        compositor_clear_layer((layer_id_t)l);
+    }
+}
+
+void compositor_set(layer_id_t layer, int y, int x, uint8_t r, uint8_t g, uint8_t b) {
+    int i;
+    if (!pixel_index(y, x, &i)) return;
+    layer_t *l = &s_layers[layer];
+
+    pixel_rgb_t *p = &l->px[i];
+    if (mask_test(l->opaque, i) && p->r == r && p->g == g && p->b == b) return;  // Unverändert
+
+    p->r = r;
+    p->g = g;
+    p->b = b;
+    mask_set(l->opaque, i);
+    mask_set(l->dirty, i);
+}
+
+const pixel_rgb_t *compositor_block_color(uint8_t block_index) {
+    return &s_block_palette[block_index % NUM_BLOCKS];
+}
+
+void compositor_set_block(layer_id_t layer, int y, int x, uint8_t block_index) {
+    const pixel_rgb_t *c = &s_block_palette[block_index % NUM_BLOCKS];
+    compositor_set(layer, y, x, c->r, c->g, c->b);
+}
+
+void compositor_clear(layer_id_t layer, int y, int x) {
+    int i;
+    if (!pixel_index(y, x, &i)) return;
+    layer_t *l = &s_layers[layer];
+    if (!mask_test(l->opaque, i)) return;
+
+    mask_clear(l->opaque, i);
+    mask_set(l->dirty, i);
+}
+
+void compositor_clear_layer(layer_id_t layer) {
+    layer_t *l = &s_layers[layer];
+    for (int w = 0; w < COMPOSITOR_MASK_WORDS; w++) {
+        l->dirty[w] |= l->opaque[w];
+        l->opaque[w] = 0;
+    }
+}
+
+void compositor_fill_layer(layer_id_t layer, uint8_t r, uint8_t g, uint8_t b) {
+    for (int y = 0; y < LED_HEIGHT; y++) {
+        for (int x = 0; x < LED_WIDTH; x++) {
+            compositor_set(layer, y, x, r, g, b);
+        }
+    }
+}
+
+// ============================================================================
+// COMMIT
+// ============================================================================
+
+static inline void present_write(int i, pixel_rgb_t c) {
+    s_present[i] = c;
+    mask_set(s_changed, i);
+}
+
+static inline void output_pixel(int i, pixel_rgb_t c, int *written) {
+    pixel_rgb_t *out = &s_out[i];
+    if (out->r == c.r && out->g == c.g && out->b == c.b) return;
+
+#if CONFIG_TETRIS_CURRENT_LIMIT
+    power_limit_pixel(&out->r, &c.r);
+    *out = c;
+    mask_set(s_pending, i);
+#else
+    *out = c;
+    present_write(i, c);
+    (*written)++;
+#endif
+}
+
+#if CONFIG_TETRIS_CURRENT_LIMIT
+static inline pixel_rgb_t scaled(pixel_rgb_t c, uint16_t scale) {
+    if (scale == POWER_SCALE_ONE) return c;
+    return (pixel_rgb_t){ power_limit_apply(c.r, scale), power_limit_apply(c.g, scale),
+                          power_limit_apply(c.b, scale) };
+}
+
+/**
+ * @brief Frame-Ende: Faktor bestimmen und vorgemerkte (bzw. bei neuem Faktor alle) Pixel schreiben
+ */
+static void flush_limited(int *written) {
+    uint16_t scale = power_limit_end_frame();
+
+    if (scale != s_power_scale) {
+        s_power_scale = scale;
+        for (int i = 0; i < COMPOSITOR_PIXELS; i++) {
+            present_write(i, scaled(s_out[i], scale));
+        }
+        memset(s_pending, 0, sizeof(s_pending));
+        *written = COMPOSITOR_PIXELS;
+        return;
+    }
+
+    for (int w = 0; w < COMPOSITOR_MASK_WORDS; w++) {
+        uint32_t pending = s_pending[w];
+        s_pending[w] = 0;
+        while (pending) {
+            int i = (w << 5) + __builtin_ctz(pending);
+            pending &= pending - 1;
+            present_write(i, scaled(s_out[i], scale));
+            (*written)++;
+        }
+    }
+}
+#endif
+
+static int compositor_commit_internal(bool dither) {
+    int written = 0;
+
+    for (int w = 0; w < COMPOSITOR_MASK_WORDS; w++) {
+        uint32_t dirty = 0;
+        for (int l = 0; l < LAYER_COUNT; l++) {
+            dirty |= s_layers[l].dirty[w];
+            s_layers[l].dirty[w] = 0;
+        }
+
+        while (dirty) {
+            int i = (w << 5) + __builtin_ctz(dirty);
+            dirty &= dirty - 1;
+
+            // Oberste deckende Ebene gewinnt
+            pixel_rgb_t c = { 0, 0, 0 };
+            for (int l = LAYER_COUNT - 1; l >= 0; l--) {
+                if (mask_test(s_layers[l].opaque, i)) {
+                    c = s_layers[l].px[i];
+                    break;
+                }
+            }
+
+#if CONFIG_TETRIS_POSTPROCESS
+            s_frame[i] = c;
+#else
+            output_pixel(i, c, &written);
+#endif
+        }
+    }
+
+#if CONFIG_TETRIS_POSTPROCESS
+    // Ganzer Frame: Dithering ändert auch Pixel ohne Dirty-Bit
+    post_process_frame((const uint8_t *)s_frame, (uint8_t *)s_post, COMPOSITOR_PIXELS * 3, dither);
+    for (int i = 0; i < COMPOSITOR_PIXELS; i++) {
+        output_pixel(i, s_post[i], &written);
+    }
+#endif
+
+#if CONFIG_TETRIS_CURRENT_LIMIT
+    flush_limited(&written);
+#endif
+    return written;
+}
+
+int compositor_commit(void) {
+    return compositor_commit_internal(false);
+}
+
+int compositor_commit_frame(void) {
+    return compositor_commit_internal(true);
+}
+
+void compositor_present(void) {
+    frame_sink_present_all(s_present, s_changed);
+    memset(s_changed, 0, sizeof(s_changed));
+}
@@ -0,0 +1,71 @@
+/**
+ * @file Font3x5.c
+ * @brief 3x5 Font-Atlas für die LED-Matrix
+ *
+ * Erzeugt von tools/font3x5.py - nicht von Hand ändern.
+ * Drei Spalten-Bytes pro Zeichen, Bit y = Zeile y (oben = Bit 0).
+ */
+
+#include "Font3x5.h"
+
+const uint8_t font3x5_atlas[FONT3X5_COUNT][FONT3X5_W] = {
+    { 0x00, 0x00, 0x00 },  // ' '
+    { 0x00, 0x17, 0x00 },  // '!'
+    { 0x03, 0x00, 0x03 },  // '"'
+    { 0x1F, 0x0A, 0x1F },  // '#'
+    { 0x12, 0x1F, 0x09 },  // '$'
+    { 0x19, 0x04, 0x13 },  // '%'
+    { 0x0A, 0x15, 0x1A },  // '&'
+    { 0x00, 0x03, 0x00 },  // '\''
+    { 0x00, 0x0E, 0x11 },  // '('
+    { 0x11, 0x0E, 0x00 },  // ')'
+    { 0x0A, 0x04, 0x0A },  // '*'
+    { 0x04, 0x0E, 0x04 },  // '+'
+    { 0x10, 0x08, 0x00 },  // ','
+    { 0x04, 0x04, 0x04 },  // '-'
+    { 0x00, 0x10, 0x00 },  // '.'
+    { 0x18, 0x04, 0x03 },  // '/'
+    { 0x1F, 0x11, 0x1F },  // '0'
+    { 0x12, 0x1F, 0x10 },  // '1'
+    { 0x1D, 0x15, 0x17 },  // '2'
+    { 0x15, 0x15, 0x1F },  // '3'
+    { 0x07, 0x04, 0x1F },  // '4'
+    { 0x17, 0x15, 0x1D },  // '5'
+    { 0x1F, 0x15, 0x1D },  // '6'
+    { 0x01, 0x19, 0x07 },  // '7'
+    { 0x1F, 0x15, 0x1F },  // '8'
+    { 0x17, 0x15, 0x1F },  // '9'
+    { 0x00, 0x0A, 0x00 },  // ':'
+    { 0x10, 0x0A, 0x00 },  // ';'
+    { 0x04, 0x0A, 0x11 },  // '<'
+    { 0x0A, 0x0A, 0x0A },  // '='
+    { 0x11, 0x0A, 0x04 },  // '>'
+    { 0x01, 0x15, 0x07 },  // '?'
+    { 0x0E, 0x15, 0x16 },  // '@'
+    { 0x1E, 0x05, 0x1E },  // 'A'
+    { 0x1F, 0x15, 0x0A },  // 'B'
+    { 0x0E, 0x11, 0x11 },  // 'C'
+    { 0x1F, 0x11, 0x0E },  // 'D'
+    { 0x1F, 0x15, 0x15 },  // 'E'
+    { 0x1F, 0x05, 0x05 },  // 'F'
+    { 0x0E, 0x11, 0x1D },  // 'G'
+    { 0x1F, 0x04, 0x1F },  // 'H'
+    { 0x11, 0x1F, 0x11 },  // 'I'
+    { 0x08, 0x10, 0x0F },  // 'J'
+    { 0x1F, 0x04, 0x1B },  // 'K'
+    { 0x1F, 0x10, 0x10 },  // 'L'
+    { 0x1F, 0x06, 0x1F },  // 'M'
+    { 0x1F, 0x01, 0x1E },  // 'N'
+    { 0x0E, 0x11, 0x0E },  // 'O'
+    { 0x1F, 0x05, 0x02 },  // 'P'
+    { 0x0E, 0x19, 0x16 },  // 'Q'
+    { 0x1F, 0x05, 0x1A },  // 'R'
+    { 0x12, 0x15, 0x09 },  // 'S'
+    { 0x01, 0x1F, 0x01 },  // 'T'
+    { 0x1F, 0x10, 0x1F },  // 'U'
+    { 0x0F, 0x10, 0x0F },  // 'V'
+    { 0x1F, 0x0C, 0x1F },  // 'W'
+    { 0x1B, 0x04, 0x1B },  // 'X'
+    { 0x03, 0x1C, 0x03 },  // 'Y'
+    { 0x19, 0x15, 0x13 },  // 'Z'
+};
@@ -0,0 +1,156 @@
+/**
+ * @file PostProcess.c
+ * @brief Gamma-LUT, globale Helligkeit und zeitliches Dithering (SWAR-Kernel)
+ *
+ * Pro Kanal: v = lut[in] + err; out = v >> 8; err = v & 0xFF.
+ * lut[c] ≤ 255 * 256 = 0xFF00, plus err ≤ 0xFF ergibt höchstens 0xFFFF,
+ * daher passen zwei Kanäle ohne Übertrag in ein 32-Bit Wort. Ein
+ * Gather über die Tabelle lässt sich nicht vektorisieren, Addition,
+ * Shift und Maske laufen so für zwei Kanäle gleichzeitig.
+ */
+
+#include "PostProcess.h"
+#include "Globals.h"
+#include "Profiler.h"
+#include <math.h>
+#include <string.h>
+
+/** @brief gamma(c) * brightness, 8.8 Festkomma */
+static uint16_t s_lut[256];
+
+/** @brief Aufsummierter Nachkomma-Anteil pro Kanal (Dithering) */
+static uint8_t s_err[POST_MAX_CHANNELS];
+
+static uint8_t s_brightness = 0;
+static bool s_dither = true;
+static post_stats_t s_stats;
+
+/** @brief Angeforderte Änderungen (Konsole), -1 = keine */
+static volatile int16_t s_brightness_request = -1;
+static volatile int8_t s_dither_request = -1;
+
+// ============================================================================
+// TABELLE
+// ============================================================================
+
+static void post_build_lut(uint8_t brightness) {
+    for (int c = 0; c < 256; c++) {
+        float lin = powf(c / 255.0f, POST_GAMMA);
+        s_lut[c] = (uint16_t)lroundf(lin * brightness * 256.0f);
+    }
+}
+
+void post_init(uint8_t brightness) {
+    memset(s_err, 0, sizeof(s_err));
+    memset(&s_stats, 0, sizeof(s_stats));
+    s_dither = POST_DITHER_DEFAULT;
+    post_set_brightness(brightness);
+}
+
+void post_set_brightness(uint8_t brightness) {
+    s_brightness = brightness;
+    post_build_lut(brightness);
+}
+
+uint8_t post_get_brightness(void) {
+    return s_brightness;
+}
+
+void post_set_dither(bool enabled) {
+    s_dither = enabled;
+}
+
+bool post_get_dither(void) {
+    return s_dither;
+}
+
+void post_request_brightness(uint8_t brightness) {
+    s_brightness_request = brightness;
+}
+
+void post_request_dither(bool enabled) {
+    s_dither_request = enabled ? 1 : 0;
+}
+
+/**
+ * @brief Anforderungen übernehmen (nur im Render-Pfad, die Tabelle wird nie mitten im Frame neu gebaut)
+ */
+static void post_apply_requests(void) {
+    int16_t brightness = s_brightness_request;
+    if (brightness >= 0) {
+        s_brightness_request = -1;
+        post_set_brightness((uint8_t)brightness);
+    }
+    int8_t dither = s_dither_request;
+    if (dither >= 0) {
+        s_dither_request = -1;
+        post_set_dither(dither == 1);
+    }
+}
+
+const uint16_t *post_lut(void) {
+    return s_lut;
+}
+
+// ============================================================================
+// KERNEL
+// ============================================================================
+
+void post_process_reference(const uint16_t *lut, const uint8_t *in, uint8_t *out, uint8_t *err,
+                            size_t n, bool dither) {
+    for (size_t i = 0; i < n; i++) {
+        if (dither) {
+            uint32_t v = lut[in[i]] + err[i];
+            out[i] = (uint8_t)(v >> 8);
+            err[i] = (uint8_t)v;
+        } else {
+            out[i] = (uint8_t)((lut[in[i]] + 0x80) >> 8);
+        }
+    }
+}
+
+static void post_kernel_swar(const uint8_t *in, uint8_t *out, size_t n, bool dither) {
+    if (!dither) {
+        for (size_t i = 0; i < n; i += 2) {
+            uint32_t v = (s_lut[in[i]] | ((uint32_t)s_lut[in[i + 1]] << 16)) + 0x00800080UL;
+            out[i] = (uint8_t)(v >> 8);
+            out[i + 1] = (uint8_t)(v >> 24);
+        }
+        return;
+    }
+
+    for (size_t i = 0; i < n; i += 2) {
+        uint32_t v = (s_lut[in[i]] | ((uint32_t)s_lut[in[i + 1]] << 16)) +
+                     (s_err[i] | ((uint32_t)s_err[i + 1] << 16));
+        out[i] = (uint8_t)(v >> 8);
+        out[i + 1] = (uint8_t)(v >> 24);
+        s_err[i] = (uint8_t)v;
+        s_err[i + 1] = (uint8_t)(v >> 16);
+    }
+}
+
+void post_process_frame(const uint8_t *in, uint8_t *out, size_t n, bool dither) {
+    if (n > POST_MAX_CHANNELS) n = POST_MAX_CHANNELS;
+    post_apply_requests();
+
+    uint32_t start = profiler_now();
+    post_kernel_swar(in, out, n & ~(size_t)1, dither && s_dither);
+    uint32_t ticks = profiler_now() - start;
+
+    s_stats.frames++;
+    s_stats.last_ticks = ticks;
+    if (ticks > s_stats.max_ticks) s_stats.max_ticks = ticks;
+    if (ticks > (uint32_t)POST_BUDGET_US * PROFILE_TICKS_PER_US) s_stats.over_budget++;
+}
+
+// ============================================================================
+// STATISTIK
+// ============================================================================
+
+void post_get_stats(post_stats_t *out) {
+    *out = s_stats;
+}
+
+void post_reset_stats(void) {
+    memset(&s_stats, 0, sizeof(s_stats));
+}
@@ -0,0 +1,68 @@
+/**
+ * @file PowerLimit.c
+ * @brief Inkrementelle Stromschätzung und Frame-Skalierung auf das Budget
+ *
+ * Wird vom Compositor an der einzigen Stelle gefüttert, an der sich ein
+ * Ausgabepixel ändert. Der Faktor wird so gewählt, dass die geschätzten
+ * Kanalströme plus Ruhestrom genau ins Budget passen (abgerundet).
+ */
+
+#include "PowerLimit.h"
+#include "Globals.h"
+#include <string.h>
+
+/** @brief Summe aller Kanalwerte (ungeskaliert), max. 384 * 3 * 255 */
+static uint32_t s_channel_sum = 0;
+
+static power_stats_t s_stats = { .scale = POWER_SCALE_ONE, .min_scale = POWER_SCALE_ONE };
+
+/** @brief Ruhestrom aller LEDs (auch bei Schwarz) */
+#define POWER_IDLE_MA ((uint32_t)LED_STRIP_NUM_LEDS * LED_IDLE_UA_PER_LED / 1000)
+
+void power_limit_reset(void) {
+    s_channel_sum = 0;
+    memset(&s_stats, 0, sizeof(s_stats));
+    s_stats.scale = POWER_SCALE_ONE;
+    s_stats.min_scale = POWER_SCALE_ONE;
+}
+
+void power_limit_pixel(const uint8_t *old_rgb, const uint8_t *new_rgb) {
+    s_channel_sum += (uint32_t)new_rgb[0] + new_rgb[1] + new_rgb[2];
+    s_channel_sum -= (uint32_t)old_rgb[0] + old_rgb[1] + old_rgb[2];
+}
+
+uint32_t power_limit_estimate_ma(uint32_t channel_sum) {
+    return POWER_IDLE_MA + channel_sum * LED_MA_PER_CHANNEL / 255;
+}
+
+uint32_t power_limit_channel_sum(void) {
+    return s_channel_sum;
+}
+
+uint16_t power_limit_end_frame(void) {
+    uint32_t ma = power_limit_estimate_ma(s_channel_sum);
+    uint16_t scale = POWER_SCALE_ONE;
+
+    if (ma > LED_CURRENT_BUDGET_MA && s_channel_sum > 0) {
+        // Verfügbarer Kanalstrom / angeforderter Kanalstrom, in 1/256
+        uint32_t avail_ma = LED_CURRENT_BUDGET_MA > POWER_IDLE_MA ? LED_CURRENT_BUDGET_MA - POWER_IDLE_MA : 0;
+        uint64_t want = (uint64_t)s_channel_sum * LED_MA_PER_CHANNEL;   // mA * 255
+        scale = (uint16_t)((uint64_t)avail_ma * 255 * POWER_SCALE_ONE / want);
+        if (scale > POWER_SCALE_ONE) scale = POWER_SCALE_ONE;
+    }
+
+    s_stats.frames++;
+    s_stats.last_ma = ma;
+    if (ma > s_stats.peak_ma) s_stats.peak_ma = ma;
+    if (scale < POWER_SCALE_ONE) {
+        s_stats.limited_frames++;
+        if (s_stats.scale == POWER_SCALE_ONE) s_stats.limit_events++;
+    }
+    if (scale < s_stats.min_scale) s_stats.min_scale = scale;
+    s_stats.scale = scale;
+    return scale;
+}
+
+void power_limit_get_stats(power_stats_t *out) {
+    *out = s_stats;
+}
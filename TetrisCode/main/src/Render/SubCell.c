@@ -0,0 +1,70 @@
+/**
+ * @file SubCell.c
+ * @brief Geglättete Fallbewegung: Helligkeit über zwei Reihen verteilt
+ *
+ * Pro Frame nur Additionen in einem 5x4 Stufenpuffer und ein Tabellenzugriff
+ * pro Pixel (höchstens 8 Pixel); pow() läuft einmal in subcell_init().
+ */
+
+#include "SubCell.h"
+#include "Globals.h"
+#include "sdkconfig.h"
+#include <math.h>
+#include <string.h>
+
+/** @brief Farbe pro Blockfarbe und Stufe (Stufe SUBCELL_LEVELS = volle Blockfarbe) */
+static pixel_rgb_t s_colors[NUM_BLOCKS][SUBCELL_LEVELS + 1];
+
+// ============================================================================
+// TABELLEN
+// ============================================================================
+
+void subcell_init(void) {
+    for (int q = 0; q <= SUBCELL_LEVELS; q++) {
+        float w = (float)q / SUBCELL_LEVELS;
+#if CONFIG_TETRIS_POSTPROCESS
+        // Design-Werte laufen durch gamma: Anteil im linearen Licht aufteilen
+        w = powf(w, 1.0f / POST_GAMMA);
+#endif
+        uint16_t weight = (uint16_t)lroundf(w * 256.0f);  // 8.8, Stufe SUBCELL_LEVELS = 256
+
+        for (int i = 0; i < NUM_BLOCKS; i++) {
+            const pixel_rgb_t *c = compositor_block_color(i);
+            s_colors[i][q].r = (uint8_t)((c->r * weight + 0x80) >> 8);
+            s_colors[i][q].g = (uint8_t)((c->g * weight + 0x80) >> 8);
+            s_colors[i][q].b = (uint8_t)((c->b * weight + 0x80) >> 8);
+        }
+    }
+}
+
+const pixel_rgb_t *subcell_color(uint8_t block_index, uint8_t level) {
+    if (level > SUBCELL_LEVELS) level = SUBCELL_LEVELS;
+    return &s_colors[block_index % NUM_BLOCKS][level];
+}
+
+// ============================================================================
+// RENDERN
+// ============================================================================
+
+void subcell_render(layer_id_t layer, const TetrisBlock *block, uint16_t frac_q16) {
+    uint8_t q = subcell_level(frac_q16);
+    uint8_t acc[5][4];
+    memset(acc, 0, sizeof(acc));
+
+    for (int by = 0; by < 4; by++) {
+        for (int bx = 0; bx < 4; bx++) {
+            if (!block->shape[by][bx]) continue;
+            acc[by][bx] += SUBCELL_LEVELS - q;
+            acc[by + 1][bx] += q;
+        }
+    }
+
+    for (int by = 0; by < 5; by++) {
+        for (int bx = 0; bx < 4; bx++) {
+            if (acc[by][bx] == 0) continue;
+            // Teile außerhalb des Felds verwirft der Compositor
+            const pixel_rgb_t *c = subcell_color(block->color, acc[by][bx]);
+            compositor_set(layer, block->y + by, block->x + bx, c->r, c->g, c->b);
+        }
+    }
+}
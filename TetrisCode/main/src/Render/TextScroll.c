@@ -0,0 +1,124 @@
+/**
+ * @file TextScroll.c
+ * @brief Lauftext aus vorberechneten Spalten-Bitmaps (3x5 Font)
+ *
+ * Ersetzt splash_generate_text_bitmap() (fester Switch mit fünf Buchstaben,
+ * nur "TETRIS"): beliebige Strings und Zahlen, z.B. Score, Level und
+ * "NEW HIGH" auf der Matrix, wenn kein OLED angeschlossen ist.
+ */
+
+#include "TextScroll.h"
+#include "Globals.h"
+#include <string.h>
+
+// ============================================================================
+// TEXT AUFBAUEN
+// ============================================================================
+
+void text_scroll_init(text_scroll_t *ts, layer_id_t layer, int row, pixel_rgb_t color,
+                      uint16_t step_ms) {
+    memset(ts, 0, sizeof(*ts));
+    ts->layer = layer;
+    ts->row = (int8_t)row;
+    ts->color = color;
+    ts->step_ms = step_ms ? step_ms : 1;
+    ts->last_col = -1;
+}
+
+void text_scroll_clear(text_scroll_t *ts) {
+    ts->width = 0;
+}
+
+static void append_char(text_scroll_t *ts, char c) {
+    if (ts->width + FONT3X5_W + 1 > TEXT_SCROLL_MAX_COLS) return;  // Abschneiden
+
+    const uint8_t *glyph = font3x5_glyph(c);
+    for (int i = 0; i < FONT3X5_W; i++) {
+        ts->cols[ts->width++] = glyph[i];
+    }
+    ts->cols[ts->width++] = 0;  // Abstand
+}
+
+void text_scroll_append(text_scroll_t *ts, const char *text) {
+    for (; *text; text++) {
+        append_char(ts, *text);
+    }
+}
+
+void text_scroll_append_number(text_scroll_t *ts, uint32_t value) {
+    char digits[10];
+    int n = 0;
+    do {
+        digits[n++] = (char)('0' + value % 10);
+        value /= 10;
+    } while (value && n < (int)sizeof(digits));
+
+    while (n > 0) {
+        append_char(ts, digits[--n]);
+    }
+}
+
+void text_scroll_restart(text_scroll_t *ts, int64_t now_us) {
+    ts->start_us = now_us;
+    ts->now_us = now_us;
+    ts->last_col = -1;
+}
+
+void text_scroll_set_text(text_scroll_t *ts, const char *text, int64_t now_us) {
+    text_scroll_clear(ts);
+    text_scroll_append(ts, text);
+    text_scroll_restart(ts, now_us);
+}
+
+// ============================================================================
+// SCROLLEN
+// ============================================================================
+
+static inline int32_t cycle_cols(const text_scroll_t *ts) {
+    return ts->width + LED_WIDTH;
+}
+
+bool text_scroll_advance(text_scroll_t *ts, int64_t now_us) {
+    ts->now_us = now_us;
+    if (ts->width == 0) return false;
+
+    int64_t elapsed = now_us - ts->start_us;
+    if (elapsed < 0) elapsed = 0;
+    int32_t k = (int32_t)((elapsed / ((int64_t)ts->step_ms * 1000)) % cycle_cols(ts));
+    if (k == ts->last_col) return false;
+    ts->last_col = k;
+
+    // Spalte x zeigt Textspalte k - (LED_WIDTH - x): von rechts herein, links hinaus
+    pixel_rgb_t c = ts->color;
+    for (int x = 0; x < LED_WIDTH; x++) {
+        int32_t src = k - (LED_WIDTH - x);
+        uint8_t bits = (src >= 0 && src < ts->width) ? ts->cols[src] : 0;
+
+        for (int y = 0; y < FONT3X5_H; y++) {
+            if (bits & (1u << y)) {
+                compositor_set(ts->layer, ts->row + y, x, c.r, c.g, c.b);
+            } else {
+                compositor_clear(ts->layer, ts->row + y, x);
+            }
+        }
+    }
+    return true;
+}
+
+int64_t text_scroll_next_us(const text_scroll_t *ts) {
+    if (ts->width == 0) return INT64_MAX;
+
+    int64_t step_us = (int64_t)ts->step_ms * 1000;
+    int64_t elapsed = ts->now_us - ts->start_us;
+    if (elapsed < 0) elapsed = 0;
+    return ts->start_us + (elapsed / step_us + 1) * step_us;
+}
+
+void text_scroll_erase(text_scroll_t *ts) {
+    for (int y = 0; y < FONT3X5_H; y++) {
+        for (int x = 0; x < LED_WIDTH; x++) {
+            compositor_clear(ts->layer, ts->row + y, x);
+        }
+    }
+    ts->last_col = -1;
+}
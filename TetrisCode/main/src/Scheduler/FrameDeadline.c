@@ -0,0 +1,86 @@
+/**
+ * @file FrameDeadline.c
+ * @brief Frame-Deadline Monitor mit stufenweisem Abwerfen optionaler Arbeit
+ *
+ * Line-Clear, HUD-Update oder ein blockierter LED-Refresh konnten das 16ms
+ * Frame überziehen, ohne dass es jemand merkte - Input kam einfach später an.
+ * Jetzt wird jede GameLoop-Iteration gegen das Budget gemessen:
+ *
+ * - Überlauf → eine Stufe abwerfen (Blinken, dann HUD-Rate, dann jeder
+ *   zweite LED-Refresh), höchstens alle FRAME_SHED_HOLD_FRAMES Frames,
+ *   damit die letzte Stufe erst wirken kann
+ * - FRAME_RESTORE_FRAMES Frames in Folge mit mindestens
+ *   FRAME_HEADROOM_US Reserve → eine Stufe zurück
+ *
+ * Reine Logik (Host-kompilierbar); Zeiten kommen vom Aufrufer.
+ */
+
+#include "FrameDeadline.h"
+#include "Globals.h"
+#include <string.h>
+
+static const char *const s_level_names[QUALITY_LEVEL_COUNT] = {
+    [QUALITY_FULL] = "full",
+    [QUALITY_SKIP_BLINK] = "skip-blink",
+    [QUALITY_SLOW_HUD] = "slow-hud",
+    [QUALITY_ELIDE_REFRESH] = "elide-refresh",
+};
+
+void frame_deadline_init(frame_deadline_t *fd, int64_t budget_us) {
+    memset(fd, 0, sizeof(*fd));
+    fd->budget_us = budget_us;
+    fd->level = QUALITY_FULL;
+    fd->min_slack_us = INT32_MAX;
+    fd->frames_since_change = FRAME_SHED_HOLD_FRAMES;  // Erster Überlauf wirkt sofort
+}
+
+void frame_deadline_reset_stats(frame_deadline_t *fd) {
+    fd->frames = 0;
+    fd->overruns = 0;
+    fd->min_slack_us = INT32_MAX;
+    fd->slack_sum_us = 0;
+    fd->shed_count = 0;
+    fd->restore_count = 0;
+}
+
+int frame_deadline_end(frame_deadline_t *fd, int64_t start_us, int64_t end_us) {
+    int64_t slack = start_us + fd->budget_us - end_us;
+    if (slack < INT32_MIN) slack = INT32_MIN;
+
+    fd->frames++;
+    fd->last_slack_us = (int32_t)slack;
+    fd->slack_sum_us += slack;
+    if (slack < fd->min_slack_us) fd->min_slack_us = (int32_t)slack;
+    if (fd->frames_since_change < UINT32_MAX) fd->frames_since_change++;
+
+    if (slack < 0) {
+        fd->overruns++;
+        fd->headroom_streak = 0;
+        if (fd->level < QUALITY_LEVEL_COUNT - 1 && fd->frames_since_change >= FRAME_SHED_HOLD_FRAMES) {
+            fd->level++;
+            fd->shed_count++;
+            fd->frames_since_change = 0;
+            return 1;
+        }
+        return 0;
+    }
+
+    if (slack >= FRAME_HEADROOM_US) {
+        fd->headroom_streak++;
+    } else {
+        fd->headroom_streak = 0;
+    }
+
+    if (fd->level > QUALITY_FULL && fd->headroom_streak >= FRAME_RESTORE_FRAMES) {
+        fd->level--;
+        fd->restore_count++;
+        fd->frames_since_change = 0;
+        fd->headroom_streak = 0;
+        return -1;
+    }
+    return 0;
+}
+
+const char *frame_deadline_level_name(quality_level_t level) {
+    return (level < QUALITY_LEVEL_COUNT) ? s_level_names[level] : "?";
+}
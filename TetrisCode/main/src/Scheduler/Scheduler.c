@@ -0,0 +1,294 @@
+/**
+ * @file Scheduler.c
+ * @brief Deadline-getriebener Event-Scheduler für den GameLoop
+ *
+ * Ersetzt das feste Polling mit vTaskDelay(LOOP_INTERVAL_MS):
+ * - Bei CONFIG_FREERTOS_HZ=100 wurde pdMS_TO_TICKS(5) zu 0 Ticks → Task drehte leer
+ * - Alle Zeiten hatten durch xTaskGetTickCount nur 10ms Auflösung
+ *
+ * Funktionsweise:
+ * - Jeder Event-Typ besitzt eine Deadline in µs (clock_now_us() Zeitbasis, siehe Clock.h)
+ * - Ein einzelner One-Shot esp_timer wird auf die früheste Deadline gestellt
+ * - Der Timer-Callback und der Button-Abtaster wecken den Task per Task-Notification
+ * - Der Task schläft dazwischen vollständig (keine CPU-Last)
+ * - Mit virtueller Uhr (Clock.h) wird die Zeit direkt auf die nächste Deadline
+ *   vorgespult (Host-Simulation schneller als Echtzeit). Alle SCHED_VIRTUAL_YIELD_MS
+ *   Echtzeit blockiert der Task trotzdem einen Tick, sonst liefe IDLE auf seinem
+ *   Core nie (Task-Watchdog)
+ */
+
+#include "Scheduler.h"
+#include "Clock.h"
+#include "Globals.h"
+#include "BinLog.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+#include <stdio.h>
+
+// ============================================================================
+// PRIVATE VARIABLEN
+// ============================================================================
+
+/** @brief Notification-Bit: früheste Deadline erreicht (esp_timer Callback) */
+#define SCHED_NOTIFY_DEADLINE  (1u << 0)
+
+/** @brief Notification-Bit: Input aus ISR */
+#define SCHED_NOTIFY_INPUT     (1u << 1)
+
+/** @brief Task, der in scheduler_wait() blockiert */
+static TaskHandle_t s_owner_task = NULL;
+
+/** @brief One-Shot Timer für die früheste Deadline */
+static esp_timer_handle_t s_deadline_timer = NULL;
+
+/** @brief Deadline pro Event-Typ in µs (gültig wenn Bit in s_armed_mask gesetzt) */
+static int64_t s_deadline_us[SCHED_EVT_COUNT];
+
+/** @brief Bitmaske der aktiven Deadlines */
+static uint32_t s_armed_mask = 0;
+
+/** @brief Messung der CPU-Auslastung: aktive Zeit im aktuellen Fenster */
+static int64_t s_busy_us = 0;
+static int64_t s_window_start_us = 0;
+static int64_t s_last_wake_us = 0;
+static uint32_t s_wakeups = 0;
+static uint32_t s_load_permille = 0;
+
+/** @brief Virtuelle Uhr: Echtzeit des letzten Blockierens (clock_wall_us) */
+static int64_t s_virtual_yield_us = 0;
+
+/** @brief Früheste Deadline der zuletzt zurückgegebenen Events (Frame-Beginn) */
+static int64_t s_frame_start_us = 0;
+
+// ============================================================================
+// HELPER FUNKTIONEN
+// ============================================================================
+
+/**
+ * @brief esp_timer Callback (läuft im esp_timer Task)
+ *
+ * Weckt nur den Owner-Task; die eigentliche Auswertung der Deadlines
+ * erfolgt in scheduler_wait() im Task-Kontext.
+ */
+static void scheduler_timer_cb(void *arg) {
+    if (s_owner_task != NULL) {
+        xTaskNotify(s_owner_task, SCHED_NOTIFY_DEADLINE, eSetBits);
+    }
+}
+
+/**
+ * @brief Sammelt alle fälligen Events und deaktiviert sie
+ *
+ * Merkt sich die früheste fällige Deadline als Frame-Beginn (ohne fällige
+ * Events, z.B. reiner Input: now).
+ *
+ * @return Bitmaske der fälligen Events
+ */
+static uint32_t scheduler_collect_due(int64_t now) {
+    uint32_t due = 0;
+    s_frame_start_us = now;
+    for (int evt = 0; evt < SCHED_EVT_COUNT; evt++) {
+        if ((s_armed_mask & SCHED_EVT_BIT(evt)) && s_deadline_us[evt] <= now) {
+            due |= SCHED_EVT_BIT(evt);
+            if (s_deadline_us[evt] < s_frame_start_us) {
+                s_frame_start_us = s_deadline_us[evt];
+            }
+        }
+    }
+    s_armed_mask &= ~due;
+    return due;
+}
+
+/**
+ * @brief Früheste aktive Deadline (INT64_MAX wenn keine aktiv)
+ */
+static int64_t scheduler_earliest_deadline(void) {
+    int64_t earliest = INT64_MAX;
+    for (int evt = 0; evt < SCHED_EVT_COUNT; evt++) {
+        if ((s_armed_mask & SCHED_EVT_BIT(evt)) && s_deadline_us[evt] < earliest) {
+            earliest = s_deadline_us[evt];
+        }
+    }
+    return earliest;
+}
+
+/**
+ * @brief Stellt den One-Shot Timer auf die früheste aktive Deadline
+ */
+static void scheduler_program_timer(int64_t now) {
+    if (s_armed_mask == 0) return;
+
+    int64_t delay = scheduler_earliest_deadline() - now;
+    if (delay < 1) delay = 1;
+
+    esp_timer_stop(s_deadline_timer);  // Fehler ignorieren falls Timer nicht aktiv
+    esp_timer_start_once(s_deadline_timer, (uint64_t)delay);
+}
+
+/**
+ * @brief Aktualisiert die Lastmessung und gibt sie periodisch aus
+ *
+ * Aktive Zeit = Zeit zwischen Aufwachen und erneutem Blockieren.
+ */
+static void scheduler_account_busy(int64_t now) {
+    s_busy_us += now - s_last_wake_us;
+
+    int64_t window = now - s_window_start_us;
+    if (window >= (int64_t)SCHED_LOAD_REPORT_MS * 1000) {
+        s_load_permille = (uint32_t)((s_busy_us * 1000) / window);
+        BLOG(LOG_SCHED_LOAD, s_load_permille / 10, s_load_permille % 10, s_wakeups);
+        s_busy_us = 0;
+        s_wakeups = 0;
+        s_window_start_us = now;
+    }
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+/**
+ * @brief Initialisiert den Scheduler für den aufrufenden Task
+ */
+void scheduler_init(void) {
+    s_owner_task = xTaskGetCurrentTaskHandle();
+    s_armed_mask = 0;
+
+    if (s_deadline_timer == NULL) {
+        const esp_timer_create_args_t timer_args = {
+            .callback = scheduler_timer_cb,
+            .arg = NULL,
+            .dispatch_method = ESP_TIMER_TASK,
+            .name = "sched_deadline",
+        };
+        ESP_ERROR_CHECK(esp_timer_create(&timer_args, &s_deadline_timer));
+    }
+
+    int64_t now = clock_now_us();
+    s_window_start_us = now;
+    s_last_wake_us = now;
+    s_busy_us = 0;
+    s_wakeups = 0;
+}
+
+void scheduler_arm_at(sched_event_t evt, int64_t deadline_us) {
+    if (evt >= SCHED_EVT_COUNT) return;
+    s_deadline_us[evt] = deadline_us;
+    s_armed_mask |= SCHED_EVT_BIT(evt);
+}
+
+void scheduler_arm_in(sched_event_t evt, int64_t delay_us) {
+    scheduler_arm_at(evt, clock_now_us() + delay_us);
+}
+
+void scheduler_arm_periodic(sched_event_t evt, int64_t period_us) {
+    if (evt >= SCHED_EVT_COUNT) return;
+
+    int64_t now = clock_now_us();
+    int64_t next = s_deadline_us[evt] + period_us;
+
+    // Hinterher (z.B. nach Line-Clear Animation) → nicht nachholen, neu ab jetzt
+    if (next <= now) {
+        next = now + period_us;
+    }
+    scheduler_arm_at(evt, next);
+}
+
+void scheduler_cancel(sched_event_t evt) {
+    if (evt >= SCHED_EVT_COUNT) return;
+    s_armed_mask &= ~SCHED_EVT_BIT(evt);
+}
+
+bool scheduler_is_armed(sched_event_t evt) {
+    if (evt >= SCHED_EVT_COUNT) return false;
+    return (s_armed_mask & SCHED_EVT_BIT(evt)) != 0;
+}
+
+/**
+ * @brief scheduler_wait() mit virtueller Uhr: Zeit auf die früheste Deadline vorspulen
+ *
+ * Input-Notifications werden bei jedem Aufruf abgefragt. Blockiert wird nur einen
+ * Tick, wenn nichts geplant ist oder seit SCHED_VIRTUAL_YIELD_MS Echtzeit nicht mehr
+ * blockiert wurde: IDLE (niedrigste Priorität) läuft sonst auf diesem Core nie.
+ */
+static uint32_t scheduler_wait_virtual(void) {
+    TickType_t timeout = 0;
+    int64_t wall_us = clock_wall_us();
+    if (s_armed_mask == 0 || wall_us - s_virtual_yield_us >= (int64_t)SCHED_VIRTUAL_YIELD_MS * 1000) {
+        timeout = 1;
+        s_virtual_yield_us = wall_us;
+    }
+
+    uint32_t notified = 0;
+    xTaskNotifyWait(0, UINT32_MAX, &notified, timeout);
+
+    uint32_t due = scheduler_collect_due(clock_now_us());
+    if (notified & SCHED_NOTIFY_INPUT) {
+        due |= SCHED_WAKE_INPUT;
+    }
+    if (due != 0) {
+        return due;
+    }
+    if (s_armed_mask == 0) {
+        return SCHED_WAKE_INPUT;  // Nichts geplant → Aufrufer pollt Input selbst
+    }
+
+    clock_advance_to(scheduler_earliest_deadline());
+    return scheduler_collect_due(clock_now_us());
+}
+
+/**
+ * @brief Blockiert bis ein Event fällig ist oder Input eintrifft
+ *
+ * Ablauf:
+ * 1. Fällige Events einsammeln → sofort zurückgeben
+ * 2. Sonst Timer auf früheste Deadline stellen und auf Notification warten
+ * 3. Nach dem Aufwachen erneut fällige Events einsammeln
+ *
+ * Virtuelle Uhr: siehe scheduler_wait_virtual().
+ */
+uint32_t scheduler_wait(void) {
+    if (clock_is_virtual()) {
+        return scheduler_wait_virtual();
+    }
+
+    int64_t now = clock_now_us();
+    uint32_t due = scheduler_collect_due(now);
+
+    while (due == 0) {
+        scheduler_program_timer(now);
+        scheduler_account_busy(now);
+
+        uint32_t notified = 0;
+        xTaskNotifyWait(0, UINT32_MAX, &notified, portMAX_DELAY);
+
+        now = clock_now_us();
+        s_last_wake_us = now;
+        s_wakeups++;
+
+        due = scheduler_collect_due(now);
+        if (notified & SCHED_NOTIFY_INPUT) {
+            due |= SCHED_WAKE_INPUT;
+        }
+    }
+    return due;
+}
+
+void scheduler_notify_input_from_isr(BaseType_t *higher_priority_task_woken) {
+    if (s_owner_task == NULL) return;
+    xTaskNotifyFromISR(s_owner_task, SCHED_NOTIFY_INPUT, eSetBits, higher_priority_task_woken);
+}
+
+void scheduler_notify_input(void) {
+    if (s_owner_task == NULL) return;
+    xTaskNotify(s_owner_task, SCHED_NOTIFY_INPUT, eSetBits);
+}
+
+uint32_t scheduler_get_load_permille(void) {
+    return s_load_permille;
+}
+
+int64_t scheduler_frame_start_us(void) {
+    return s_frame_start_us;
+}
@@ -0,0 +1,110 @@
+/**
+ * @file Gravity.c
+ * @brief Sub-Cell Gravity Engine (Akkumulator in Q32.32 Reihen)
+ *
+ * Vorher fiel ein Block höchstens eine Reihe pro Fall-Event und die
+ * Geschwindigkeit war durch die 50ms-Untergrenze der speed_levels begrenzt.
+ *
+ * Jetzt:
+ * - Geschwindigkeit = Reihen pro µs (Q0.32), beliebig schnell bis 20G/sofort
+ * - Akkumulator sammelt Bruchteile zwischen den Events (kein Tick-Jitter)
+ * - Mehrere fällige Reihen werden vom Aufrufer in EINER Kollisionsabfrage
+ *   aufgelöst (grid_drop_distance)
+ *
+ * Reine Logik ohne FreeRTOS-/ESP-Abhängigkeiten (Host-kompilierbar).
+ */
+
+#include "Gravity.h"
+#include <stdint.h>
+
+/** @brief Obergrenze für einen Akkumulationsschritt (verhindert Überlauf nach langen Pausen) */
+#define GRAVITY_MAX_DT_US  (10LL * 1000 * 1000)
+
+// ============================================================================
+// HELPER FUNKTIONEN
+// ============================================================================
+
+/**
+ * @brief Akkumuliert die seit last_us vergangene Zeit
+ */
+static void gravity_accumulate(gravity_state_t *g, int64_t now_us) {
+    if (now_us <= g->last_us) return;
+
+    int64_t dt = now_us - g->last_us;
+    g->last_us = now_us;
+
+    if (g->rate_q32 == GRAVITY_INSTANT) return;  // Sofort-Fall braucht keinen Akkumulator
+    if (dt > GRAVITY_MAX_DT_US) dt = GRAVITY_MAX_DT_US;
+
+    g->accum_q32 += (uint64_t)dt * g->rate_q32;
+}
+
+/**
+ * @brief Akkumulator-Stand bei now_us ohne den Zustand zu verändern
+ */
+static uint64_t gravity_peek(const gravity_state_t *g, int64_t now_us) {
+    int64_t dt = now_us - g->last_us;
+    if (dt <= 0) return g->accum_q32;
+    if (dt > GRAVITY_MAX_DT_US) dt = GRAVITY_MAX_DT_US;
+    return g->accum_q32 + (uint64_t)dt * g->rate_q32;
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+void gravity_reset(gravity_state_t *g, uint32_t rate_q32, int64_t now_us) {
+    g->rate_q32 = rate_q32;
+    g->accum_q32 = 0;
+    g->last_us = now_us;
+}
+
+void gravity_set_rate(gravity_state_t *g, uint32_t rate_q32, int64_t now_us) {
+    gravity_accumulate(g, now_us);  // Bisherige Zeit mit alter Geschwindigkeit verbuchen
+    g->rate_q32 = rate_q32;
+}
+
+int gravity_take_rows(gravity_state_t *g, int64_t now_us, int max_rows) {
+    if (max_rows <= 0) return 0;
+
+    gravity_accumulate(g, now_us);
+
+    if (g->rate_q32 == GRAVITY_INSTANT) {
+        g->accum_q32 = 0;
+        return max_rows;
+    }
+
+    uint64_t rows = g->accum_q32 >> 32;
+    if (rows > (uint64_t)max_rows) {
+        // Mehr fällig als möglich (Block trifft Boden) → Rest verwerfen
+        g->accum_q32 = 0;
+        return max_rows;
+    }
+    g->accum_q32 -= rows << 32;
+    return (int)rows;
+}
+
+void gravity_clear_fraction(gravity_state_t *g, int64_t now_us) {
+    g->accum_q32 = 0;
+    g->last_us = now_us;
+}
+
+int64_t gravity_next_row_us(const gravity_state_t *g, int64_t now_us) {
+    if (g->rate_q32 == GRAVITY_INSTANT) return now_us;
+    if (g->rate_q32 == 0) return INT64_MAX;
+
+    uint64_t accum = gravity_peek(g, now_us);
+    if (accum >= GRAVITY_Q32_ONE_ROW) return now_us;
+
+    uint64_t missing = GRAVITY_Q32_ONE_ROW - accum;
+    uint64_t wait_us = (missing + g->rate_q32 - 1) / g->rate_q32;  // Aufrunden
+    return now_us + (int64_t)wait_us;
+}
+
+uint16_t gravity_fraction_q16(const gravity_state_t *g, int64_t now_us) {
+    if (g->rate_q32 == GRAVITY_INSTANT) return 0;
+
+    uint64_t accum = gravity_peek(g, now_us);
+    if (accum >= GRAVITY_Q32_ONE_ROW) return UINT16_MAX;
+    return (uint16_t)(accum >> 16);
+}
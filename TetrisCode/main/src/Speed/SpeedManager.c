@@ -1,5 +1,7 @@
 #include "SpeedManager.h"
+#include "Gravity.h"
 #include "Globals.h"
+#include "BinLog.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/semphr.h"
 #include <stdio.h>
@@ -20,45 +22,71 @@ extern SemaphoreHandle_t speed_semaphore;
 // Level 7:  100ms (70 Zeilen)
 // Level 8:  80ms  (80 Zeilen)
 // Level 9:  60ms  (90 Zeilen)
-// Max:      50ms  (100+ Zeilen)
-
-static uint32_t current_fall_interval = FALL_INTERVAL_MS;
-static uint32_t total_lines_cleared = 0;
+// Level 10: 50ms  (100 Zeilen)
+// Danach Gravity > 1 Reihe pro Frame: 1G, 3G bis 20G (sofortiger Fall)
+//
+// Gravity ist in Reihen pro µs (Q0.32) definiert (siehe Gravity.h), damit
+// mehrere Reihen pro Fall-Event möglich sind. Lock Delay: Zeit, die ein
+// aufliegender Block noch bewegt werden kann bevor er fixiert wird.
 
 // Struktur für Speed Levels
 typedef struct {
     uint32_t lines_threshold;  // Ab dieser Zeilenanzahl gilt dieser Speed
-    uint32_t fall_interval_ms; // Fallgeschwindigkeit in ms
+    uint32_t gravity_q32;      // Fallgeschwindigkeit in Reihen pro µs (Q0.32)
+    uint32_t lock_delay_ms;    // Lock Delay in ms
 } SpeedLevel;
 
 // Speed Progression Table (Tetris-ähnlich)
 static const SpeedLevel speed_levels[] = {
-    {0,   400},   
-    {2,  370},   
-    {5,  330},   
-    {10,  270},   
-    {15,  220},   
-    {20,  170},   
-    {25,  130},  
-    {30,  100},   
-    {35,  80},    
-    {40,  60},    
-    {45, 50},    
+    {0,  GRAVITY_FROM_INTERVAL_MS(400), 500},
+    {2,  GRAVITY_FROM_INTERVAL_MS(370), 500},
+    {5,  GRAVITY_FROM_INTERVAL_MS(330), 500},
+    {10, GRAVITY_FROM_INTERVAL_MS(270), 500},
+    {15, GRAVITY_FROM_INTERVAL_MS(220), 500},
+    {20, GRAVITY_FROM_INTERVAL_MS(170), 500},
+    {25, GRAVITY_FROM_INTERVAL_MS(130), 500},
+    {30, GRAVITY_FROM_INTERVAL_MS(100), 500},
+    {35, GRAVITY_FROM_INTERVAL_MS(80),  500},
+    {40, GRAVITY_FROM_INTERVAL_MS(60),  500},
+    {45, GRAVITY_FROM_INTERVAL_MS(50),  500},
+    {55, GRAVITY_FROM_G(1),             450},
+    {65, GRAVITY_FROM_G(3),             400},
+    {75, GRAVITY_INSTANT,               350},   // 20G
 };
 
 #define NUM_SPEED_LEVELS (sizeof(speed_levels) / sizeof(SpeedLevel))
 
+static const SpeedLevel *current_level = &speed_levels[0];
+static uint32_t total_lines_cleared = 0;
+
 // Intern: Update der Fallgeschwindigkeit basierend auf Zeilen
 static void update_fall_speed(void) {
     // Finde das passende Speed Level für die aktuelle Zeilenanzahl
     for (int i = NUM_SPEED_LEVELS - 1; i >= 0; i--) {
         if (total_lines_cleared >= speed_levels[i].lines_threshold) {
-            current_fall_interval = speed_levels[i].fall_interval_ms;
+            current_level = &speed_levels[i];
             break;
         }
     }
 }
 
+// Intern: Gravity als Intervall pro Reihe in ms (für Logging / Kompatibilität)
+static uint32_t level_interval_ms(const SpeedLevel *level) {
+    if (level->gravity_q32 == GRAVITY_INSTANT || level->gravity_q32 == 0) return 0;
+    return (uint32_t)(GRAVITY_Q32_ONE_ROW / ((uint64_t)level->gravity_q32 * 1000));
+}
+
+// Intern: Aktuelles Level lesen
+static const SpeedLevel *get_current_level(void) {
+    // SEMAPHOR-SCHUTZ: Speed State vor gleichzeitigem Zugriff schützen
+    const SpeedLevel *result = current_level;
+    if (xSemaphoreTake(speed_semaphore, pdMS_TO_TICKS(10)) == pdTRUE) {
+        result = current_level;
+        xSemaphoreGive(speed_semaphore);
+    }
+    return result;
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////////////
 // PUBLIC FUNCTIONS
 //////////////////////////////////////////////////////////////////////////////////////////////////
@@ -66,37 +94,42 @@ static void update_fall_speed(void) {
 void speed_manager_init(void) {
     total_lines_cleared = 0;
     // Always start with Level 0 speed from the table
-    current_fall_interval = speed_levels[0].fall_interval_ms;
-    printf("[SpeedManager] Initialized - Start speed: %lu ms\n", current_fall_interval);
+    current_level = &speed_levels[0];
+    printf("[SpeedManager] Initialized - Start speed: %lu ms\n", level_interval_ms(current_level));
 }
 
 uint32_t speed_manager_get_fall_interval(void) {
-    // SEMAPHOR-SCHUTZ: Speed State vor gleichzeitigem Zugriff schützen
-    uint32_t result = current_fall_interval;
-    if (xSemaphoreTake(speed_semaphore, pdMS_TO_TICKS(10)) == pdTRUE) {
-        result = current_fall_interval;
-        xSemaphoreGive(speed_semaphore);
-    }
-    return result;
+    return level_interval_ms(get_current_level());
+}
+
+uint32_t speed_manager_get_gravity(void) {
+    return get_current_level()->gravity_q32;
+}
+
+uint32_t speed_manager_get_lock_delay_ms(void) {
+    return get_current_level()->lock_delay_ms;
+}
+
+uint32_t speed_manager_get_level(void) {
+    return (uint32_t)(get_current_level() - speed_levels) + 1;
 }
 
 void speed_manager_update_score(uint32_t lines_cleared) {
     // SEMAPHOR-SCHUTZ: Speed Update mit Semaphor schützen
     if (xSemaphoreTake(speed_semaphore, pdMS_TO_TICKS(10)) != pdTRUE) {
-        printf("[SpeedManager] ERROR: Speed semaphore timeout\n");
+        BLOG(LOG_SPEED_SEM_TIMEOUT);
         return;
     }
     
-    uint32_t old_speed = current_fall_interval;
+    const SpeedLevel *old_level = current_level;
     total_lines_cleared = lines_cleared;  // Grid.c tracked the total, just use it
     update_fall_speed();
     
-    printf("[SpeedManager] Lines cleared: %lu total, Current speed: %lu ms\n", 
-           total_lines_cleared, current_fall_interval);
+    BLOG(LOG_SPEED_LINES, total_lines_cleared, level_interval_ms(current_level));
     
-    if (current_fall_interval != old_speed) {
-        printf("[SpeedManager] ⚡ LEVEL UP! Lines: %lu, Speed: %lu ms (was %lu ms)\n", 
-               total_lines_cleared, current_fall_interval, old_speed);
+    if (current_level != old_level) {
+        BLOG(LOG_SPEED_LEVEL_UP, total_lines_cleared, level_interval_ms(current_level),
+             level_interval_ms(old_level));
     }
     
     xSemaphoreGive(speed_semaphore);
@@ -105,6 +138,6 @@ void speed_manager_update_score(uint32_t lines_cleared) {
 void speed_manager_reset(void) {
     total_lines_cleared = 0;
     // Reset to Level 0 speed from the table
-    current_fall_interval = speed_levels[0].fall_interval_ms;
-    printf("[SpeedManager] Reset - Speed: %lu ms\n", current_fall_interval);
+    current_level = &speed_levels[0];
+    BLOG(LOG_SPEED_RESET, level_interval_ms(current_level));
 }
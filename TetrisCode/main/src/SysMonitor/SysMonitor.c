@@ -0,0 +1,388 @@
+/**
+ * @file SysMonitor.c
+ * @brief Hintergrund-Monitor für CPU-Last pro Task, Stack-Reserven und Heap
+ *
+ * GameLoopTask und ThemeTask laufen mit je 4096 Byte Stack auf Priorität 5
+ * neben dem LVGL-Task, ohne dass sichtbar war, wie viel CPU sie brauchen und
+ * wie nah sie am Stack-Overflow sind. Dieser Task (niedrigste Priorität):
+ *
+ * - liest alle SYSMON_SAMPLE_MS uxTaskGetSystemState() (Runtime-Zähler,
+ *   Stack-High-Water-Mark) und den Heap (frei, Minimum seit Boot, größter Block)
+ * - rechnet die Runtime-Deltas in Promille eines Cores um, Core-Last = 1000 - IDLE
+ * - hält pro Task/Core/Heap ein rollendes Fenster (Mittelwert/Maximum/Minimum)
+ * - warnt einmalig bei knappen Stacks, niedrigem Heap-Minimum und Fragmentierung
+ * - gibt pro Fenster einen kompakten Text-Report aus oder streamt jedes Sample
+ *   binär (CONFIG_TETRIS_SYSMON_BINARY, Format in SysMonitor.h)
+ */
+
+#include "SysMonitor.h"
+#include "Globals.h"
+#include "TaskConfig.h"
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_heap_caps.h"
+#include <stdio.h>
+#include <string.h>
+
+#if CONFIG_TETRIS_SYSMON
+
+// ============================================================================
+// PRIVATE VARIABLEN
+// ============================================================================
+
+/** @brief Max. überwachte Tasks (mehr werden ignoriert, einmalige Warnung) */
+#define SYSMON_MAX_TASKS    24
+
+/** @brief Kein Core / keine Affinität */
+#define SYSMON_NO_CORE      0xFF
+
+/** @brief Zustand pro Task (Zuordnung über xTaskNumber) */
+typedef struct {
+    bool used;
+    bool seen;                          // Im aktuellen Sample gefunden
+    UBaseType_t number;
+    char name[configMAX_TASK_NAME_LEN];
+    uint8_t priority;
+    uint8_t core;
+    configRUN_TIME_COUNTER_TYPE last_runtime;
+    uint8_t samples;                    // Gültige Einträge in cpu_permille
+    uint16_t cpu_permille[SYSMON_WINDOW_SAMPLES];
+    uint32_t stack_free;
+    bool stack_warned;
+} sysmon_task_t;
+
+static sysmon_task_t s_tasks[SYSMON_MAX_TASKS];
+static TaskStatus_t s_status[SYSMON_MAX_TASKS];
+
+/** @brief Rollendes Fenster: Ringposition und Anzahl gültiger Samples */
+static int s_window_pos = 0;
+static int s_window_fill = 0;
+
+static uint16_t s_core_load[portNUM_PROCESSORS][SYSMON_WINDOW_SAMPLES];
+static uint32_t s_heap_free[SYSMON_WINDOW_SAMPLES];
+static uint32_t s_heap_min_ever = 0;
+static uint32_t s_heap_largest = 0;
+
+static configRUN_TIME_COUNTER_TYPE s_last_total = 0;
+static bool s_first_sample = true;
+
+static bool s_heap_warned = false;
+static bool s_frag_warned = false;
+static bool s_overflow_warned = false;
+
+static TaskHandle_t s_monitor_task = NULL;
+
+// ============================================================================
+// HELPER FUNKTIONEN
+// ============================================================================
+
+/**
+ * @brief Slot für eine Task-Nummer suchen oder neu belegen
+ */
+static sysmon_task_t *sysmon_slot(const TaskStatus_t *st) {
+    sysmon_task_t *free_slot = NULL;
+    for (int i = 0; i < SYSMON_MAX_TASKS; i++) {
+        if (s_tasks[i].used && s_tasks[i].number == st->xTaskNumber) return &s_tasks[i];
+        if (!s_tasks[i].used && free_slot == NULL) free_slot = &s_tasks[i];
+    }
+    if (free_slot == NULL) return NULL;
+
+    memset(free_slot, 0, sizeof(*free_slot));
+    free_slot->used = true;
+    free_slot->number = st->xTaskNumber;
+    free_slot->last_runtime = st->ulRunTimeCounter;
+    strncpy(free_slot->name, st->pcTaskName, sizeof(free_slot->name) - 1);
+    return free_slot;
+}
+
+/**
+ * @brief Mittelwert und Maximum der letzten n Einträge eines Fensters
+ */
+static void sysmon_window_stats(const uint16_t *values, int n, uint32_t *avg, uint32_t *max) {
+    uint32_t sum = 0, peak = 0;
+    for (int i = 0; i < n; i++) {
+        int idx = (s_window_pos - 1 - i + SYSMON_WINDOW_SAMPLES) % SYSMON_WINDOW_SAMPLES;
+        sum += values[idx];
+        if (values[idx] > peak) peak = values[idx];
+    }
+    *avg = (n > 0) ? sum / n : 0;
+    *max = peak;
+}
+
+/**
+ * @brief Schwellwerte prüfen (jede Warnung einmalig, bis sich der Zustand erholt)
+ */
+static void sysmon_check_thresholds(uint32_t heap_free) {
+    for (int i = 0; i < SYSMON_MAX_TASKS; i++) {
+        sysmon_task_t *t = &s_tasks[i];
+        if (!t->used || t->stack_warned) continue;
+        if (t->stack_free < SYSMON_STACK_WARN_BYTES) {
+            printf("[SysMon] WARNING: %s stack low, %lu bytes left (limit %d)\n",
+                   t->name, (unsigned long)t->stack_free, SYSMON_STACK_WARN_BYTES);
+            t->stack_warned = true;
+        }
+    }
+
+    if (!s_heap_warned && s_heap_min_ever < SYSMON_HEAP_WARN_BYTES) {
+        printf("[SysMon] WARNING: heap minimum-ever free %lu bytes (limit %d)\n",
+               (unsigned long)s_heap_min_ever, SYSMON_HEAP_WARN_BYTES);
+        s_heap_warned = true;
+    }
+
+    bool fragmented = heap_free > 0 &&
+                      (uint64_t)s_heap_largest * 100 < (uint64_t)heap_free * SYSMON_FRAG_WARN_PERCENT;
+    if (fragmented && !s_frag_warned) {
+        printf("[SysMon] WARNING: heap fragmented, largest block %lu of %lu bytes free\n",
+               (unsigned long)s_heap_largest, (unsigned long)heap_free);
+    }
+    s_frag_warned = fragmented;
+}
+
+/**
+ * @brief Ein Sample: Runtime-Stats, Stack, Heap ins Fenster übernehmen
+ *
+ * @return Anzahl gefundener Tasks
+ */
+static int sysmon_sample(void) {
+    int count = 0;
+    configRUN_TIME_COUNTER_TYPE total = 0;
+
+#if CONFIG_FREERTOS_USE_TRACE_FACILITY
+    count = (int)uxTaskGetSystemState(s_status, SYSMON_MAX_TASKS, &total);
+    if (count == 0 && !s_overflow_warned) {
+        printf("[SysMon] WARNING: more than %d tasks, task stats disabled\n", SYSMON_MAX_TASKS);
+        s_overflow_warned = true;
+    }
+#endif
+
+    configRUN_TIME_COUNTER_TYPE dt_total = total - s_last_total;
+    s_last_total = total;
+
+    for (int c = 0; c < portNUM_PROCESSORS; c++) {
+        s_core_load[c][s_window_pos] = 0;
+    }
+    for (int i = 0; i < SYSMON_MAX_TASKS; i++) {
+        s_tasks[i].seen = false;
+    }
+
+    for (int i = 0; i < count; i++) {
+        const TaskStatus_t *st = &s_status[i];
+        sysmon_task_t *t = sysmon_slot(st);
+        if (t == NULL) continue;
+
+        configRUN_TIME_COUNTER_TYPE dt = st->ulRunTimeCounter - t->last_runtime;
+        t->last_runtime = st->ulRunTimeCounter;
+
+        uint32_t cpu = 0;
+        if (!s_first_sample && dt_total > 0) {
+            cpu = (uint32_t)(((uint64_t)dt * 1000) / dt_total);
+            if (cpu > 1000) cpu = 1000;
+        }
+
+        t->seen = true;
+        t->priority = (uint8_t)st->uxCurrentPriority;
+#if CONFIG_FREERTOS_VTASKLIST_INCLUDE_COREID
+        t->core = (st->xCoreID >= 0 && st->xCoreID < portNUM_PROCESSORS) ? (uint8_t)st->xCoreID : SYSMON_NO_CORE;
+#else
+        t->core = SYSMON_NO_CORE;
+#endif
+        t->stack_free = (uint32_t)st->usStackHighWaterMark;  // ESP-IDF: Bytes
+        t->cpu_permille[s_window_pos] = (uint16_t)cpu;
+        if (t->samples < SYSMON_WINDOW_SAMPLES) t->samples++;
+
+        // IDLE0 / IDLE1: Core-Last = 1000 - Idle-Anteil
+        if (strncmp(t->name, "IDLE", 4) == 0) {
+            int core = (t->name[4] >= '0' && t->name[4] <= '9') ? t->name[4] - '0' : t->core;
+            if (core >= 0 && core < portNUM_PROCESSORS && !s_first_sample) {
+                s_core_load[core][s_window_pos] = (uint16_t)(1000 - cpu);
+            }
+        }
+    }
+
+    // Beendete Tasks freigeben
+    for (int i = 0; i < SYSMON_MAX_TASKS; i++) {
+        if (s_tasks[i].used && !s_tasks[i].seen) s_tasks[i].used = false;
+    }
+
+    uint32_t heap_free = (uint32_t)heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    s_heap_min_ever = (uint32_t)heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT);
+    s_heap_largest = (uint32_t)heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+    s_heap_free[s_window_pos] = heap_free;
+
+    sysmon_check_thresholds(heap_free);
+
+    s_first_sample = false;
+    s_window_pos = (s_window_pos + 1) % SYSMON_WINDOW_SAMPLES;
+    if (s_window_fill < SYSMON_WINDOW_SAMPLES) s_window_fill++;
+    return count;
+}
+
+// ============================================================================
+// AUSGABE
+// ============================================================================
+
+/**
+ * @brief Kompakter Text-Report über das aktuelle Fenster
+ */
+static void sysmon_print_report(void) {
+    int last = (s_window_pos - 1 + SYSMON_WINDOW_SAMPLES) % SYSMON_WINDOW_SAMPLES;
+
+    uint32_t heap_win_min = UINT32_MAX;
+    for (int i = 0; i < s_window_fill; i++) {
+        int idx = (s_window_pos - 1 - i + SYSMON_WINDOW_SAMPLES) % SYSMON_WINDOW_SAMPLES;
+        if (s_heap_free[idx] < heap_win_min) heap_win_min = s_heap_free[idx];
+    }
+    uint32_t heap_free = s_heap_free[last];
+    uint32_t frag = (heap_free > 0) ? 100 - (uint32_t)(((uint64_t)s_heap_largest * 100) / heap_free) : 0;
+
+    printf("[SysMon] window %d x %d ms | heap free %lu (win min %lu, ever min %lu), largest %lu, frag %lu%%\n",
+           s_window_fill, SYSMON_SAMPLE_MS, (unsigned long)heap_free, (unsigned long)heap_win_min,
+           (unsigned long)s_heap_min_ever, (unsigned long)s_heap_largest, (unsigned long)frag);
+
+    for (int c = 0; c < portNUM_PROCESSORS; c++) {
+        uint32_t avg, max;
+        sysmon_window_stats(s_core_load[c], s_window_fill, &avg, &max);
+        printf("[SysMon] core %d load %3lu.%lu%% avg, %3lu.%lu%% max\n", c,
+               (unsigned long)(avg / 10), (unsigned long)(avg % 10),
+               (unsigned long)(max / 10), (unsigned long)(max % 10));
+    }
+
+    printf("[SysMon] %-16s %4s %4s %6s %6s %6s %6s\n", "task", "prio", "core", "cpu%", "avg%", "max%", "stack");
+    for (int i = 0; i < SYSMON_MAX_TASKS; i++) {
+        const sysmon_task_t *t = &s_tasks[i];
+        if (!t->used) continue;
+
+        uint32_t avg, max;
+        sysmon_window_stats(t->cpu_permille, t->samples, &avg, &max);
+        uint32_t now = t->cpu_permille[last];
+        char core[4] = "-";
+        if (t->core != SYSMON_NO_CORE) snprintf(core, sizeof(core), "%u", t->core);
+
+        printf("[SysMon] %-16s %4u %4s %4lu.%lu %4lu.%lu %4lu.%lu %6lu%s\n",
+               t->name, t->priority, core,
+               (unsigned long)(now / 10), (unsigned long)(now % 10),
+               (unsigned long)(avg / 10), (unsigned long)(avg % 10),
+               (unsigned long)(max / 10), (unsigned long)(max % 10),
+               (unsigned long)t->stack_free, t->stack_warned ? " LOW" : "");
+    }
+}
+
+#if CONFIG_TETRIS_SYSMON_BINARY
+/**
+ * @brief Fletcher-16 über den Frame (Header + Task-Records)
+ */
+static void sysmon_fletcher16(const uint8_t *data, size_t len, uint8_t *s1, uint8_t *s2) {
+    uint16_t a = *s1, b = *s2;
+    for (size_t i = 0; i < len; i++) {
+        a = (a + data[i]) % 255;
+        b = (b + a) % 255;
+    }
+    *s1 = (uint8_t)a;
+    *s2 = (uint8_t)b;
+}
+
+/**
+ * @brief Aktuelles Sample als Binär-Frame auf stdout schreiben
+ */
+static void sysmon_stream_binary(void) {
+    int last = (s_window_pos - 1 + SYSMON_WINDOW_SAMPLES) % SYSMON_WINDOW_SAMPLES;
+    uint8_t s1 = 0, s2 = 0;
+
+    int task_count = 0;
+    for (int i = 0; i < SYSMON_MAX_TASKS; i++) {
+        if (s_tasks[i].used) task_count++;
+    }
+
+    sysmon_frame_header_t hdr = {
+        .magic = { SYSMON_FRAME_MAGIC0, SYSMON_FRAME_MAGIC1 },
+        .version = SYSMON_FRAME_VERSION,
+        .task_count = (uint8_t)task_count,
+        .timestamp_ms = (uint32_t)(xTaskGetTickCount() * portTICK_PERIOD_MS),
+        .heap_free = s_heap_free[last],
+        .heap_min_free = s_heap_min_ever,
+        .heap_largest_block = s_heap_largest,
+    };
+    for (int c = 0; c < portNUM_PROCESSORS && c < 2; c++) {
+        hdr.core_load_permille[c] = s_core_load[c][last];
+    }
+    fwrite(&hdr, sizeof(hdr), 1, stdout);
+    sysmon_fletcher16((const uint8_t *)&hdr, sizeof(hdr), &s1, &s2);
+
+    for (int i = 0; i < SYSMON_MAX_TASKS; i++) {
+        const sysmon_task_t *t = &s_tasks[i];
+        if (!t->used) continue;
+
+        sysmon_frame_task_t rec = {
+            .priority = t->priority,
+            .core = t->core,
+            .cpu_permille = t->cpu_permille[last],
+            .stack_free = t->stack_free,
+        };
+        strncpy(rec.name, t->name, sizeof(rec.name));
+        fwrite(&rec, sizeof(rec), 1, stdout);
+        sysmon_fletcher16((const uint8_t *)&rec, sizeof(rec), &s1, &s2);
+    }
+
+    uint8_t checksum[2] = { s1, s2 };
+    fwrite(checksum, sizeof(checksum), 1, stdout);
+    fflush(stdout);
+}
+#endif // CONFIG_TETRIS_SYSMON_BINARY
+
+// ============================================================================
+// MONITOR TASK
+// ============================================================================
+
+/**
+ * @brief Monitor-Task: sampelt periodisch, Report pro Fenster oder auf Anfrage
+ *
+ * @param pvParameters Unused (NULL)
+ */
+static void sysmon_task(void *pvParameters) {
+#if !CONFIG_FREERTOS_USE_TRACE_FACILITY || !CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+    printf("[SysMon] FreeRTOS trace facility / run time stats disabled, only heap and stack are reported\n");
+#endif
+
+    while (1) {
+        uint32_t notified = 0;
+        xTaskNotifyWait(0, UINT32_MAX, &notified, pdMS_TO_TICKS(SYSMON_SAMPLE_MS));
+
+        sysmon_sample();
+
+#if CONFIG_TETRIS_SYSMON_BINARY
+        sysmon_stream_binary();
+        if (notified) sysmon_print_report();
+#else
+        if (notified || s_window_pos == 0) {
+            sysmon_print_report();
+        }
+#endif
+    }
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+void sysmon_start(void) {
+    if (s_monitor_task != NULL) return;
+    task_config_create(TASK_ROLE_SYSMON, sysmon_task, NULL, &s_monitor_task);
+}
+
+void sysmon_request_report(void) {
+    if (s_monitor_task != NULL) {
+        xTaskNotify(s_monitor_task, 1, eSetBits);
+    }
+}
+
+#else
+
+void sysmon_start(void) {
+}
+
+void sysmon_request_report(void) {
+    printf("[SysMon] Disabled (CONFIG_TETRIS_SYSMON)\n");
+}
+
+#endif // CONFIG_TETRIS_SYSMON
@@ -6,6 +6,8 @@
 #include "esp_log.h"
 #include "Globals.h"
 #include "ThemeSong.h"
+#include "Trace.h"
+#include "TaskConfig.h"
 
 extern EventGroupHandle_t theme_event_group;
 
@@ -259,7 +261,7 @@ static const buzzer_musical_score_t score_silence[] = {
 // SONG MANAGEMENT SYSTEM
 // ============================================================================
 
-static int current_song_index = THEME_TETRIS;  // Aktuelle Song-Nummer
+static volatile int current_song_index = THEME_TETRIS;  // Aktuelle Song-Nummer (vom GameLoop gesetzt)
 
 /* Strukturarray für alle verfügbaren Songs */
 typedef struct {
@@ -301,7 +303,7 @@ static void ThemeTask(void *arg) {
     rmt_tx_channel_config_t tx_chan_config = {
         .clk_src = RMT_CLK_SRC_DEFAULT,
         .gpio_num = BUZZER_GPIO_PIN,
-        .mem_block_symbols = 64,
+        .mem_block_symbols = RMT_MEM_BLOCK_SYMBOLS,
         .resolution_hz = RMT_BUZZER_RESOLUTION_HZ,
         .trans_queue_depth = 10,
     };
@@ -364,6 +366,7 @@ static void ThemeTask(void *arg) {
             if (loop_count == 0) loop_count = 1;
 
             rmt_transmit_config_t tx_config = { .loop_count = loop_count };
+            TRACE_INSTANT(TRACE_NOTE, freq);  // rmt_transmit stellt nur in die Queue
             ESP_ERROR_CHECK(rmt_transmit(buzzer_chan, score_encoder, &current_song->score[i],
                                         sizeof(buzzer_musical_score_t), &tx_config));
         }
@@ -377,7 +380,7 @@ void StartTheme(void) {
     // Task nur einmal erstellen
     static bool task_started = false;
     if (!task_started) {
-        xTaskCreate(ThemeTask, "ThemeTask", 4096, NULL, 5, NULL);
+        task_config_create(TASK_ROLE_THEME, ThemeTask, NULL, NULL);
         task_started = true;
     }
 }
@@ -414,20 +417,16 @@ void theme_resume(void) {
    Zyklischer Wechsel durch alle verfügbaren Songs:
    TETRIS → STARWARS → MARIO → SILENCE → TETRIS → ...
    
-   Die aktuelle Musik wird sofort unterbrochen und der neue Song läuft
-   in der nächsten ThemeTask-Iteration.
+   Nicht-blockierend: Der ThemeTask prüft den Index vor jeder Note und
+   startet den neuen Song selbst. Kein Pause/Delay im aufrufenden Task
+   (wird direkt aus dem GameLoop aufgerufen).
    -------------------------------------------------------------------------- */
 void theme_next_song(void) {
-    theme_pause();  // Aktuelle Musik sofort pausieren
-    vTaskDelay(pdMS_TO_TICKS(50));  // Kurz warten bis Musik gestoppt
-    
     current_song_index = (current_song_index + 1) % NUM_AVAILABLE_SONGS;
     
     ESP_LOGI(TAG, "Song switched to: %s (index %d)", 
              available_songs[current_song_index].name, 
              current_song_index);
-    
-    theme_resume();  // Neue Musik starten
 }
 
 /* --------------------------------------------------------------------------
@@ -439,16 +438,11 @@ void theme_next_song(void) {
    -------------------------------------------------------------------------- */
 void theme_set_song(int index) {
     if (index >= 0 && index < NUM_AVAILABLE_SONGS) {
-        theme_pause();
-        vTaskDelay(pdMS_TO_TICKS(50));
-        
-        current_song_index = index;
+        current_song_index = index;  // ThemeTask wechselt vor der nächsten Note
         
         ESP_LOGI(TAG, "Song set to: %s (index %d)", 
                  available_songs[current_song_index].name, 
                  current_song_index);
-        
-        theme_resume();
     } else {
         ESP_LOGW(TAG, "Invalid song index: %d (valid range: 0-%d)", 
                  index, NUM_AVAILABLE_SONGS - 1);
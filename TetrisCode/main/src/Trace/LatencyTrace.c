@@ -0,0 +1,215 @@
+/**
+ * @file LatencyTrace.c
+ * @brief Input-to-Photon Latenz-Messung mit Histogrammen und Perzentilen
+ *
+ * Bisher war nicht messbar, wie lange es von der Button-Flanke bis zum
+ * sichtbar bewegten Block dauert. Der Zeitstempel des Abtasters reist jetzt
+ * im input_event_t durch die Spiellogik:
+ *
+ * - raw_us:       erste Roh-Abtastung, die vom entprellten Zustand abweicht
+ * - timestamp_us: entprellte Flanke (Event im Ring)
+ * - mark:         Spiellogik hat den Block verschoben/rotiert/fallen lassen
+ * - latched:      compositor_present() zurück, Strip-Übertragung abgeschlossen
+ *
+ * Pro Button ein Histogramm (250µs Buckets) für raw → latched, dazu
+ * Mittelwerte der Teilstrecken. Reine Logik bis auf printf (Host-kompilierbar).
+ */
+
+#include "LatencyTrace.h"
+#include <stdio.h>
+#include <string.h>
+
+// ============================================================================
+// PRIVATE VARIABLEN
+// ============================================================================
+
+/** @brief Auf das nächste Frame wartendes Event */
+typedef struct {
+    uint8_t button;
+    int64_t raw_us;
+    int64_t edge_us;
+    int64_t mark_us;
+} latency_pending_t;
+
+/** @brief Messwerte pro Button */
+typedef struct {
+    latency_hist_t hist;        // raw → latched
+    int64_t debounce_sum_us;
+    int64_t logic_sum_us;
+    int64_t frame_sum_us;
+} latency_stats_t;
+
+static latency_stats_t s_stats[BUTTON_COUNT];
+
+/** @brief Button-Namen für die Ausgabe (ohne Controls.h, bleibt Host-kompilierbar) */
+static const char *const s_button_names[BUTTON_COUNT] = {
+    [BUTTON_LEFT] = "LEFT",
+    [BUTTON_RIGHT] = "RIGHT",
+    [BUTTON_ROTATE] = "ROTATE",
+    [BUTTON_FASTER] = "FASTER",
+};
+
+static latency_pending_t s_pending[LATENCY_PENDING_MAX];
+static int s_pending_count = 0;
+
+/** @brief Events verworfen weil s_pending voll war */
+static uint32_t s_pending_dropped = 0;
+
+/** @brief Reset-Wunsch aus einem anderen Task (Konsole) */
+static volatile bool s_reset_requested = false;
+
+// ============================================================================
+// HISTOGRAMM
+// ============================================================================
+
+void latency_hist_reset(latency_hist_t *h) {
+    memset(h, 0, sizeof(*h));
+    h->min_us = INT64_MAX;
+}
+
+void latency_hist_add(latency_hist_t *h, int64_t us) {
+    if (us < 0) us = 0;
+
+    int64_t idx = us / LATENCY_BUCKET_US;
+    if (idx > LATENCY_BUCKET_COUNT) idx = LATENCY_BUCKET_COUNT;
+    h->buckets[idx]++;
+
+    h->count++;
+    h->sum_us += us;
+    if (us < h->min_us) h->min_us = us;
+    if (us > h->max_us) h->max_us = us;
+}
+
+int64_t latency_hist_percentile(const latency_hist_t *h, uint32_t permille) {
+    if (h->count == 0) return 0;
+    if (permille > 1000) permille = 1000;
+
+    // Rang des gesuchten Samples (1-basiert, aufgerundet)
+    uint64_t rank = ((uint64_t)h->count * permille + 999) / 1000;
+    if (rank == 0) rank = 1;
+
+    uint64_t seen = 0;
+    for (int i = 0; i <= LATENCY_BUCKET_COUNT; i++) {
+        seen += h->buckets[i];
+        if (seen >= rank) {
+            if (i == LATENCY_BUCKET_COUNT) return h->max_us;
+            int64_t upper = (int64_t)(i + 1) * LATENCY_BUCKET_US;
+            return (upper < h->max_us) ? upper : h->max_us;
+        }
+    }
+    return h->max_us;
+}
+
+// ============================================================================
+// TRACER
+// ============================================================================
+
+void latency_trace_reset(void) {
+    for (int i = 0; i < BUTTON_COUNT; i++) {
+        latency_hist_reset(&s_stats[i].hist);
+        s_stats[i].debounce_sum_us = 0;
+        s_stats[i].logic_sum_us = 0;
+        s_stats[i].frame_sum_us = 0;
+    }
+    s_pending_count = 0;
+    s_pending_dropped = 0;
+    s_reset_requested = false;
+}
+
+void latency_trace_request_reset(void) {
+    s_reset_requested = true;
+}
+
+void latency_trace_mark(const input_event_t *ev, int64_t now_us) {
+    if (ev->button >= BUTTON_COUNT) return;
+    if (s_pending_count >= LATENCY_PENDING_MAX) {
+        s_pending_dropped++;
+        return;
+    }
+
+    latency_pending_t *p = &s_pending[s_pending_count++];
+    p->button = ev->button;
+    p->edge_us = ev->timestamp_us;
+    // raw_us fehlt bei synthetischen Events → entprellte Flanke verwenden
+    p->raw_us = (ev->raw_us > 0 && ev->raw_us <= ev->timestamp_us) ? ev->raw_us : ev->timestamp_us;
+    p->mark_us = now_us;
+}
+
+void latency_trace_latched(int64_t now_us) {
+    if (s_reset_requested) {
+        latency_trace_reset();
+        return;
+    }
+
+    for (int i = 0; i < s_pending_count; i++) {
+        const latency_pending_t *p = &s_pending[i];
+        latency_stats_t *st = &s_stats[p->button];
+
+        latency_hist_add(&st->hist, now_us - p->raw_us);
+        st->debounce_sum_us += p->edge_us - p->raw_us;
+        st->logic_sum_us += p->mark_us - p->edge_us;
+        st->frame_sum_us += now_us - p->mark_us;
+    }
+    s_pending_count = 0;
+}
+
+void latency_trace_discard_pending(void) {
+    s_pending_count = 0;
+}
+
+// ============================================================================
+// AUSWERTUNG
+// ============================================================================
+
+bool latency_trace_summary(button_id_t button, latency_summary_t *out) {
+    if (button >= BUTTON_COUNT || out == NULL) return false;
+
+    const latency_stats_t *st = &s_stats[button];
+    uint32_t n = st->hist.count;
+    memset(out, 0, sizeof(*out));
+    out->count = n;
+    if (n == 0) return true;
+
+    out->min_us = st->hist.min_us;
+    out->max_us = st->hist.max_us;
+    out->mean_us = st->hist.sum_us / n;
+    out->p50_us = latency_hist_percentile(&st->hist, 500);
+    out->p95_us = latency_hist_percentile(&st->hist, 950);
+    out->p99_us = latency_hist_percentile(&st->hist, 990);
+    out->debounce_mean_us = st->debounce_sum_us / n;
+    out->logic_mean_us = st->logic_sum_us / n;
+    out->frame_mean_us = st->frame_sum_us / n;
+    return true;
+}
+
+/**
+ * @brief Gibt die Latenz-Tabelle aus (Werte in ms mit einer Nachkommastelle)
+ */
+void latency_trace_print(void) {
+    printf("[Latency] input-to-photon (raw edge -> LEDs latched), ms\n");
+    printf("[Latency] %-7s %6s %6s %6s %6s %6s | %8s %6s %6s\n",
+           "button", "n", "p50", "p95", "p99", "max", "debounce", "logic", "frame");
+
+    for (int b = 0; b < BUTTON_COUNT; b++) {
+        latency_summary_t s;
+        latency_trace_summary((button_id_t)b, &s);
+        if (s.count == 0) {
+            printf("[Latency] %-7s %6s\n", s_button_names[b], "-");
+            continue;
+        }
+        printf("[Latency] %-7s %6lu %4lld.%lld %4lld.%lld %4lld.%lld %4lld.%lld | %6lld.%lld %4lld.%lld %4lld.%lld\n",
+               s_button_names[b], (unsigned long)s.count,
+               s.p50_us / 1000, (s.p50_us % 1000) / 100,
+               s.p95_us / 1000, (s.p95_us % 1000) / 100,
+               s.p99_us / 1000, (s.p99_us % 1000) / 100,
+               s.max_us / 1000, (s.max_us % 1000) / 100,
+               s.debounce_mean_us / 1000, (s.debounce_mean_us % 1000) / 100,
+               s.logic_mean_us / 1000, (s.logic_mean_us % 1000) / 100,
+               s.frame_mean_us / 1000, (s.frame_mean_us % 1000) / 100);
+    }
+
+    if (s_pending_dropped > 0) {
+        printf("[Latency] %lu samples dropped (more than %d inputs per frame)\n",
+               (unsigned long)s_pending_dropped, LATENCY_PENDING_MAX);
+    }
+}
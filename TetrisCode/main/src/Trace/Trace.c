@@ -0,0 +1,145 @@
+/**
+ * @file Trace.c
+ * @brief Flight Recorder für die Zeitleiste (Chrome/Perfetto Trace Export)
+ *
+ * Ein globaler Ring für alle Tasks und Cores:
+ *
+ * - Schreibposition per atomarem fetch_add → kein Lock, kein CAS-Retry
+ * - Der Ring überschreibt die ältesten Events: nach einem Ruckler enthält
+ *   er immer die letzten TRACE_RING_SIZE Events davor
+ * - Jeder Slot trägt eine Sequenz (Position + 1, 0 = wird geschrieben), wie
+ *   die Slots in BinLog.c: der Dump gibt nur veröffentlichte Events aus und
+ *   überspringt halb geschriebene, ohne auf laufende Schreiber zu warten
+ * - Leeren verschiebt nur den Anfang (s_base); Schreiber mit einer älteren
+ *   Position fallen damit aus jedem Dump heraus
+ *
+ * Auswertung: tools/trace2chrome.py capture.txt > trace.json
+ */
+
+#include "Trace.h"
+#include "Clock.h"
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <stdio.h>
+
+#define TRACE_RING_MASK  (TRACE_RING_SIZE - 1)
+
+// ============================================================================
+// PRIVATE VARIABLEN
+// ============================================================================
+
+typedef struct {
+    uint32_t seq;                   // Position + 1 wenn veröffentlicht, 0 während des Schreibens
+    trace_event_t event;
+} trace_slot_t;
+
+static trace_slot_t s_ring[TRACE_RING_SIZE];
+
+/** @brief Anzahl geschriebener Events (Position = s_head & MASK) */
+static uint32_t s_head = 0;
+
+/** @brief Position des ersten Events nach dem letzten trace_clear() */
+static uint32_t s_base = 0;
+
+#if CONFIG_TETRIS_TRACE
+static bool s_enabled = true;
+#else
+static bool s_enabled = false;  // Makros leer, trace_record() bleibt ohne Wirkung
+#endif
+
+// ============================================================================
+// AUFZEICHNUNG
+// ============================================================================
+
+static void trace_write(uint16_t id, uint8_t phase, uint32_t timestamp_us, int32_t arg) {
+    if (!__atomic_load_n(&s_enabled, __ATOMIC_RELAXED)) return;
+
+    uint32_t pos = __atomic_fetch_add(&s_head, 1, __ATOMIC_RELAXED);
+    trace_slot_t *slot = &s_ring[pos & TRACE_RING_MASK];
+    __atomic_store_n(&slot->seq, 0, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);    // Ungültig, bevor die Felder sich ändern
+
+    trace_event_t *e = &slot->event;
+    e->timestamp_us = timestamp_us;
+    e->id = id;
+    e->phase = phase;
+    e->core = (uint8_t)xPortGetCoreID();
+    e->arg = arg;
+    __atomic_store_n(&slot->seq, pos + 1, __ATOMIC_RELEASE);  // Veröffentlichen
+}
+
+void trace_record(uint16_t id, uint8_t phase, int32_t arg) {
+    trace_write(id, phase, (uint32_t)clock_now_us(), arg);
+}
+
+void trace_complete(uint16_t id, uint32_t start_us, uint32_t duration_us) {
+    trace_write(id, TRACE_PH_COMPLETE, start_us, (int32_t)duration_us);
+}
+
+void trace_set_enabled(bool enabled) {
+    __atomic_store_n(&s_enabled, enabled, __ATOMIC_RELEASE);
+}
+
+void trace_clear(void) {
+    __atomic_store_n(&s_base, __atomic_load_n(&s_head, __ATOMIC_RELAXED), __ATOMIC_RELEASE);
+}
+
+void trace_get_stats(trace_stats_t *out) {
+    uint32_t base = __atomic_load_n(&s_base, __ATOMIC_ACQUIRE);
+    out->recorded = __atomic_load_n(&s_head, __ATOMIC_RELAXED) - base;
+    out->capacity = TRACE_RING_SIZE;
+    out->enabled = __atomic_load_n(&s_enabled, __ATOMIC_RELAXED);
+}
+
+// ============================================================================
+// DUMP
+// ============================================================================
+
+/**
+ * @brief Event an Position pos kopieren, falls veröffentlicht und nicht überschrieben
+ */
+static bool trace_read_slot(uint32_t pos, trace_event_t *out) {
+    const trace_slot_t *slot = &s_ring[pos & TRACE_RING_MASK];
+    if (__atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE) != pos + 1) return false;
+
+    *out = slot->event;
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);    // Kopie vor der zweiten Prüfung abschließen
+    return __atomic_load_n(&slot->seq, __ATOMIC_RELAXED) == pos + 1;
+}
+
+/**
+ * @brief Ring ausgeben, ältestes Event zuerst
+ *
+ * Format: "TRACE BEGIN <events> <verloren>", je Event "TR <24 hex>",
+ * "TRACE END <übersprungen>" (beim Dump noch nicht veröffentlichte Slots).
+ * Läuft im Konsolen-Task; Dauer ~ 1s bei vollem Ring und 115200 Baud. Die
+ * Aufzeichnung pausiert währenddessen, sonst überholt der Ring die Ausgabe.
+ */
+void trace_dump(void) {
+    bool was_enabled = __atomic_exchange_n(&s_enabled, false, __ATOMIC_ACQ_REL);
+
+    uint32_t base = __atomic_load_n(&s_base, __ATOMIC_ACQUIRE);
+    uint32_t head = __atomic_load_n(&s_head, __ATOMIC_RELAXED);
+    uint32_t count = head - base < TRACE_RING_SIZE ? head - base : TRACE_RING_SIZE;
+    uint32_t first = head - count;
+    uint32_t skipped = 0;
+
+    printf("TRACE BEGIN %lu %lu\n", (unsigned long)count, (unsigned long)(first - base));
+    for (uint32_t i = first; i != head; i++) {
+        trace_event_t e;
+        if (!trace_read_slot(i, &e)) {
+            skipped++;
+            continue;
+        }
+        const uint8_t *bytes = (const uint8_t *)&e;
+        printf("TR ");
+        for (size_t b = 0; b < sizeof(trace_event_t); b++) {
+            printf("%02x", bytes[b]);
+        }
+        printf("\n");
+    }
+    printf("TRACE END %lu\n", (unsigned long)skipped);
+
+    trace_set_enabled(was_enabled);
+}
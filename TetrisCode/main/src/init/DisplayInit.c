@@ -1,5 +1,8 @@
 #include "DisplayInit.h"
 #include "Globals.h"
+#include "Trace.h"
+#include "Clock.h"
+#include "TaskConfig.h"
 #include "driver/i2c_master.h"
 #include "driver/gpio.h"
 #include "lvgl.h"
@@ -20,6 +23,18 @@ static lv_obj_t *label_score = NULL;
 static lv_obj_t *label_highscore = NULL;
 static lv_obj_t *label_title = NULL;
 
+#if CONFIG_TETRIS_TRACE
+/**
+ * @brief LVGL monitor_cb: Dauer jedes Display-Refresh (läuft im LVGL-Task)
+ *
+ * time = Render + Flush in ms (LVGL-Tick), px = neu gezeichnete Pixel.
+ */
+static void display_trace_flush(lv_disp_drv_t *disp_drv, uint32_t time, uint32_t px) {
+    uint32_t now_us = (uint32_t)clock_now_us();
+    trace_complete(TRACE_HUD_FLUSH, now_us - time * 1000, time * 1000);
+}
+#endif
+
 // Global I2C Bus Handle (for v6.0 API)
 static i2c_master_bus_handle_t i2c_bus_handle = NULL;
 
@@ -166,7 +181,12 @@ void display_init(void) {
     }
 
     // Initialize LVGL
-    const lvgl_port_cfg_t lvgl_cfg = ESP_LVGL_PORT_INIT_CONFIG();
+    // Task-Parameter aus der zentralen Topologie (TaskConfig.c)
+    const task_config_t *lvgl_task = task_config(TASK_ROLE_LVGL);
+    lvgl_port_cfg_t lvgl_cfg = ESP_LVGL_PORT_INIT_CONFIG();
+    lvgl_cfg.task_priority = lvgl_task->priority;
+    lvgl_cfg.task_stack = lvgl_task->stack_bytes;
+    lvgl_cfg.task_affinity = (lvgl_task->core == tskNO_AFFINITY) ? -1 : lvgl_task->core;
     lvgl_port_init(&lvgl_cfg);
 
     // Initialize LVGL display
@@ -185,6 +205,12 @@ void display_init(void) {
         }
     };
     g_disp = lvgl_port_add_disp(&disp_cfg);
+#if CONFIG_TETRIS_TRACE
+    if (g_disp != NULL && lvgl_port_lock(0)) {
+        g_disp->driver->monitor_cb = display_trace_flush;  // Flush-Spanne in der Zeitleiste
+        lvgl_port_unlock();
+    }
+#endif
 
     // Create UI elements (only if display initialized successfully)
     if (g_disp != NULL && lvgl_port_lock(0)) {
@@ -214,10 +240,16 @@ void display_init(void) {
     }
 }
 
+bool display_available(void) {
+    return g_disp != NULL;
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////////////
 // UPDATE FUNCTIONS
 //////////////////////////////////////////////////////////////////////////////////////////////////
 void display_update_score(uint32_t current_score, uint32_t highscore) {
+    TRACE_SCOPE(TRACE_HUD);
+
     // KONSISTENTE NULL-CHECK: Display vor Zugriff prüfen (FEHLER BEHOBEN)
     // Vorher: War inconsistent, teilweise ohne Check
     if (!g_disp) return;  // Display not available, skip
@@ -270,6 +302,8 @@ void display_update_score(uint32_t current_score, uint32_t highscore) {
 
 // Create a fresh screen and build the HUD (title / score / highscore)
 void display_reset_and_show_hud(uint32_t highscore_val) {
+    TRACE_SCOPE(TRACE_HUD);
+
     // KONSISTENTE NULL-CHECK
     if (!g_disp) return;
 
@@ -301,6 +335,8 @@ void display_reset_and_show_hud(uint32_t highscore_val) {
 }
 
 void display_show_game_over(uint32_t final_score, uint32_t highscore) {
+    TRACE_SCOPE(TRACE_HUD);
+
     // KONSISTENTE NULL-CHECK
     if (!g_disp) return;  // Display not available, skip
     
@@ -1,10 +1,13 @@
 #include "Splash.h"
 #include "Globals.h"
-#include "led_strip.h"
 #include "Blocks.h"
 #include "Controls.h"
+#include "Clock.h"
+#include "Compositor.h"
+#include "TextScroll.h"
 #include <stdlib.h>
 #include <string.h>
+#include <stdio.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/semphr.h"
@@ -33,14 +36,15 @@ void splash_init(void) {
     
     // Explicit clear and refresh of all LEDs before splash
     // Ensures no junk data in framebuffer
-    led_strip_clear(led_strip);
-    led_strip_refresh(led_strip);
+    compositor_reset();
+    compositor_commit();
+    compositor_present();
     
     xSemaphoreGive(led_strip_semaphore);
     
     // Small delay to ensure physical LED update completes
     // Critical for consistent display after reset/power-on
-    vTaskDelay(pdMS_TO_TICKS(50));
+    clock_sleep_ms(50);
 }
 
 // ============================================================================
@@ -76,54 +80,6 @@ static const uint8_t splash_design_map[24][16] = {
     {5,5,5,5, 5,5,7,7, 7,7,2,2, 2,2,2,2}
 };
 
-// ============================================================================
-// HELPER FUNKTION: Text-Bitmap generieren (REDUNDANZ ELIMINATED)
-// ============================================================================
-
-/**
- * @brief Generiert das Text-Bitmap für "TETRIS" (3x5 Font)
- * 
- * Konsolidiert die duplizierte Bitmap-Generierung zwischen splash_show
- * und splash_show_waiting in EINE Funktion
- * 
- * @param out_cols Output-Array für die Text-Spalten
- * @param max_cols Maximale Größe des Output-Arrays
- * @return Tatsächliche Anzahl der generierten Spalten
- */
-static int splash_generate_text_bitmap(uint8_t *out_cols, int max_cols) {
-    static const uint8_t ch_T[3] = {1, 31, 1};
-    static const uint8_t ch_E[3] = {31, 21, 21};
-    static const uint8_t ch_R[3] = {31, 5, 26};
-    static const uint8_t ch_I[3] = {17, 31, 17};
-    static const uint8_t ch_S[3] = {18, 21, 9};
-
-    const char *txt = "TETRIS";
-    const int char_w = 3;
-    const int spacing = 1;
-    int len = 6;
-    int total_cols = len * (char_w + spacing);
-
-    if (total_cols > max_cols) return 0;  // Buffer zu klein
-
-    int pos = 0;
-    for (int i = 0; i < len; i++){
-        const uint8_t *bmp = NULL;
-        switch (txt[i]){
-            case 'T': bmp = ch_T; break;
-            case 'E': bmp = ch_E; break;
-            case 'R': bmp = ch_R; break;
-            case 'I': bmp = ch_I; break;
-            case 'S': bmp = ch_S; break;
-            default: bmp = NULL; break;
-        }
-        for (int c = 0; c < char_w; c++){
-            out_cols[pos++] = bmp ? (bmp[c] & 31) : 0;
-        }
-        if (spacing) out_cols[pos++] = 0;
-    }
-    return total_cols;
-}
-
 // ============================================================================
 // HELPER FUNKTION: Render Design-Map (REDUNDANZ ELIMINATED)
 // ============================================================================
@@ -135,122 +91,126 @@ static void splash_render_design_map(void) {
         return;
     }
 
+    // Splash belegt die ganze Matrix: Spielfeld-Ebenen (Game Over etc.) verwerfen
+    compositor_reset();
     for (int y = 0; y < LED_HEIGHT; y++) {
         for (int x = 0; x < LED_WIDTH; x++) {
             uint8_t val = splash_design_map[y][x];
             if (val == 0) continue;
-            uint8_t bidx = (val - 1) % NUM_BLOCKS;
-            uint8_t r, g, b;
-            get_block_rgb(bidx, &r, &g, &b);
-            r = (r * GAME_BRIGHTNESS_SCALE) / 255;
-            g = (g * GAME_BRIGHTNESS_SCALE) / 255;
-            b = (b * GAME_BRIGHTNESS_SCALE) / 255;
-            int led_num = ledMatrix.LED_Number[y][x];
-            led_strip_set_pixel(led_strip, led_num, r, g, b);
+            compositor_set_block(LAYER_BACKGROUND, y, x, val - 1);
         }
     }
-    led_strip_refresh(led_strip);
+    compositor_commit();
+    compositor_present();
     xSemaphoreGive(led_strip_semaphore);
 }
 
 // ============================================================================
-// MAIN SPLASH FUNCTION: splash_show_internal (CONSOLIDATED)
+// NON-BLOCKING SPLASH: splash_begin / splash_tick
+// ============================================================================
+
+/** @brief Lauftext (3x5 Font, Spalten einmal vorberechnet) */
+static text_scroll_t s_text;
+
+/**
+ * @brief Startet die Splash-Animation (Design-Map zeichnen, Lauftext "TETRIS" von vorn)
+ * 
+ * Blockiert nicht. Danach splash_tick() zu splash_next_us() aufrufen.
+ */
+void splash_begin(void) {
+    // Render design map once (REDUNDANZ ELIMINATED)
+    splash_render_design_map();
+
+    // Text lives in the overlay layer; the design shows through where it is unlit
+    const pixel_rgb_t color = { SPLASH_BRIGHTNESS_SCALE, SPLASH_BRIGHTNESS_SCALE, SPLASH_BRIGHTNESS_SCALE };
+    text_scroll_init(&s_text, LAYER_OVERLAY, SPLASH_TEXT_ROW, color, SPLASH_SCROLL_DELAY_MS);
+    text_scroll_set_text(&s_text, "TETRIS", clock_now_us());
+}
+
+/**
+ * @brief Lauftext um Score/Level/Highscore erweitern (z.B. ohne OLED)
+ *
+ * level 0 = noch kein Spiel: nur der Highscore. Startet den Text von vorn.
+ */
+void splash_show_scores(uint32_t score, uint32_t level, uint32_t highscore, bool new_high) {
+    text_scroll_clear(&s_text);
+    text_scroll_append(&s_text, "TETRIS");
+    if (level > 0) {
+        text_scroll_append(&s_text, "  SCORE ");
+        text_scroll_append_number(&s_text, score);
+        text_scroll_append(&s_text, "  LV ");
+        text_scroll_append_number(&s_text, level);
+    }
+    if (new_high) {
+        text_scroll_append(&s_text, "  NEW HIGH");
+    } else {
+        text_scroll_append(&s_text, "  HI ");
+        text_scroll_append_number(&s_text, highscore);
+    }
+    text_scroll_restart(&s_text, clock_now_us());
+}
+
+/**
+ * @brief Führt den Lauftext auf die aktuelle Zeit nach
+ * 
+ * Blockiert nicht (außer kurz auf den LED-Semaphor). Die Position hängt nur
+ * von der Zeit ab; überträgt nur, wenn der Text eine Spalte weiter ist
+ * (dann immer LED_WIDTH x 5 Zellen, unabhängig von der Textlänge).
+ */
+void splash_tick(void) {
+    // SEMAPHOR-SCHUTZ: LED-Strip für Text-Update schützen
+    if (xSemaphoreTake(led_strip_semaphore, pdMS_TO_TICKS(50)) == pdTRUE) {
+        if (text_scroll_advance(&s_text, clock_now_us())) {
+            compositor_commit();
+            compositor_present();
+        }
+        xSemaphoreGive(led_strip_semaphore);
+    }
+}
+
+int64_t splash_next_us(void) {
+    return text_scroll_next_us(&s_text);
+}
+
+// ============================================================================
+// BLOCKING SPLASH: splash_show_internal (CONSOLIDATED)
 // ============================================================================
 
 /**
- * @brief Interne konsolidierte Splash-Animation
+ * @brief Interne konsolidierte Splash-Animation (blockierend, z.B. beim Booten)
  * 
  * Diese Funktion vereinigt die Logik von splash_show und splash_show_waiting
  * in EINE Implementierung mit Flag-Parameter:
  * - wait_for_button=true: Wartet auf Button (keine Zeitbegrenzung)
  * - wait_for_button=false: Läuft für duration_ms, bricht ab wenn Button
  * 
- * REDUNDANZEN ELIMINIERT: 90% Code-Duplikation wurde entfernt!
+ * Nutzt intern splash_begin()/splash_tick(); der GameLoop verwendet diese
+ * direkt (nicht-blockierend).
  * 
  * @param duration_ms Dauer in ms (nur relevant wenn wait_for_button=false)
  * @param wait_for_button true = warte auf Button, false = zeitbasiert
  */
 static void splash_show_internal(uint32_t duration_ms, bool wait_for_button) {
-    // Generate text bitmap (REDUNDANZ ELIMINATED)
-    uint8_t text_bitmap[50];  // 3*6 + 5 = 23, aber 50 für Sicherheit
-    int total_cols = splash_generate_text_bitmap(text_bitmap, 50);
-    if (total_cols == 0) return;
-
-    // Render design map once (REDUNDANZ ELIMINATED)
-    splash_render_design_map();
+    splash_begin();
 
-    // Continuous scroll loop
-    int step = 0;
-    uint32_t start_time = xTaskGetTickCount() * portTICK_PERIOD_MS;
-    bool button_pressed = false;
+    uint32_t start_time = clock_now_ms();
 
-    while (!button_pressed) {
+    while (1) {
         // Zeitbasierte Begrenzung (falls nicht auf Button warten)
         if (!wait_for_button) {
-            uint32_t elapsed = (xTaskGetTickCount() * portTICK_PERIOD_MS) - start_time;
+            uint32_t elapsed = clock_now_ms() - start_time;
             if (elapsed > duration_ms) break;
         }
 
-        // SEMAPHOR-SCHUTZ: LED-Strip für Text-Update schützen
-        if (xSemaphoreTake(led_strip_semaphore, pdMS_TO_TICKS(50)) == pdTRUE) {
-            // Only update text rows (optimization: rows 2-6 where text displays)
-            for (int x = 0; x < LED_WIDTH; x++){
-                int src = step - (LED_WIDTH - x);
-                
-                // Restore design underneath text area
-                for (int y = 2; y < 7; y++) {
-                    uint8_t val = splash_design_map[y][x];
-                    if (val == 0) {
-                        // transparent - turn off
-                        int led_num = ledMatrix.LED_Number[y][x];
-                        led_strip_set_pixel(led_strip, led_num, 0, 0, 0);
-                    } else {
-                        // restore design color
-                        uint8_t bidx = (val - 1) % NUM_BLOCKS;
-                        uint8_t r, g, b;
-                        get_block_rgb(bidx, &r, &g, &b);
-                        r = (r * GAME_BRIGHTNESS_SCALE) / 255;
-                        g = (g * GAME_BRIGHTNESS_SCALE) / 255;
-                        b = (b * GAME_BRIGHTNESS_SCALE) / 255;
-                        int led_num = ledMatrix.LED_Number[y][x];
-                        led_strip_set_pixel(led_strip, led_num, r, g, b);
-                    }
-                }
-                
-                // Draw text on top if visible
-                if (src >= 0 && src < total_cols){
-                    uint8_t col = text_bitmap[src];
-                    for (int y = 0; y < 5; y++){
-                        if (col & (1 << y)){
-                            int gy = 2 + y;
-                            int led_num = ledMatrix.LED_Number[gy][x];
-                            uint8_t brightness = (SPLASH_BRIGHTNESS_SCALE * 255) / 255;
-                            led_strip_set_pixel(led_strip, led_num, brightness, brightness, brightness);
-                        }
-                    }
-                }
-            }
-            led_strip_refresh(led_strip);
-            xSemaphoreGive(led_strip_semaphore);
-        }
+        splash_tick();
         
         // Check for button press
-        gpio_num_t ev;
-        if (controls_get_event(&ev) || 
-            check_button_pressed(BTN_LEFT) || 
-            check_button_pressed(BTN_RIGHT) || 
-            check_button_pressed(BTN_ROTATE) || 
-            check_button_pressed(BTN_FASTER)) {
-            button_pressed = true;
+        // Nur den Zustand lesen: das Press-Event bleibt im Ring für den GameLoop
+        if (controls_any_button_held()) {
+            break;
         }
         
-        vTaskDelay(pdMS_TO_TICKS(SPLASH_SCROLL_DELAY_MS));
-        step++;
-        
-        // Loop wraps continuously
-        if (step >= total_cols + LED_WIDTH) {
-            step = 0;
-        }
+        clock_sleep_ms(SPLASH_SCROLL_DELAY_MS);
     }
 }
 
@@ -299,16 +259,12 @@ void splash_show_duration(uint32_t duration_ms) {
 void splash_clear(void) {
     // SEMAPHOR-SCHUTZ: LED-Strip für Clear-Operation schützen
     if (xSemaphoreTake(led_strip_semaphore, pdMS_TO_TICKS(100)) == pdTRUE) {
-        // Setze alle LEDs auf schwarz (0,0,0)
-        for (int y = 0; y < LED_HEIGHT; y++) {
-            for (int x = 0; x < LED_WIDTH; x++) {
-                int led_num = ledMatrix.LED_Number[y][x];
-                led_strip_set_pixel(led_strip, led_num, 0, 0, 0);
-            }
-        }
-        
+        // Alle Ebenen leeren → alle LEDs schwarz (0,0,0)
+        compositor_reset();
+        compositor_commit();
+
         // Aktualisiere LED-Strip mit schwarzer Matrix
-        led_strip_refresh(led_strip);
+        compositor_present();
         xSemaphoreGive(led_strip_semaphore);
     }
 }
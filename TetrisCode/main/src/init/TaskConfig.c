@@ -0,0 +1,94 @@
+/**
+ * @file TaskConfig.c
+ * @brief Task-Topologien (Core-Zuordnung, Prioritäten, Stack-Budgets)
+ *
+ * Vorher lagen GameLoopTask und ThemeTask mit gleicher Priorität (5) ohne
+ * Core-Bindung, der LVGL-Task mit Priorität 4 ebenso: LED-Refresh, Buzzer-
+ * Transmits und OLED-Flush kamen sich zufällig in die Quere.
+ *
+ * Topologien (Kconfig, Vergleich mit CONFIG_TETRIS_STRESS_BENCH):
+ * - LEGACY: wie vorher, ohne Core-Bindung (Referenz)
+ * - SPLIT: GameLoop allein auf Core 1 mit höchster Priorität, Musik, HUD
+ *   und Diagnose auf Core 0 zusammen mit esp_timer und den RMT-Interrupts
+ * - SINGLE_CORE: alles auf Core 0 mit den SPLIT-Prioritäten (Worst Case)
+ */
+
+#include "TaskConfig.h"
+#include "sdkconfig.h"
+#include <stdio.h>
+
+// ============================================================================
+// TOPOLOGIEN
+// ============================================================================
+
+#if CONFIG_TETRIS_TOPOLOGY_LEGACY
+
+#define TOPOLOGY_NAME "legacy"
+static const task_config_t s_tasks[TASK_ROLE_COUNT] = {
+    [TASK_ROLE_GAMELOOP] = { "GameLoopTask", 4096, 5, tskNO_AFFINITY },
+    [TASK_ROLE_THEME]    = { "ThemeTask",    4096, 5, tskNO_AFFINITY },
+    [TASK_ROLE_LVGL]     = { "taskLVGL",     4096, 4, tskNO_AFFINITY },
+    [TASK_ROLE_CONSOLE]  = { "console_repl", 4096, 1, tskNO_AFFINITY },
+    [TASK_ROLE_SYSMON]   = { "SysMonTask",   3072, 1, tskNO_AFFINITY },
+    [TASK_ROLE_BINLOG]   = { "BinLogTask",   3072, 1, tskNO_AFFINITY },
+    [TASK_ROLE_BENCH]    = { "BenchTask",    3072, 2, tskNO_AFFINITY },
+};
+
+#elif CONFIG_TETRIS_TOPOLOGY_SINGLE_CORE
+
+#define TOPOLOGY_NAME "single-core"
+static const task_config_t s_tasks[TASK_ROLE_COUNT] = {
+    [TASK_ROLE_GAMELOOP] = { "GameLoopTask", 4096, 6, 0 },
+    [TASK_ROLE_THEME]    = { "ThemeTask",    4096, 4, 0 },
+    [TASK_ROLE_LVGL]     = { "taskLVGL",     4096, 3, 0 },
+    [TASK_ROLE_CONSOLE]  = { "console_repl", 4096, 1, 0 },
+    [TASK_ROLE_SYSMON]   = { "SysMonTask",   3072, 1, 0 },
+    [TASK_ROLE_BINLOG]   = { "BinLogTask",   3072, 1, 0 },
+    [TASK_ROLE_BENCH]    = { "BenchTask",    3072, 2, 0 },
+};
+
+#else // CONFIG_TETRIS_TOPOLOGY_SPLIT
+
+#define TOPOLOGY_NAME "split"
+static const task_config_t s_tasks[TASK_ROLE_COUNT] = {
+    [TASK_ROLE_GAMELOOP] = { "GameLoopTask", 4096, 6, 1 },  // Allein auf Core 1
+    [TASK_ROLE_THEME]    = { "ThemeTask",    4096, 4, 0 },  // Über HUD: Noten pünktlich
+    [TASK_ROLE_LVGL]     = { "taskLVGL",     4096, 3, 0 },
+    [TASK_ROLE_CONSOLE]  = { "console_repl", 4096, 1, 0 },
+    [TASK_ROLE_SYSMON]   = { "SysMonTask",   3072, 1, 0 },
+    [TASK_ROLE_BINLOG]   = { "BinLogTask",   3072, 1, 0 },
+    [TASK_ROLE_BENCH]    = { "BenchTask",    3072, 2, 0 },
+};
+
+#endif
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+const task_config_t *task_config(task_role_t role) {
+    return &s_tasks[role < TASK_ROLE_COUNT ? role : TASK_ROLE_BENCH];
+}
+
+const char *task_topology_name(void) {
+    return TOPOLOGY_NAME;
+}
+
+BaseType_t task_config_create(task_role_t role, TaskFunction_t fn, void *arg, TaskHandle_t *out) {
+    const task_config_t *cfg = task_config(role);
+    return xTaskCreatePinnedToCore(fn, cfg->name, cfg->stack_bytes, arg, cfg->priority, out, cfg->core);
+}
+
+void task_config_print(void) {
+    printf("[Tasks] Topology: %s\n", TOPOLOGY_NAME);
+    for (int i = 0; i < TASK_ROLE_COUNT; i++) {
+        const task_config_t *cfg = &s_tasks[i];
+        if (cfg->core == tskNO_AFFINITY) {
+            printf("[Tasks]   %-13s prio %2u  core  -  stack %5lu\n",
+                   cfg->name, (unsigned)cfg->priority, (unsigned long)cfg->stack_bytes);
+        } else {
+            printf("[Tasks]   %-13s prio %2u  core %2d  stack %5lu\n",
+                   cfg->name, (unsigned)cfg->priority, (int)cfg->core, (unsigned long)cfg->stack_bytes);
+        }
+    }
+}
@@ -35,6 +35,17 @@ In dem Ordner src befinden sich alle .c Dateien und in dem Ordner hdr alle .h Da
 #include "DisplayInit.h"
 #include "Splash.h"
 #include "ThemeSong.h"
+#include "Clock.h"
+#include "DebugConsole.h"
+#include "SysMonitor.h"
+#include "BinLog.h"
+#include "TaskConfig.h"
+#include "StressBench.h"
+#include "LedStripLut.h"
+#include "LedStripSpi.h"
+#include "LedStripMulti.h"
+#include "Compositor.h"
+#include "FrameSink.h"
 
 //////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -58,23 +69,116 @@ void setup_led_strip() {
         .max_leds = LED_STRIP_NUM_LEDS,
     };
 
+#if CONFIG_TETRIS_LED_ENCODER_BENCH
+    // ISR-Zeit pro Frame: Bytes-Encoder gegen LUT-Encoder (vor dem eigentlichen Strip)
+    led_strip_encoder_bench(&strip_config, LED_ENCODER_BENCH_FRAMES);
+    led_strip_spi_encode_bench();
+#endif
+
+#if CONFIG_TETRIS_LED_DRIVER_MULTI
+#define LED_DRIVER_NAME "multi"
+    // Panelgruppen parallel auf LED_OUTPUT_CHANNELS RMT-Kanälen (LedStripMulti.c)
+    static const int led_gpios[LED_MULTI_MAX_CHANNELS] = { LED_GPIO_PIN, LED_GPIO_PIN_2, LED_GPIO_PIN_3 };
+    led_strip_multi_config_t multi_config = {
+        .num_channels = LED_OUTPUT_CHANNELS,
+        .gpio_nums = led_gpios,
+        .panel_leds = LED_PANEL_LEDS,
+    };
+
+    ESP_ERROR_CHECK(led_strip_new_multi_rmt_device(&strip_config, &multi_config, &led_strip));
+#elif CONFIG_TETRIS_LED_DRIVER_SPI
+#define LED_DRIVER_NAME "spi"
+    // SPI-MOSI mit Tabellen-Expansion direkt in den DMA-Puffer (LedStripSpi.c)
+    led_strip_spi_lut_config_t spi_config = {
+        .spi_bus = LED_SPI_HOST,
+        .with_dma = true,
+    };
+
+    ESP_ERROR_CHECK(led_strip_new_spi_lut_device(&strip_config, &spi_config, &led_strip));
+#elif CONFIG_TETRIS_LED_DRIVER_LUT
+#define LED_DRIVER_NAME "lut"
+    // RMT mit Nibble-Tabellen-Encoder (LedStripLut.c)
+    led_strip_lut_config_t lut_config = {
+        .mem_block_symbols = 0,
+        .with_dma = false,
+    };
+
+    ESP_ERROR_CHECK(led_strip_new_lut_rmt_device(&strip_config, &lut_config, &led_strip));
+#else
+#define LED_DRIVER_NAME "rmt"
     led_strip_rmt_config_t rmt_config = {
         .resolution_hz = 10 * 1000 * 1000,
         .flags.with_dma = false,
     };
 
     ESP_ERROR_CHECK(led_strip_new_rmt_device(&strip_config, &rmt_config, &led_strip));
+#endif
     led_strip_clear(led_strip);
     // Ensure physical LEDs are updated after initialization
     led_strip_refresh(led_strip);
 }
 
+// Frame-Senken für compositor_present(): der Strip immer, die übrigen laut Kconfig
+void setup_frame_sinks() {
+    frame_sink_t *sink = NULL;
+
+    ESP_ERROR_CHECK(frame_sink_new_led_strip(led_strip, LED_DRIVER_NAME, &sink));
+    frame_sink_register(sink, true);
+
+#if CONFIG_TETRIS_SINK_SHARED
+#if CONFIG_IDF_TARGET_LINUX
+    frame_shared_t *shared = frame_shared_open_posix(FRAME_SINK_SHM_NAME);
+#else
+    static frame_shared_t s_shared_frame;
+    frame_shared_t *shared = &s_shared_frame;
+#endif
+    if (shared != NULL && frame_sink_new_shared(shared, &sink) == ESP_OK) {
+        frame_sink_register(sink, true);
+    }
+#endif
+
+#if CONFIG_TETRIS_SINK_PPM
+    if (frame_sink_new_ppm(FRAME_SINK_PPM_PATH, FRAME_SINK_PPM_SCALE, &sink) == ESP_OK) {
+        frame_sink_register(sink, true);
+    }
+#endif
+
+#if CONFIG_TETRIS_SINK_ANSI
+    if (frame_sink_new_ansi(stdout, FRAME_SINK_ANSI_INTERVAL_MS, &sink) == ESP_OK) {
+#if CONFIG_TETRIS_DEBUG_CONSOLE
+        frame_sink_register(sink, false);  // Teilt sich die UART mit der Konsole: "sink ansi on"
+#else
+        frame_sink_register(sink, true);
+#endif
+    }
+#endif
+
+#if CONFIG_TETRIS_FRAME_SINK_BENCH
+    // Kosten pro Frame und Senke, hinterlässt schwarze Ausgabe wie compositor_init() erwartet
+    frame_sink_bench(FRAME_SINK_BENCH_FRAMES);
+#endif
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////////////
 
 void app_main(void){
+#if CONFIG_TETRIS_CLOCK_VIRTUAL
+    // Virtuelle Zeit: Simulation läuft so schnell wie möglich (siehe Clock.h)
+    clock_use_virtual(0);
+    clock_seed_random(CONFIG_TETRIS_CLOCK_VIRTUAL_SEED);
+#endif
+
+    // Core/Priorität/Stack aller Tasks (TaskConfig.c, Kconfig TETRIS_TOPOLOGY_*)
+    task_config_print();
+
+    // Binäres Log (Drain-Task) vor allen Modulen starten, die BLOG() verwenden
+    binlog_start();
+
     // LED Matrix initialisieren
     setup_led_strip();
     LedMatrixInit(LED_HEIGHT, LED_WIDTH, ledMatrix.LED_Number);
+    setup_frame_sinks();
+    compositor_init();  // Ebenen über dem (gelöschten) Strip
 
     // ========================
     // FREERTOS SEMAPHORE INIT
@@ -109,8 +213,7 @@ void app_main(void){
     splash_show(SPLASH_DURATION_MS);
 
     // Clear LED matrix after splash
-    led_strip_clear(led_strip);
-    led_strip_refresh(led_strip);
+    splash_clear();
 
     // Grid und Score initialisieren
     grid_init();
@@ -127,6 +230,12 @@ void app_main(void){
     // Controls initialisieren
     init_controls();
 
+    // Diagnose-Konsole (latency, input, ...), nur mit CONFIG_TETRIS_DEBUG_CONSOLE
+    debug_console_start();
+
+    // System-Monitor (CPU/Stack/Heap), nur mit CONFIG_TETRIS_SYSMON
+    sysmon_start();
+
     // -------------------------------
     // Tetris Theme starten (parallel)
     // -------------------------------
@@ -134,6 +243,9 @@ void app_main(void){
     // GameLoop starten (Button-Druck kommentiert aus - GameLoop startet direkt)
     start_game_loop();
 
+    // Stress-Benchmark der Task-Topologie, nur mit CONFIG_TETRIS_STRESS_BENCH
+    stress_bench_start();
+
     // Keep app running (GameLoop task handles the game)
     while(1){
         vTaskDelay(pdMS_TO_TICKS(1000));
@@ -0,0 +1,72 @@
+#!/usr/bin/env python3
+"""Convert ASCII art into an RLE sprite initializer for Anim.h.
+
+One character per pixel, one line per row: '.' or ' ' is transparent,
+'1'..'7' select palette[0..6]. Rows shorter than the widest row are padded
+with transparent pixels. The output is the body of an anim_sprite_t data
+array (ANIM_RUN(n, c) runs, row-major, at most 32 pixels per run) plus the
+sprite width and height, ready to paste into main/src/Render/AnimClips.c.
+
+Usage: anim_rle.py [art.txt] [--name s_sprite_rle]
+"""
+
+import argparse
+import sys
+
+MAX_RUN = 32  # 5 Bit Lauflänge (Anim.h)
+
+
+def parse(lines):
+    rows = [line.rstrip("\n") for line in lines if line.strip("\n") != ""]
+    width = max(len(r) for r in rows)
+    pixels = []
+    for r in rows:
+        for ch in r.ljust(width, "."):
+            if ch in ". ":
+                pixels.append(0)
+            elif ch in "1234567":
+                pixels.append(int(ch))
+            else:
+                raise ValueError("unsupported pixel character %r" % ch)
+    return width, len(rows), pixels
+
+
+def encode(pixels):
+    runs = []
+    i = 0
+    while i < len(pixels):
+        c = pixels[i]
+        n = 1
+        while i + n < len(pixels) and pixels[i + n] == c and n < MAX_RUN:
+            n += 1
+        runs.append((n, c))
+        i += n
+    return runs
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("art", nargs="?", help="ASCII art file (default: stdin)")
+    ap.add_argument("--name", default="s_sprite_rle", help="C array name")
+    args = ap.parse_args()
+
+    src = open(args.art, encoding="utf-8") if args.art else sys.stdin
+    with src:
+        width, height, pixels = parse(src.readlines())
+    runs = encode(pixels)
+
+    print("// %dx%d, %d Läufe (%d Pixel)" % (width, height, len(runs), len(pixels)))
+    print("static const uint8_t %s[] = {" % args.name)
+    line = "   "
+    for n, c in runs:
+        item = " ANIM_RUN(%d, %d)," % (n, c)
+        if len(line) + len(item) > 96:
+            print(line)
+            line = "   "
+        line += item
+    print(line)
+    print("};")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,65 @@
+#!/usr/bin/env python3
+"""Decode binary log records (BinLog.c) from a captured serial log.
+
+With CONFIG_TETRIS_BINLOG_HEX the drain task prints every record as
+"BL <48 hex chars>". This script reads the message formats from
+main/hdr/LogCatalog.h and prints the records as text, prefixed with
+timestamp (ms) and core. All other lines are passed through unchanged.
+
+Usage: binlog_decode.py [capture.txt] [--catalog path/to/LogCatalog.h]
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+# binlog_record_t: seq, id, core, reserved, timestamp_us, args[3] (little endian)
+RECORD = struct.Struct("<IHBBIiii")
+
+DEFAULT_CATALOG = os.path.join(os.path.dirname(__file__), "..", "main", "hdr", "LogCatalog.h")
+
+
+def load_catalog(path):
+    """Return the format strings in catalog order (index = log id)."""
+    with open(path, encoding="utf-8") as f:
+        text = f.read()
+    # Only the X-macro list itself (the header comment shows the syntax, too)
+    text = text[text.index("#define BINLOG_CATALOG(X)"):]
+    entries = re.findall(r'X\(\s*(\w+)\s*,\s*"((?:[^"\\]|\\.)*)"\s*\)', text)
+    return [(name, fmt.encode().decode("unicode_escape")) for name, fmt in entries]
+
+
+def format_record(catalog, data):
+    seq, log_id, core, _reserved, ts_us, a0, a1, a2 = RECORD.unpack(data)
+    if log_id >= len(catalog):
+        msg = "[BinLog] unknown id %d (%d, %d, %d)" % (log_id, a0, a1, a2)
+    else:
+        fmt = catalog[log_id][1]
+        convs = re.findall(r"%[-+ #0-9.]*l?([diux])", fmt)
+        # Unsigned conversions print the raw uint32 like the device does
+        args = tuple(a & 0xFFFFFFFF if c in "ux" else a for c, a in zip(convs, (a0, a1, a2)))
+        msg = fmt % args
+    return "%10.3f c%d %s" % (ts_us / 1000.0, core, msg)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("capture", nargs="?", help="serial capture (default: stdin)")
+    parser.add_argument("--catalog", default=DEFAULT_CATALOG, help="path to LogCatalog.h")
+    args = parser.parse_args()
+
+    catalog = load_catalog(args.catalog)
+    src = open(args.capture, encoding="utf-8", errors="replace") if args.capture else sys.stdin
+
+    for line in src:
+        m = re.search(r"BL ([0-9a-fA-F]{%d})" % (RECORD.size * 2), line)
+        if m:
+            print(format_record(catalog, bytes.fromhex(m.group(1))))
+        else:
+            sys.stdout.write(line)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,122 @@
+#!/usr/bin/env python3
+"""Generate the 3x5 LED matrix font atlas (main/src/Render/Font3x5.c).
+
+Each glyph is drawn below as five rows of three pixels ('1' = lit). The
+atlas stores three column bytes per glyph, bit y = row y, for every ASCII
+character from FONT3X5_FIRST to FONT3X5_LAST (Font3x5.h). Characters
+without a drawing stay blank. Lowercase letters are mapped to uppercase by
+font3x5_glyph() at runtime, so they are not stored.
+
+Usage: font3x5.py [-o path/to/Font3x5.c]
+"""
+
+import argparse
+import os
+
+FIRST = 0x20
+LAST = 0x5A  # 'Z'
+
+DEFAULT_OUT = os.path.join(os.path.dirname(__file__), "..", "main", "src", "Render", "Font3x5.c")
+
+GLYPHS = {
+    "!": "010 010 010 000 010",
+    '"': "101 101 000 000 000",
+    "#": "101 111 101 111 101",
+    "$": "011 110 010 011 110",
+    "%": "101 001 010 100 101",
+    "&": "010 101 010 101 011",
+    "'": "010 010 000 000 000",
+    "(": "001 010 010 010 001",
+    ")": "100 010 010 010 100",
+    "*": "000 101 010 101 000",
+    "+": "000 010 111 010 000",
+    ",": "000 000 000 010 100",
+    "-": "000 000 111 000 000",
+    ".": "000 000 000 000 010",
+    "/": "001 001 010 100 100",
+    "0": "111 101 101 101 111",
+    "1": "010 110 010 010 111",
+    "2": "111 001 111 100 111",
+    "3": "111 001 111 001 111",
+    "4": "101 101 111 001 001",
+    "5": "111 100 111 001 111",
+    "6": "111 100 111 101 111",
+    "7": "111 001 001 010 010",
+    "8": "111 101 111 101 111",
+    "9": "111 101 111 001 111",
+    ":": "000 010 000 010 000",
+    ";": "000 010 000 010 100",
+    "<": "001 010 100 010 001",
+    "=": "000 111 000 111 000",
+    ">": "100 010 001 010 100",
+    "?": "111 001 011 000 010",
+    "@": "010 101 111 100 011",
+    "A": "010 101 111 101 101",
+    "B": "110 101 110 101 110",
+    "C": "011 100 100 100 011",
+    "D": "110 101 101 101 110",
+    "E": "111 100 111 100 111",
+    "F": "111 100 111 100 100",
+    "G": "011 100 101 101 011",
+    "H": "101 101 111 101 101",
+    "I": "111 010 010 010 111",
+    "J": "001 001 001 101 010",
+    "K": "101 101 110 101 101",
+    "L": "100 100 100 100 111",
+    "M": "101 111 111 101 101",
+    "N": "110 101 101 101 101",
+    "O": "010 101 101 101 010",
+    "P": "110 101 110 100 100",
+    "Q": "010 101 101 110 011",
+    "R": "110 101 110 101 101",
+    "S": "011 100 010 001 110",
+    "T": "111 010 010 010 010",
+    "U": "101 101 101 101 111",
+    "V": "101 101 101 101 010",
+    "W": "101 101 111 111 101",
+    "X": "101 101 010 101 101",
+    "Y": "101 101 010 010 010",
+    "Z": "111 001 010 100 111",
+}
+
+
+def columns(art):
+    rows = art.split()
+    assert len(rows) == 5 and all(len(r) == 3 for r in rows), art
+    return [sum(1 << y for y in range(5) if rows[y][x] == "1") for x in range(3)]
+
+
+def label(ch):
+    return "'\\''" if ch == "'" else "'%s'" % ch
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("-o", "--out", default=DEFAULT_OUT)
+    args = ap.parse_args()
+
+    lines = [
+        "/**",
+        " * @file Font3x5.c",
+        " * @brief 3x5 Font-Atlas für die LED-Matrix",
+        " *",
+        " * Erzeugt von tools/font3x5.py - nicht von Hand ändern.",
+        " * Drei Spalten-Bytes pro Zeichen, Bit y = Zeile y (oben = Bit 0).",
+        " */",
+        "",
+        '#include "Font3x5.h"',
+        "",
+        "const uint8_t font3x5_atlas[FONT3X5_COUNT][FONT3X5_W] = {",
+    ]
+    for code in range(FIRST, LAST + 1):
+        ch = chr(code)
+        c = columns(GLYPHS[ch]) if ch in GLYPHS else [0, 0, 0]
+        lines.append("    { 0x%02X, 0x%02X, 0x%02X },  // %s" % (c[0], c[1], c[2], label(ch)))
+    lines.append("};")
+
+    with open(args.out, "w", encoding="utf-8") as f:
+        f.write("\n".join(lines) + "\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,143 @@
+#!/usr/bin/env python3
+"""Convert a trace ring dump (Trace.c) into Chrome trace JSON.
+
+The console command 'trace dump' prints the ring between "TRACE BEGIN" and
+"TRACE END" as "TR <24 hex chars>" lines. This script reads the event names
+and tracks from main/hdr/Trace.h and writes a Chrome trace (JSON object
+format) that chrome://tracing and https://ui.perfetto.dev open directly.
+Every track becomes its own thread row. If the capture holds several dumps,
+the last one is converted.
+
+Usage: trace2chrome.py [capture.txt] [-o trace.json] [--header path/to/Trace.h]
+"""
+
+import argparse
+import json
+import os
+import re
+import struct
+import sys
+
+# trace_event_t: timestamp_us, id, phase, core, arg (packed, little endian)
+EVENT = struct.Struct("<IHBBi")
+
+DEFAULT_HEADER = os.path.join(os.path.dirname(__file__), "..", "main", "hdr", "Trace.h")
+
+# Lesbare Argumente pro Event-Name
+BUTTONS = ["LEFT", "RIGHT", "ROTATE", "FASTER"]  # button_id_t (InputRing.h)
+EDGES = ["press", "release"]  # input_edge_t
+
+
+def load_header(path):
+    """Return (track names, [(event name, track index)]) in header order."""
+    with open(path, encoding="utf-8") as f:
+        text = f.read()
+    tracks_text = text[text.index("#define TRACE_TRACKS(X)"):text.index("#define TRACE_CATALOG(X)")]
+    catalog_text = text[text.index("#define TRACE_CATALOG(X)"):]
+
+    tracks = re.findall(r'X\(\s*(\w+)\s*,\s*"([^"]*)"\s*\)', tracks_text)
+    track_index = {ident: i for i, (ident, _name) in enumerate(tracks)}
+    entries = re.findall(r'X\(\s*\w+\s*,\s*"([^"]*)"\s*,\s*(\w+)\s*\)', catalog_text)
+    return [name for _ident, name in tracks], [(name, track_index[t]) for name, t in entries]
+
+
+def read_dump(src):
+    """Return the raw events of the last complete dump in the capture."""
+    dumps, current = [], None
+    for line in src:
+        if "TRACE BEGIN" in line:
+            current = []
+        elif "TRACE END" in line and current is not None:
+            dumps.append(current)
+            current = None
+        elif current is not None:
+            m = re.search(r"TR ([0-9a-fA-F]{%d})" % (EVENT.size * 2), line)
+            if m:
+                current.append(EVENT.unpack(bytes.fromhex(m.group(1))))
+    if current:
+        dumps.append(current)  # Dump ohne TRACE END (abgeschnittene Aufzeichnung)
+    return dumps[-1] if dumps else []
+
+
+def event_args(name, phase, core, arg):
+    args = {"core": core}
+    if name == "button":
+        button, edge = arg & 0xFF, (arg >> 8) & 0xFF
+        args["button"] = BUTTONS[button] if button < len(BUTTONS) else button
+        args["edge"] = EDGES[edge] if edge < len(EDGES) else edge
+    elif name == "note":
+        args["freq_hz"] = arg
+    elif phase in ("i", "B") and arg:
+        args["arg"] = arg
+    return args
+
+
+def convert(raw, tracks, catalog):
+    events = []
+    open_spans = {}  # tid -> Anzahl offener B (E ohne B stammt aus überschriebenem Teil)
+    prev_ts, offset = None, 0
+
+    for ts32, event_id, phase_byte, core, arg in raw:
+        # 32-Bit Mikrosekunden laufen nach ~71 min über
+        if prev_ts is not None and ts32 < prev_ts and prev_ts - ts32 > 0x80000000:
+            offset += 1 << 32
+        prev_ts = ts32
+        ts = ts32 + offset
+
+        if event_id >= len(catalog):
+            name, tid = "unknown_%d" % event_id, len(tracks)
+        else:
+            name, tid = catalog[event_id]
+        phase = chr(phase_byte)
+
+        if phase == "B":
+            open_spans[tid] = open_spans.get(tid, 0) + 1
+        elif phase == "E":
+            if open_spans.get(tid, 0) == 0:
+                continue
+            open_spans[tid] -= 1
+
+        ev = {"name": name, "ph": phase, "ts": ts, "pid": 1, "tid": tid,
+              "args": event_args(name, phase, core, arg)}
+        if phase == "X":
+            ev["dur"] = arg
+        elif phase == "i":
+            ev["s"] = "t"
+        events.append(ev)
+
+    if events:
+        start = min(ev["ts"] for ev in events)
+        for ev in events:
+            ev["ts"] -= start
+
+    meta = [{"name": "process_name", "ph": "M", "pid": 1, "args": {"name": "Tetris ESP32-S3"}}]
+    for tid, track in enumerate(tracks):
+        meta.append({"name": "thread_name", "ph": "M", "pid": 1, "tid": tid, "args": {"name": track}})
+        meta.append({"name": "thread_sort_index", "ph": "M", "pid": 1, "tid": tid,
+                     "args": {"sort_index": tid}})
+    return {"traceEvents": meta + events, "displayTimeUnit": "ms"}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("capture", nargs="?", help="serial capture (default: stdin)")
+    parser.add_argument("-o", "--output", help="output file (default: stdout)")
+    parser.add_argument("--header", default=DEFAULT_HEADER, help="path to Trace.h")
+    args = parser.parse_args()
+
+    tracks, catalog = load_header(args.header)
+    src = open(args.capture, encoding="utf-8", errors="replace") if args.capture else sys.stdin
+    raw = read_dump(src)
+    if not raw:
+        sys.exit("no trace dump found (expected 'TRACE BEGIN' ... 'TRACE END')")
+
+    trace = convert(raw, tracks, catalog)
+    out = open(args.output, "w", encoding="utf-8") if args.output else sys.stdout
+    json.dump(trace, out)
+    if args.output:
+        out.close()
+        print("%d events -> %s" % (len(trace["traceEvents"]), args.output), file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()